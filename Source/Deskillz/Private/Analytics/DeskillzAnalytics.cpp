@@ -1,8 +1,10 @@
 // Copyright Deskillz Games. All Rights Reserved.
 
 #include "Analytics/DeskillzAnalytics.h"
+#include "Analytics/DeskillzTelemetry.h"
 #include "Network/DeskillzHttpClient.h"
 #include "Deskillz.h"
+#include "Core/DeskillzStats.h"
 #include "Misc/Guid.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
@@ -17,6 +19,25 @@
 // Static singleton
 static UDeskillzAnalytics* GAnalytics = nullptr;
 
+// Accounted size of a queued event
+static int64 GetEventMemoryBytes(const FDeskillzAnalyticsEvent& Event)
+{
+	int64 Bytes = sizeof(FDeskillzAnalyticsEvent) + Event.EventName.GetAllocatedSize()
+		+ Event.SessionId.GetAllocatedSize() + Event.UserId.GetAllocatedSize()
+		+ Event.Parameters.GetAllocatedSize() + Event.NumericValues.GetAllocatedSize();
+	
+	for (const auto& Pair : Event.Parameters)
+	{
+		Bytes += Pair.Key.GetAllocatedSize() + Pair.Value.GetAllocatedSize();
+	}
+	for (const auto& Pair : Event.NumericValues)
+	{
+		Bytes += Pair.Key.GetAllocatedSize();
+	}
+	
+	return Bytes;
+}
+
 UDeskillzAnalytics::UDeskillzAnalytics()
 {
 }
@@ -114,6 +135,8 @@ void UDeskillzAnalytics::Shutdown()
 
 void UDeskillzAnalytics::TrackEvent(const FDeskillzAnalyticsEvent& Event)
 {
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzTrackEvent, DeskillzAnalyticsChannel);
+	
 	if (!IsEnabled())
 	{
 		return;
@@ -343,6 +366,53 @@ void UDeskillzAnalytics::ClearQueue()
 	UE_LOG(LogDeskillz, Log, TEXT("Analytics queue cleared"));
 }
 
+int64 UDeskillzAnalytics::GetQueueMemoryBytes() const
+{
+	FScopeLock Lock(&QueueLock);
+	
+	int64 Bytes = EventQueue.GetAllocatedSize() - EventQueue.Num() * sizeof(FDeskillzAnalyticsEvent);
+	for (const FDeskillzAnalyticsEvent& Event : EventQueue)
+	{
+		Bytes += GetEventMemoryBytes(Event);
+	}
+	return Bytes;
+}
+
+void UDeskillzAnalytics::TrimQueue(int64 MaxBytes)
+{
+	// An in-flight flush removes the first N events on completion, so don't shift them
+	if (bIsFlushing)
+	{
+		return;
+	}
+	
+	if (GetQueueMemoryBytes() <= MaxBytes)
+	{
+		return;
+	}
+	
+	if (AnalyticsConfig.bPersistOffline)
+	{
+		PersistQueue();
+	}
+	
+	FScopeLock Lock(&QueueLock);
+	
+	// Re-measure under the lock; a flush may have completed meanwhile
+	int64 Bytes = GetQueueMemoryBytes();
+	int32 ToRemove = 0;
+	while (ToRemove < EventQueue.Num() && Bytes > MaxBytes)
+	{
+		Bytes -= GetEventMemoryBytes(EventQueue[ToRemove]);
+		ToRemove++;
+	}
+	
+	EventQueue.RemoveAt(0, ToRemove);
+	EventQueue.Shrink();
+	
+	UE_LOG(LogDeskillz, Warning, TEXT("Analytics queue trimmed - removed %d events"), ToRemove);
+}
+
 // ============================================================================
 // Session
 // ============================================================================
@@ -395,6 +465,7 @@ bool UDeskillzAnalytics::ShouldSampleEvent() const
 
 void UDeskillzAnalytics::EnqueueEvent(const FDeskillzAnalyticsEvent& Event)
 {
+	LLM_SCOPE_BYTAG(Deskillz_Analytics);
 	FScopeLock Lock(&QueueLock);
 	
 	// Check max queue size
@@ -423,6 +494,9 @@ void UDeskillzAnalytics::CheckFlush()
 
 void UDeskillzAnalytics::DoFlush()
 {
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzAnalyticsFlush, DeskillzAnalyticsChannel);
+	DESKILLZ_SCOPED_ACTIVITY(AnalyticsFlush);
+	
 	if (bIsFlushing || EventQueue.Num() == 0)
 	{
 		return;
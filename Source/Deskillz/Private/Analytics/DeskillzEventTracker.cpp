@@ -28,80 +28,106 @@ UDeskillzEventTracker* UDeskillzEventTracker::Get()
 
 void UDeskillzEventTracker::StartTimedEvent(const FString& EventName, const TMap<FString, FString>& Parameters)
 {
-	if (ActiveTimedEvents.Contains(EventName))
+	if (IsTimedEventActive(EventName))
 	{
 		UE_LOG(LogDeskillz, Warning, TEXT("Timed event already active: %s"), *EventName);
 		return;
 	}
 	
-	FDeskillzTimedEvent TimedEvent;
-	TimedEvent.EventName = EventName;
-	TimedEvent.StartTime = GetCurrentTimestamp();
-	TimedEvent.Parameters = Parameters;
-	
-	ActiveTimedEvents.Add(EventName, TimedEvent);
-	
-	UE_LOG(LogDeskillz, Verbose, TEXT("Started timed event: %s"), *EventName);
+	FDeskillzTimedEventHandle Handle = BeginTimedEvent(FName(*EventName));
+	ActiveTimedEvents.Find(Handle)->Parameters = Parameters;
+	NamedTimedEvents.Add(EventName, Handle);
 }
 
 void UDeskillzEventTracker::EndTimedEvent(const FString& EventName, const TMap<FString, FString>& AdditionalParams)
 {
-	FDeskillzTimedEvent* TimedEvent = ActiveTimedEvents.Find(EventName);
-	if (!TimedEvent)
+	FDeskillzTimedEventHandle Handle;
+	if (!NamedTimedEvents.RemoveAndCopyValue(EventName, Handle) || !ActiveTimedEvents.Contains(Handle))
 	{
 		UE_LOG(LogDeskillz, Warning, TEXT("No active timed event: %s"), *EventName);
 		return;
 	}
 	
-	TimedEvent->EndTime = GetCurrentTimestamp();
-	TimedEvent->Duration = static_cast<float>(TimedEvent->EndTime - TimedEvent->StartTime) / 1000.0f;
-	TimedEvent->bIsCompleted = true;
+	FinishTimedEvent(Handle, AdditionalParams);
+}
+
+void UDeskillzEventTracker::CancelTimedEvent(const FString& EventName)
+{
+	FDeskillzTimedEventHandle Handle;
+	if (NamedTimedEvents.RemoveAndCopyValue(EventName, Handle) && ActiveTimedEvents.Remove(Handle))
+	{
+		UE_LOG(LogDeskillz, Verbose, TEXT("Cancelled timed event: %s"), *EventName);
+	}
+}
+
+float UDeskillzEventTracker::GetTimedEventDuration(const FString& EventName) const
+{
+	const FDeskillzTimedEventHandle* Handle = NamedTimedEvents.Find(EventName);
+	return Handle ? GetTimedEventElapsed(*Handle) : 0.0f;
+}
+
+bool UDeskillzEventTracker::IsTimedEventActive(const FString& EventName) const
+{
+	const FDeskillzTimedEventHandle* Handle = NamedTimedEvents.Find(EventName);
+	return Handle && ActiveTimedEvents.Contains(*Handle);
+}
+
+FDeskillzTimedEventHandle UDeskillzEventTracker::BeginTimedEvent(FName EventName)
+{
+	FActiveTimedEvent TimedEvent;
+	TimedEvent.EventName = EventName;
+	TimedEvent.StartCycles = FPlatformTime::Cycles64();
 	
-	// Merge additional parameters
-	for (const auto& Pair : AdditionalParams)
+	UE_LOG(LogDeskillz, Verbose, TEXT("Started timed event: %s"), *EventName.ToString());
+	
+	return ActiveTimedEvents.Add(MoveTemp(TimedEvent));
+}
+
+void UDeskillzEventTracker::FinishTimedEvent(FDeskillzTimedEventHandle Handle, const TMap<FString, FString>& AdditionalParams)
+{
+	FActiveTimedEvent* TimedEvent = ActiveTimedEvents.Find(Handle);
+	if (!TimedEvent)
 	{
-		TimedEvent->Parameters.Add(Pair.Key, Pair.Value);
+		UE_LOG(LogDeskillz, Warning, TEXT("Timed event handle is not active"));
+		return;
 	}
 	
+	const float Duration = CyclesToSeconds(TimedEvent->StartCycles, FPlatformTime::Cycles64());
+	
 	// Track to analytics
 	if (Analytics && Analytics->IsEnabled())
 	{
-		FDeskillzAnalyticsEvent Event(EventName + TEXT("_completed"), EDeskillzEventCategory::Game);
-		Event.Parameters = TimedEvent->Parameters;
-		Event.AddValue(TEXT("duration_seconds"), TimedEvent->Duration);
+		FDeskillzAnalyticsEvent Event(TimedEvent->EventName.ToString() + TEXT("_completed"), EDeskillzEventCategory::Game);
+		Event.Parameters = MoveTemp(TimedEvent->Parameters);
+		for (const auto& Pair : AdditionalParams)
+		{
+			Event.Parameters.Add(Pair.Key, Pair.Value);
+		}
+		Event.AddValue(TEXT("duration_seconds"), Duration);
 		
 		Analytics->TrackEvent(Event);
 	}
 	
-	UE_LOG(LogDeskillz, Verbose, TEXT("Ended timed event: %s (%.2fs)"), *EventName, TimedEvent->Duration);
+	UE_LOG(LogDeskillz, Verbose, TEXT("Ended timed event: %s (%.2fs)"), *TimedEvent->EventName.ToString(), Duration);
 	
-	ActiveTimedEvents.Remove(EventName);
+	ActiveTimedEvents.Remove(Handle);
 	SessionEventCount++;
 }
 
-void UDeskillzEventTracker::CancelTimedEvent(const FString& EventName)
+void UDeskillzEventTracker::AbortTimedEvent(FDeskillzTimedEventHandle Handle)
 {
-	if (ActiveTimedEvents.Remove(EventName) > 0)
-	{
-		UE_LOG(LogDeskillz, Verbose, TEXT("Cancelled timed event: %s"), *EventName);
-	}
+	ActiveTimedEvents.Remove(Handle);
 }
 
-float UDeskillzEventTracker::GetTimedEventDuration(const FString& EventName) const
+float UDeskillzEventTracker::GetTimedEventElapsed(FDeskillzTimedEventHandle Handle) const
 {
-	const FDeskillzTimedEvent* TimedEvent = ActiveTimedEvents.Find(EventName);
+	const FActiveTimedEvent* TimedEvent = ActiveTimedEvents.Find(Handle);
 	if (!TimedEvent)
 	{
 		return 0.0f;
 	}
 	
-	int64 CurrentTime = GetCurrentTimestamp();
-	return static_cast<float>(CurrentTime - TimedEvent->StartTime) / 1000.0f;
-}
-
-bool UDeskillzEventTracker::IsTimedEventActive(const FString& EventName) const
-{
-	return ActiveTimedEvents.Contains(EventName);
+	return CyclesToSeconds(TimedEvent->StartCycles, FPlatformTime::Cycles64());
 }
 
 // ============================================================================
@@ -110,81 +136,184 @@ bool UDeskillzEventTracker::IsTimedEventActive(const FString& EventName) const
 
 void UDeskillzEventTracker::StartFunnel(const FString& FunnelName, const TArray<FString>& Steps)
 {
-	if (ActiveFunnels.Contains(FunnelName))
+	const FDeskillzFunnelHandle* Existing = NamedFunnels.Find(FunnelName);
+	if (Existing && ActiveFunnels.Contains(*Existing))
 	{
 		UE_LOG(LogDeskillz, Warning, TEXT("Funnel already active: %s"), *FunnelName);
 		return;
 	}
 	
-	FDeskillzFunnel Funnel;
-	Funnel.FunnelName = FunnelName;
-	Funnel.ExpectedSteps = Steps;
-	Funnel.StartTime = GetCurrentTimestamp();
-	
-	ActiveFunnels.Add(FunnelName, Funnel);
-	
-	// Track funnel start
-	if (Analytics && Analytics->IsEnabled())
-	{
-		FDeskillzAnalyticsEvent Event(TEXT("funnel_started"), EDeskillzEventCategory::User);
-		Event.AddParam(TEXT("funnel"), FunnelName);
-		Event.AddValue(TEXT("total_steps"), static_cast<double>(Steps.Num()));
-		
-		Analytics->TrackEvent(Event);
-	}
-	
-	UE_LOG(LogDeskillz, Verbose, TEXT("Started funnel: %s with %d steps"), *FunnelName, Steps.Num());
+	NamedFunnels.Add(FunnelName, BeginFunnel(DefineFunnel(FunnelName, Steps)));
 }
 
 void UDeskillzEventTracker::RecordFunnelStep(const FString& FunnelName, const FString& StepName,
 	const TMap<FString, FString>& Data)
 {
-	FDeskillzFunnel* Funnel = ActiveFunnels.Find(FunnelName);
+	const FDeskillzFunnelHandle* Handle = NamedFunnels.Find(FunnelName);
+	const FActiveFunnel* Funnel = Handle ? ActiveFunnels.Find(*Handle) : nullptr;
 	if (!Funnel)
 	{
 		UE_LOG(LogDeskillz, Warning, TEXT("No active funnel: %s"), *FunnelName);
 		return;
 	}
 	
-	// Find step index
-	int32 StepIndex = Funnel->ExpectedSteps.IndexOfByKey(StepName);
+	const int32 StepIndex = GetFunnelStepIndex(Funnel->FunnelId, StepName);
 	if (StepIndex == INDEX_NONE)
 	{
 		UE_LOG(LogDeskillz, Warning, TEXT("Unknown step '%s' in funnel '%s'"), *StepName, *FunnelName);
 		return;
 	}
 	
-	// Calculate time from previous step
-	int64 CurrentTime = GetCurrentTimestamp();
-	float TimeFromPrevious = 0.0f;
-	if (Funnel->CompletedSteps.Num() > 0)
+	const FDeskillzFunnelHandle FunnelHandle = *Handle;
+	AdvanceFunnel(FunnelHandle, StepIndex, Data);
+	
+	if (!ActiveFunnels.Contains(FunnelHandle))
+	{
+		NamedFunnels.Remove(FunnelName);
+	}
+}
+
+void UDeskillzEventTracker::AbandonFunnel(const FString& FunnelName, const FString& Reason)
+{
+	FDeskillzFunnelHandle Handle;
+	if (NamedFunnels.RemoveAndCopyValue(FunnelName, Handle))
+	{
+		AbortFunnel(Handle, Reason);
+	}
+}
+
+float UDeskillzEventTracker::GetFunnelProgress(const FString& FunnelName) const
+{
+	const FDeskillzFunnelHandle* Handle = NamedFunnels.Find(FunnelName);
+	return Handle ? GetFunnelCompletion(*Handle) : 0.0f;
+}
+
+FString UDeskillzEventTracker::GetCurrentFunnelStep(const FString& FunnelName) const
+{
+	const FDeskillzFunnelHandle* Handle = NamedFunnels.Find(FunnelName);
+	const FActiveFunnel* Funnel = Handle ? ActiveFunnels.Find(*Handle) : nullptr;
+	if (!Funnel || Funnel->LastStepIndex == INDEX_NONE)
+	{
+		return TEXT("");
+	}
+	
+	return FunnelDefinitions[Funnel->FunnelId].Steps[Funnel->LastStepIndex];
+}
+
+int32 UDeskillzEventTracker::DefineFunnel(const FString& FunnelName, const TArray<FString>& Steps)
+{
+	int32 FunnelId = INDEX_NONE;
+	if (const int32* ExistingId = FunnelIds.Find(FunnelName))
 	{
-		TimeFromPrevious = static_cast<float>(CurrentTime - Funnel->CompletedSteps.Last().Timestamp) / 1000.0f;
+		if (FunnelDefinitions[*ExistingId].Steps == Steps)
+		{
+			return *ExistingId;
+		}
+		
+		// Running funnels index the old steps; only rewrite a definition nobody uses
+		if (FunnelDefinitions[*ExistingId].ActiveCount == 0)
+		{
+			FunnelId = *ExistingId;
+		}
 	}
-	else
+	
+	if (FunnelId == INDEX_NONE)
 	{
-		TimeFromPrevious = static_cast<float>(CurrentTime - Funnel->StartTime) / 1000.0f;
+		FunnelId = FunnelDefinitions.AddDefaulted();
+		FunnelIds.Add(FunnelName, FunnelId);
 	}
 	
-	// Create step record
-	FDeskillzFunnelStep Step;
-	Step.StepName = StepName;
-	Step.StepIndex = StepIndex;
-	Step.Timestamp = CurrentTime;
-	Step.TimeFromPrevious = TimeFromPrevious;
-	Step.Data = Data;
+	FFunnelDefinition& Definition = FunnelDefinitions[FunnelId];
+	Definition.FunnelName = FunnelName;
+	Definition.Steps = Steps;
+	Definition.StepIndices.Reset();
+	for (int32 StepIndex = 0; StepIndex < Steps.Num(); StepIndex++)
+	{
+		// First occurrence wins, matching lookup by name
+		if (!Definition.StepIndices.Contains(Steps[StepIndex]))
+		{
+			Definition.StepIndices.Add(Steps[StepIndex], StepIndex);
+		}
+	}
 	
-	Funnel->CompletedSteps.Add(Step);
+	return FunnelId;
+}
+
+int32 UDeskillzEventTracker::GetFunnelStepIndex(int32 FunnelId, const FString& StepName) const
+{
+	if (!FunnelDefinitions.IsValidIndex(FunnelId))
+	{
+		return INDEX_NONE;
+	}
+	
+	const int32* StepIndex = FunnelDefinitions[FunnelId].StepIndices.Find(StepName);
+	return StepIndex ? *StepIndex : INDEX_NONE;
+}
+
+FDeskillzFunnelHandle UDeskillzEventTracker::BeginFunnel(int32 FunnelId)
+{
+	if (!FunnelDefinitions.IsValidIndex(FunnelId))
+	{
+		UE_LOG(LogDeskillz, Warning, TEXT("Unknown funnel ID: %d"), FunnelId);
+		return FDeskillzFunnelHandle();
+	}
+	
+	FFunnelDefinition& Definition = FunnelDefinitions[FunnelId];
+	Definition.ActiveCount++;
+	
+	FActiveFunnel Funnel;
+	Funnel.FunnelId = FunnelId;
+	Funnel.StartCycles = FPlatformTime::Cycles64();
+	Funnel.LastStepCycles = Funnel.StartCycles;
+	
+	// Track funnel start
+	if (Analytics && Analytics->IsEnabled())
+	{
+		FDeskillzAnalyticsEvent Event(TEXT("funnel_started"), EDeskillzEventCategory::User);
+		Event.AddParam(TEXT("funnel"), Definition.FunnelName);
+		Event.AddValue(TEXT("total_steps"), static_cast<double>(Definition.Steps.Num()));
+		
+		Analytics->TrackEvent(Event);
+	}
+	
+	UE_LOG(LogDeskillz, Verbose, TEXT("Started funnel: %s with %d steps"), *Definition.FunnelName, Definition.Steps.Num());
+	
+	return ActiveFunnels.Add(MoveTemp(Funnel));
+}
+
+void UDeskillzEventTracker::AdvanceFunnel(FDeskillzFunnelHandle Handle, int32 StepIndex, const TMap<FString, FString>& Data)
+{
+	FActiveFunnel* Funnel = ActiveFunnels.Find(Handle);
+	if (!Funnel)
+	{
+		UE_LOG(LogDeskillz, Warning, TEXT("Funnel handle is not active"));
+		return;
+	}
+	
+	const FFunnelDefinition& Definition = FunnelDefinitions[Funnel->FunnelId];
+	if (!Definition.Steps.IsValidIndex(StepIndex))
+	{
+		UE_LOG(LogDeskillz, Warning, TEXT("Unknown step %d in funnel '%s'"), StepIndex, *Definition.FunnelName);
+		return;
+	}
+	
+	// Calculate time from previous step (or funnel start)
+	const uint64 CurrentCycles = FPlatformTime::Cycles64();
+	const float TimeFromPrevious = CyclesToSeconds(Funnel->LastStepCycles, CurrentCycles);
+	
+	Funnel->LastStepCycles = CurrentCycles;
+	Funnel->LastStepIndex = StepIndex;
+	Funnel->StepsCompleted++;
 	
 	// Track step completion
 	if (Analytics && Analytics->IsEnabled())
 	{
 		FDeskillzAnalyticsEvent Event(TEXT("funnel_step"), EDeskillzEventCategory::User);
-		Event.AddParam(TEXT("funnel"), FunnelName);
-		Event.AddParam(TEXT("step"), StepName);
+		Event.AddParam(TEXT("funnel"), Definition.FunnelName);
+		Event.AddParam(TEXT("step"), Definition.Steps[StepIndex]);
 		Event.AddValue(TEXT("step_index"), static_cast<double>(StepIndex));
 		Event.AddValue(TEXT("time_from_previous"), TimeFromPrevious);
-		Event.AddValue(TEXT("progress"), GetFunnelProgress(FunnelName));
+		Event.AddValue(TEXT("progress"), GetFunnelCompletion(Handle));
 		
 		for (const auto& Pair : Data)
 		{
@@ -195,76 +324,66 @@ void UDeskillzEventTracker::RecordFunnelStep(const FString& FunnelName, const FS
 	}
 	
 	// Check if funnel is complete
-	if (Funnel->CompletedSteps.Num() == Funnel->ExpectedSteps.Num())
+	if (Funnel->StepsCompleted == Definition.Steps.Num())
 	{
-		Funnel->bIsCompleted = true;
-		
-		float TotalTime = static_cast<float>(CurrentTime - Funnel->StartTime) / 1000.0f;
+		float TotalTime = CyclesToSeconds(Funnel->StartCycles, CurrentCycles);
 		
 		if (Analytics && Analytics->IsEnabled())
 		{
 			FDeskillzAnalyticsEvent Event(TEXT("funnel_completed"), EDeskillzEventCategory::User);
-			Event.AddParam(TEXT("funnel"), FunnelName);
+			Event.AddParam(TEXT("funnel"), Definition.FunnelName);
 			Event.AddValue(TEXT("total_time"), TotalTime);
-			Event.AddValue(TEXT("steps_completed"), static_cast<double>(Funnel->CompletedSteps.Num()));
+			Event.AddValue(TEXT("steps_completed"), static_cast<double>(Funnel->StepsCompleted));
 			
 			Analytics->TrackEvent(Event);
 		}
 		
-		UE_LOG(LogDeskillz, Log, TEXT("Funnel completed: %s (%.2fs)"), *FunnelName, TotalTime);
-		ActiveFunnels.Remove(FunnelName);
+		UE_LOG(LogDeskillz, Log, TEXT("Funnel completed: %s (%.2fs)"), *Definition.FunnelName, TotalTime);
+		FunnelDefinitions[Funnel->FunnelId].ActiveCount--;
+		ActiveFunnels.Remove(Handle);
 	}
 	
 	SessionEventCount++;
 }
 
-void UDeskillzEventTracker::AbandonFunnel(const FString& FunnelName, const FString& Reason)
+void UDeskillzEventTracker::AbortFunnel(FDeskillzFunnelHandle Handle, const FString& Reason)
 {
-	FDeskillzFunnel* Funnel = ActiveFunnels.Find(FunnelName);
+	const FActiveFunnel* Funnel = ActiveFunnels.Find(Handle);
 	if (!Funnel)
 	{
 		return;
 	}
 	
-	Funnel->bIsAbandoned = true;
+	const FFunnelDefinition& Definition = FunnelDefinitions[Funnel->FunnelId];
 	
 	// Track abandonment
 	if (Analytics && Analytics->IsEnabled())
 	{
 		FDeskillzAnalyticsEvent Event(TEXT("funnel_abandoned"), EDeskillzEventCategory::User);
-		Event.AddParam(TEXT("funnel"), FunnelName);
+		Event.AddParam(TEXT("funnel"), Definition.FunnelName);
 		Event.AddParam(TEXT("reason"), Reason);
-		Event.AddParam(TEXT("last_step"), GetCurrentFunnelStep(FunnelName));
-		Event.AddValue(TEXT("progress"), GetFunnelProgress(FunnelName));
-		Event.AddValue(TEXT("steps_completed"), static_cast<double>(Funnel->CompletedSteps.Num()));
+		Event.AddParam(TEXT("last_step"), Funnel->LastStepIndex != INDEX_NONE ? Definition.Steps[Funnel->LastStepIndex] : FString());
+		Event.AddValue(TEXT("progress"), GetFunnelCompletion(Handle));
+		Event.AddValue(TEXT("steps_completed"), static_cast<double>(Funnel->StepsCompleted));
 		
 		Analytics->TrackEvent(Event);
 	}
 	
-	UE_LOG(LogDeskillz, Log, TEXT("Funnel abandoned: %s (reason: %s)"), *FunnelName, *Reason);
-	ActiveFunnels.Remove(FunnelName);
+	UE_LOG(LogDeskillz, Log, TEXT("Funnel abandoned: %s (reason: %s)"), *Definition.FunnelName, *Reason);
+	FunnelDefinitions[Funnel->FunnelId].ActiveCount--;
+	ActiveFunnels.Remove(Handle);
 }
 
-float UDeskillzEventTracker::GetFunnelProgress(const FString& FunnelName) const
+float UDeskillzEventTracker::GetFunnelCompletion(FDeskillzFunnelHandle Handle) const
 {
-	const FDeskillzFunnel* Funnel = ActiveFunnels.Find(FunnelName);
-	if (!Funnel || Funnel->ExpectedSteps.Num() == 0)
+	const FActiveFunnel* Funnel = ActiveFunnels.Find(Handle);
+	if (!Funnel)
 	{
 		return 0.0f;
 	}
 	
-	return static_cast<float>(Funnel->CompletedSteps.Num()) / static_cast<float>(Funnel->ExpectedSteps.Num());
-}
-
-FString UDeskillzEventTracker::GetCurrentFunnelStep(const FString& FunnelName) const
-{
-	const FDeskillzFunnel* Funnel = ActiveFunnels.Find(FunnelName);
-	if (!Funnel || Funnel->CompletedSteps.Num() == 0)
-	{
-		return TEXT("");
-	}
-	
-	return Funnel->CompletedSteps.Last().StepName;
+	const int32 TotalSteps = FunnelDefinitions[Funnel->FunnelId].Steps.Num();
+	return TotalSteps > 0 ? static_cast<float>(Funnel->StepsCompleted) / static_cast<float>(TotalSteps) : 0.0f;
 }
 
 // ============================================================================
@@ -525,8 +644,14 @@ void UDeskillzEventTracker::ClearSessionData()
 {
 	SessionRevenue = 0.0;
 	SessionEventCount = 0;
-	ActiveTimedEvents.Empty();
-	ActiveFunnels.Empty();
+	ActiveTimedEvents.Reset();
+	NamedTimedEvents.Empty();
+	ActiveFunnels.Reset();
+	NamedFunnels.Empty();
+	for (FFunnelDefinition& Definition : FunnelDefinitions)
+	{
+		Definition.ActiveCount = 0;
+	}
 	Counters.Empty();
 }
 
@@ -534,3 +659,8 @@ int64 UDeskillzEventTracker::GetCurrentTimestamp() const
 {
 	return FDateTime::UtcNow().ToUnixTimestamp() * 1000;
 }
+
+float UDeskillzEventTracker::CyclesToSeconds(uint64 StartCycles, uint64 EndCycles)
+{
+	return static_cast<float>(FPlatformTime::ToSeconds64(EndCycles - StartCycles));
+}
@@ -3,6 +3,7 @@
 #include "Analytics/DeskillzTelemetry.h"
 #include "Analytics/DeskillzAnalytics.h"
 #include "Network/DeskillzHttpClient.h"
+#include "Core/DeskillzMemoryManager.h"
 #include "Deskillz.h"
 #include "HAL/PlatformMemory.h"
 #include "Serialization/JsonSerializer.h"
@@ -14,10 +15,129 @@
 // Static singleton
 static UDeskillzTelemetry* GTelemetry = nullptr;
 
+// SDK activity accumulated on the game thread since the last telemetry tick
+static uint64 GActivityCycles[static_cast<int32>(EDeskillzSdkActivity::MAX)] = {};
+static uint32 GActivityMask = 0;
+
+// Innermost open activity scope on the game thread
+static FDeskillzScopedActivity* GActivityScope = nullptr;
+
+// Frames needed before the median is trusted for hitch detection
+static constexpr int32 MinFramesForHitchDetection = 60;
+
+// Frames between median refreshes
+static constexpr int32 MedianRefreshInterval = 30;
+
+static const TCHAR* GetActivityName(EDeskillzSdkActivity Activity)
+{
+	switch (Activity)
+	{
+		case EDeskillzSdkActivity::HttpCompletion: return TEXT("http_completion");
+		case EDeskillzSdkActivity::JsonParse: return TEXT("json_parse");
+		case EDeskillzSdkActivity::WidgetPopulate: return TEXT("widget_populate");
+		case EDeskillzSdkActivity::AnalyticsFlush: return TEXT("analytics_flush");
+		default: return TEXT("none");
+	}
+}
+
+static void ResetActivityAccumulators()
+{
+	FMemory::Memzero(GActivityCycles, sizeof(GActivityCycles));
+	GActivityMask = 0;
+}
+
+// ============================================================================
+// FDeskillzScopedActivity
+// ============================================================================
+
+FDeskillzScopedActivity::FDeskillzScopedActivity(EDeskillzSdkActivity InActivity)
+	: Activity(InActivity)
+	, StartCycles(IsInGameThread() ? FPlatformTime::Cycles64() : 0)
+{
+	if (StartCycles != 0)
+	{
+		Parent = GActivityScope;
+		GActivityScope = this;
+	}
+}
+
+FDeskillzScopedActivity::~FDeskillzScopedActivity()
+{
+	if (StartCycles == 0)
+	{
+		return;
+	}
+	
+	const uint64 ElapsedCycles = FPlatformTime::Cycles64() - StartCycles;
+	
+	const int32 Index = static_cast<int32>(Activity);
+	GActivityCycles[Index] += ElapsedCycles - FMath::Min(ChildCycles, ElapsedCycles);
+	GActivityMask |= 1u << Index;
+	
+	// Hand the inclusive time to the enclosing scope so it is not counted twice
+	if (Parent)
+	{
+		Parent->ChildCycles += ElapsedCycles;
+	}
+	GActivityScope = Parent;
+}
+
+// ============================================================================
+// FDeskillzFrameTimeHistogram
+// ============================================================================
+
+void FDeskillzFrameTimeHistogram::Add(float FrameTimeMs)
+{
+	int32 Bucket = 0;
+	if (FrameTimeMs > 0.0f)
+	{
+		Bucket = FMath::FloorToInt((FMath::Log2(FrameTimeMs) - MinOctave) * BucketsPerOctave);
+	}
+	
+	BucketCounts[FMath::Clamp(Bucket, 0, NumBuckets - 1)]++;
+	TotalCount++;
+}
+
+void FDeskillzFrameTimeHistogram::Reset()
+{
+	FMemory::Memzero(BucketCounts, sizeof(BucketCounts));
+	TotalCount = 0;
+}
+
+float FDeskillzFrameTimeHistogram::GetPercentile(float Percentile) const
+{
+	if (TotalCount == 0)
+	{
+		return 0.0f;
+	}
+	
+	const int32 Target = FMath::Max(1, FMath::CeilToInt(Percentile * TotalCount));
+	int32 Cumulative = 0;
+	
+	for (int32 Bucket = 0; Bucket < NumBuckets; Bucket++)
+	{
+		Cumulative += BucketCounts[Bucket];
+		if (Cumulative >= Target)
+		{
+			// Geometric midpoint of the bucket
+			return FMath::Pow(2.0f, (Bucket + 0.5f) / BucketsPerOctave + MinOctave);
+		}
+	}
+	
+	return GetBucketLowerBoundMs(NumBuckets - 1);
+}
+
+float FDeskillzFrameTimeHistogram::GetBucketLowerBoundMs(int32 Bucket)
+{
+	return FMath::Pow(2.0f, static_cast<float>(Bucket) / BucketsPerOctave + MinOctave);
+}
+
 UDeskillzTelemetry::UDeskillzTelemetry()
 {
-	FrameTimeHistory.Reserve(120); // 2 seconds at 60 FPS
-	LatencyHistory.Reserve(60);
+	FrameTimeHistory.SetCapacity(120); // 2 seconds at 60 FPS
+	LatencyHistory.SetCapacity(60);
+	LatencyDeltaHistory.SetCapacity(59);
+	SampleWindowCapacity = TelemetryConfig.MaxSamples;
 }
 
 UDeskillzTelemetry::~UDeskillzTelemetry()
@@ -42,6 +162,7 @@ UDeskillzTelemetry* UDeskillzTelemetry::Get()
 void UDeskillzTelemetry::Initialize(const FDeskillzTelemetryConfig& Config)
 {
 	TelemetryConfig = Config;
+	SampleWindowCapacity = Config.MaxSamples;
 	
 	UE_LOG(LogDeskillz, Log, TEXT("Telemetry initialized - Sample interval: %.1fs"), Config.SampleInterval);
 }
@@ -67,6 +188,9 @@ void UDeskillzTelemetry::StartMonitoring()
 	TimeSinceLastSample = 0.0f;
 	TimeSinceLastReport = 0.0f;
 	
+	// Discard activity recorded while not monitoring
+	ResetActivityAccumulators();
+	
 	UE_LOG(LogDeskillz, Log, TEXT("Telemetry monitoring started"));
 }
 
@@ -91,6 +215,7 @@ void UDeskillzTelemetry::SetMatchContext(const FString& MatchId)
 	
 	// Clear samples for fresh match metrics
 	ClearSamples();
+	ResetHitchTracking();
 	
 	UE_LOG(LogDeskillz, Verbose, TEXT("Telemetry match context: %s"), *MatchId);
 }
@@ -101,9 +226,11 @@ void UDeskillzTelemetry::ClearMatchContext()
 	if (!CurrentMatchId.IsEmpty())
 	{
 		GenerateReport();
+		ReportMatchHitches();
 	}
 	
 	CurrentMatchId.Empty();
+	ResetHitchTracking();
 }
 
 // ============================================================================
@@ -112,6 +239,8 @@ void UDeskillzTelemetry::ClearMatchContext()
 
 void UDeskillzTelemetry::Tick(float DeltaTime)
 {
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzTelemetryTick, DeskillzAnalyticsChannel);
+	
 	if (!bIsMonitoring)
 	{
 		return;
@@ -120,6 +249,16 @@ void UDeskillzTelemetry::Tick(float DeltaTime)
 	// Sample FPS every frame
 	SampleFPS(DeltaTime);
 	
+	// Hitch detection needs every frame, not just sampled ones
+	if (TelemetryConfig.bTrackHitches)
+	{
+		DetectHitch(DeltaTime);
+	}
+	else
+	{
+		ResetActivityAccumulators();
+	}
+	
 	// Periodic sampling
 	TimeSinceLastSample += DeltaTime;
 	if (TimeSinceLastSample >= TelemetryConfig.SampleInterval)
@@ -151,14 +290,7 @@ void UDeskillzTelemetry::RecordMetric(const FString& Name, float Value)
 
 void UDeskillzTelemetry::RecordMetric(EDeskillzMetricType Type, const FString& Name, float Value)
 {
-	FDeskillzPerformanceSample Sample;
-	Sample.Type = Type;
-	Sample.Name = Name;
-	Sample.Value = Value;
-	Sample.Timestamp = FDateTime::UtcNow().ToUnixTimestamp() * 1000;
-	Sample.Context = CurrentMatchId;
-	
-	AddSample(Name, Sample);
+	AddSample(Type, Name, Value, FDateTime::UtcNow().ToUnixTimestamp() * 1000);
 }
 
 void UDeskillzTelemetry::RecordLatency(float LatencyMs)
@@ -166,21 +298,16 @@ void UDeskillzTelemetry::RecordLatency(float LatencyMs)
 	NetworkMetrics.Latency = LatencyMs;
 	
 	// Add to history for jitter calculation
-	LatencyHistory.Add(LatencyMs);
-	if (LatencyHistory.Num() > 60)
+	if (!LatencyHistory.IsEmpty())
 	{
-		LatencyHistory.RemoveAt(0);
+		LatencyDeltaHistory.Add(FMath::Abs(LatencyMs - LatencyHistory.GetLast()));
 	}
+	LatencyHistory.Add(LatencyMs);
 	
-	// Calculate jitter (variation in latency)
-	if (LatencyHistory.Num() > 1)
+	// Jitter is the mean variation between consecutive samples
+	if (!LatencyDeltaHistory.IsEmpty())
 	{
-		float SumDiff = 0.0f;
-		for (int32 i = 1; i < LatencyHistory.Num(); i++)
-		{
-			SumDiff += FMath::Abs(LatencyHistory[i] - LatencyHistory[i - 1]);
-		}
-		NetworkMetrics.Jitter = SumDiff / (LatencyHistory.Num() - 1);
+		NetworkMetrics.Jitter = static_cast<float>(LatencyDeltaHistory.GetMean());
 	}
 	
 	RecordMetric(EDeskillzMetricType::Latency, TEXT("latency"), LatencyMs);
@@ -200,9 +327,9 @@ void UDeskillzTelemetry::UpdateNetworkMetrics(const FDeskillzNetworkMetrics& Met
 
 FDeskillzPerformanceStats UDeskillzTelemetry::GetStats(const FString& MetricName) const
 {
-	if (const TArray<FDeskillzPerformanceSample>* SampleArray = Samples.Find(MetricName))
+	if (const FDeskillzMetricWindow* Window = Samples.Find(MetricName))
 	{
-		return CalculateStats(*SampleArray);
+		return CalculateStats(MetricName, *Window);
 	}
 	
 	return FDeskillzPerformanceStats();
@@ -214,12 +341,25 @@ TMap<FString, FDeskillzPerformanceStats> UDeskillzTelemetry::GetAllStats() const
 	
 	for (const auto& Pair : Samples)
 	{
-		AllStats.Add(Pair.Key, CalculateStats(Pair.Value));
+		AllStats.Add(Pair.Key, CalculateStats(Pair.Key, Pair.Value));
 	}
 	
 	return AllStats;
 }
 
+FDeskillzMatchHitchReport UDeskillzTelemetry::GetMatchHitchReport() const
+{
+	FDeskillzMatchHitchReport Report = MatchHitchReport;
+	Report.MedianFrameTimeMs = FrameHistogram.GetPercentile(0.5f);
+	Report.P99FrameTimeMs = FrameHistogram.GetPercentile(0.99f);
+	return Report;
+}
+
+TArray<int32> UDeskillzTelemetry::GetFrameTimeHistogram() const
+{
+	return TArray<int32>(FrameHistogram.GetBucketCounts(), FDeskillzFrameTimeHistogram::NumBuckets);
+}
+
 float UDeskillzTelemetry::GetMemoryUsageMB() const
 {
 	FPlatformMemoryStats MemStats = FPlatformMemory::GetStats();
@@ -281,11 +421,54 @@ void UDeskillzTelemetry::GenerateReport()
 	}
 }
 
+int64 UDeskillzTelemetry::GetSampleMemoryBytes() const
+{
+	int64 Bytes = Samples.GetAllocatedSize();
+	for (const auto& Pair : Samples)
+	{
+		Bytes += Pair.Key.GetAllocatedSize() + Pair.Value.GetAllocatedBytes();
+	}
+	return Bytes;
+}
+
+void UDeskillzTelemetry::TrimSamples(int64 MaxBytes)
+{
+	const int64 Bytes = GetSampleMemoryBytes();
+	if (Bytes <= MaxBytes || Samples.Num() == 0)
+	{
+		return;
+	}
+	
+	int64 WindowBytes = 0;
+	for (const auto& Pair : Samples)
+	{
+		WindowBytes += Pair.Value.GetAllocatedBytes();
+	}
+	
+	// Split what's left after map/key overhead evenly, keeping a usable minimum for percentiles
+	const int64 PerWindowBytes = FMath::Max<int64>(MaxBytes - (Bytes - WindowBytes), 0) / Samples.Num();
+	const int32 NewCapacity = FMath::Clamp(static_cast<int32>(PerWindowBytes / FDeskillzMetricWindow::BytesPerSample), 16, SampleWindowCapacity);
+	
+	if (NewCapacity == SampleWindowCapacity)
+	{
+		return;
+	}
+	
+	SampleWindowCapacity = NewCapacity;
+	for (auto& Pair : Samples)
+	{
+		Pair.Value.SetCapacity(FMath::Min(Pair.Value.Samples.Capacity(), SampleWindowCapacity));
+	}
+	
+	UE_LOG(LogDeskillz, Warning, TEXT("Telemetry sample windows trimmed to %d samples"), SampleWindowCapacity);
+}
+
 void UDeskillzTelemetry::ClearSamples()
 {
 	Samples.Empty();
-	FrameTimeHistory.Empty();
-	LatencyHistory.Empty();
+	FrameTimeHistory.Reset();
+	LatencyHistory.Reset();
+	LatencyDeltaHistory.Reset();
 }
 
 // ============================================================================
@@ -312,23 +495,137 @@ void UDeskillzTelemetry::SampleFPS(float DeltaTime)
 {
 	// Track frame times
 	FrameTimeHistory.Add(DeltaTime);
-	if (FrameTimeHistory.Num() > 120)
+	
+	// Calculate average FPS from recent frames
+	if (!FrameTimeHistory.IsEmpty())
 	{
-		FrameTimeHistory.RemoveAt(0);
+		float AverageFrameTime = static_cast<float>(FrameTimeHistory.GetMean());
+		CurrentFrameTime = AverageFrameTime * 1000.0f; // Convert to ms
+		CurrentFPS = AverageFrameTime > 0.0f ? 1.0f / AverageFrameTime : 0.0f;
 	}
+}
+
+void UDeskillzTelemetry::DetectHitch(float DeltaTime)
+{
+	const float FrameTimeMs = DeltaTime * 1000.0f;
 	
-	// Calculate average FPS from recent frames
-	if (FrameTimeHistory.Num() > 0)
+	FrameHistogram.Add(FrameTimeMs);
+	MatchHitchReport.FrameCount++;
+	MatchHitchReport.WorstFrameTimeMs = FMath::Max(MatchHitchReport.WorstFrameTimeMs, FrameTimeMs);
+	
+	// Consume SDK activity recorded during this frame
+	float SdkTimeMs = 0.0f;
+	float PrimaryTimeMs = 0.0f;
+	EDeskillzSdkActivity PrimaryActivity = EDeskillzSdkActivity::None;
+	const uint32 ActivityMask = GActivityMask;
+	
+	if (ActivityMask != 0)
+	{
+		for (int32 Index = 1; Index < static_cast<int32>(EDeskillzSdkActivity::MAX); Index++)
+		{
+			const float ActivityMs = static_cast<float>(FPlatformTime::ToMilliseconds64(GActivityCycles[Index]));
+			SdkTimeMs += ActivityMs;
+			if (ActivityMs > PrimaryTimeMs)
+			{
+				PrimaryTimeMs = ActivityMs;
+				PrimaryActivity = static_cast<EDeskillzSdkActivity>(Index);
+			}
+		}
+		MatchHitchReport.TotalSdkTimeMs += SdkTimeMs;
+		ResetActivityAccumulators();
+	}
+	
+	// The median only moves slowly, so don't walk the histogram every frame
+	if (++FramesSinceMedianUpdate >= MedianRefreshInterval)
+	{
+		MedianFrameTimeMs = FrameHistogram.GetPercentile(0.5f);
+		FramesSinceMedianUpdate = 0;
+	}
+	
+	if (FrameHistogram.GetTotalCount() < MinFramesForHitchDetection || MedianFrameTimeMs <= 0.0f)
+	{
+		return;
+	}
+	
+	const float HitchThresholdMs = FMath::Max(MedianFrameTimeMs * TelemetryConfig.HitchMedianMultiplier,
+		TelemetryConfig.MinHitchFrameTimeMs);
+	if (FrameTimeMs < HitchThresholdMs)
+	{
+		return;
+	}
+	
+	FDeskillzHitchRecord Hitch;
+	Hitch.Timestamp = FDateTime::UtcNow().ToUnixTimestamp() * 1000;
+	Hitch.FrameTimeMs = FrameTimeMs;
+	Hitch.MedianFrameTimeMs = MedianFrameTimeMs;
+	Hitch.SdkTimeMs = SdkTimeMs;
+	Hitch.PrimaryActivity = PrimaryActivity;
+	Hitch.ActivityMask = static_cast<int32>(ActivityMask);
+	
+	// Blame the SDK only if its work covers a meaningful part of the excess frame time
+	const float ExcessMs = FrameTimeMs - MedianFrameTimeMs;
+	Hitch.bSdkAttributed = SdkTimeMs > 0.0f && SdkTimeMs >= ExcessMs * TelemetryConfig.HitchAttributionFraction;
+	
+	MatchHitchReport.HitchCount++;
+	if (Hitch.bSdkAttributed)
 	{
-		float TotalTime = 0.0f;
-		for (float FrameTime : FrameTimeHistory)
+		MatchHitchReport.SdkHitchCount++;
+		MatchHitchReport.HitchesByActivity.FindOrAdd(PrimaryActivity)++;
+	}
+	
+	if (MatchHitchReport.Hitches.Num() < TelemetryConfig.MaxHitchRecords)
+	{
+		MatchHitchReport.Hitches.Add(Hitch);
+	}
+	
+	UE_LOG(LogDeskillz, Verbose, TEXT("Hitch: %.1fms (median %.1fms), SDK %.2fms [%s]"),
+		FrameTimeMs, MedianFrameTimeMs, SdkTimeMs, GetActivityName(PrimaryActivity));
+	
+	OnHitchDetected.Broadcast(Hitch);
+}
+
+void UDeskillzTelemetry::ResetHitchTracking()
+{
+	FrameHistogram.Reset();
+	MatchHitchReport = FDeskillzMatchHitchReport();
+	MatchHitchReport.MatchId = CurrentMatchId;
+	MedianFrameTimeMs = 0.0f;
+	FramesSinceMedianUpdate = 0;
+	ResetActivityAccumulators();
+}
+
+void UDeskillzTelemetry::ReportMatchHitches()
+{
+	if (MatchHitchReport.FrameCount == 0)
+	{
+		return;
+	}
+	
+	FDeskillzMatchHitchReport Report = GetMatchHitchReport();
+	
+	UE_LOG(LogDeskillz, Log, TEXT("Match %s frame report - median=%.1fms p99=%.1fms worst=%.1fms hitches=%d (sdk=%d) sdk_time=%.1fms"),
+		*Report.MatchId, Report.MedianFrameTimeMs, Report.P99FrameTimeMs, Report.WorstFrameTimeMs,
+		Report.HitchCount, Report.SdkHitchCount, Report.TotalSdkTimeMs);
+	
+	UDeskillzAnalytics* Analytics = UDeskillzAnalytics::Get();
+	if (Analytics->IsEnabled())
+	{
+		FDeskillzAnalyticsEvent Event(TEXT("match_hitch_report"), EDeskillzEventCategory::System);
+		Event.AddParam(TEXT("match_id"), Report.MatchId);
+		Event.AddValue(TEXT("frames"), static_cast<double>(Report.FrameCount));
+		Event.AddValue(TEXT("frame_median_ms"), Report.MedianFrameTimeMs);
+		Event.AddValue(TEXT("frame_p99_ms"), Report.P99FrameTimeMs);
+		Event.AddValue(TEXT("frame_worst_ms"), Report.WorstFrameTimeMs);
+		Event.AddValue(TEXT("hitches"), static_cast<double>(Report.HitchCount));
+		Event.AddValue(TEXT("sdk_hitches"), static_cast<double>(Report.SdkHitchCount));
+		Event.AddValue(TEXT("sdk_time_ms"), Report.TotalSdkTimeMs);
+		
+		for (const auto& Pair : Report.HitchesByActivity)
 		{
-			TotalTime += FrameTime;
+			Event.AddValue(FString::Printf(TEXT("sdk_hitches_%s"), GetActivityName(Pair.Key)), static_cast<double>(Pair.Value));
 		}
 		
-		float AverageFrameTime = TotalTime / FrameTimeHistory.Num();
-		CurrentFrameTime = AverageFrameTime * 1000.0f; // Convert to ms
-		CurrentFPS = AverageFrameTime > 0.0f ? 1.0f / AverageFrameTime : 0.0f;
+		Analytics->TrackEvent(Event);
 	}
 }
 
@@ -336,6 +633,11 @@ void UDeskillzTelemetry::SampleMemory()
 {
 	float MemoryMB = GetMemoryUsageMB();
 	RecordMetric(EDeskillzMetricType::Memory, TEXT("memory_mb"), MemoryMB);
+	
+	// SDK-held memory per subsystem, trimmed to budget
+	UDeskillzMemoryManager* MemoryManager = UDeskillzMemoryManager::Get();
+	MemoryManager->EnforceBudgets();
+	RecordMetric(EDeskillzMetricType::Memory, TEXT("sdk_memory_kb"), MemoryManager->GetTotalMemoryBytes() / 1024.0f);
 }
 
 void UDeskillzTelemetry::CheckWarnings()
@@ -357,36 +659,28 @@ void UDeskillzTelemetry::CheckWarnings()
 	}
 }
 
-FDeskillzPerformanceStats UDeskillzTelemetry::CalculateStats(const TArray<FDeskillzPerformanceSample>& SampleArray) const
+FDeskillzPerformanceStats UDeskillzTelemetry::CalculateStats(const FString& Name, const FDeskillzMetricWindow& Window) const
 {
 	FDeskillzPerformanceStats Stats;
 	
-	if (SampleArray.Num() == 0)
+	if (Window.Samples.IsEmpty())
 	{
 		return Stats;
 	}
 	
-	Stats.Name = SampleArray[0].Name;
-	Stats.SampleCount = SampleArray.Num();
-	
-	// Extract values
-	TArray<float> Values;
-	Values.Reserve(SampleArray.Num());
+	Stats.Name = Name;
+	Stats.SampleCount = Window.Samples.Num();
 	
-	float Sum = 0.0f;
-	Stats.Min = SampleArray[0].Value;
-	Stats.Max = SampleArray[0].Value;
+	// Min/max/average/stddev come from running aggregates
+	Stats.Min = Window.Aggregates.GetMin();
+	Stats.Max = Window.Aggregates.GetMax();
+	Stats.Average = static_cast<float>(Window.Aggregates.GetMean());
+	Stats.StdDev = static_cast<float>(Window.Aggregates.GetStdDev());
 	
-	for (const FDeskillzPerformanceSample& Sample : SampleArray)
-	{
-		Values.Add(Sample.Value);
-		Sum += Sample.Value;
-		Stats.Min = FMath::Min(Stats.Min, Sample.Value);
-		Stats.Max = FMath::Max(Stats.Max, Sample.Value);
-	}
-	
-	// Average
-	Stats.Average = Sum / Values.Num();
+	// Extract values for order statistics
+	TArray<float> Values;
+	Values.Reserve(Window.Samples.Num());
+	Window.Samples.ForEach<0>([&Values](float Value) { Values.Add(Value); });
 	
 	// Sort for percentiles
 	Values.Sort();
@@ -406,15 +700,6 @@ FDeskillzPerformanceStats UDeskillzTelemetry::CalculateStats(const TArray<FDeski
 	Stats.P95 = CalculatePercentile(Values, 0.95f);
 	Stats.P99 = CalculatePercentile(Values, 0.99f);
 	
-	// Standard deviation
-	float SumSquaredDiff = 0.0f;
-	for (float Value : Values)
-	{
-		float Diff = Value - Stats.Average;
-		SumSquaredDiff += Diff * Diff;
-	}
-	Stats.StdDev = FMath::Sqrt(SumSquaredDiff / Values.Num());
-	
 	return Stats;
 }
 
@@ -472,17 +757,18 @@ void UDeskillzTelemetry::UpdateNetworkQuality()
 	}
 }
 
-void UDeskillzTelemetry::AddSample(const FString& Name, const FDeskillzPerformanceSample& Sample)
+void UDeskillzTelemetry::AddSample(EDeskillzMetricType Type, const FString& Name, float Value, int64 Timestamp)
 {
-	TArray<FDeskillzPerformanceSample>& SampleArray = Samples.FindOrAdd(Name);
+	LLM_SCOPE_BYTAG(Deskillz_Telemetry);
 	
-	// Enforce max samples
-	if (SampleArray.Num() >= TelemetryConfig.MaxSamples)
+	FDeskillzMetricWindow* Window = Samples.Find(Name);
+	if (!Window)
 	{
-		SampleArray.RemoveAt(0);
+		// Window size is fixed at MaxSamples (or the trimmed size), so the oldest sample is overwritten in place
+		Window = &Samples.Add(Name, FDeskillzMetricWindow(Type, SampleWindowCapacity));
 	}
 	
-	SampleArray.Add(Sample);
+	Window->Add(Value, Timestamp);
 }
 
 void UDeskillzTelemetry::SendReport(const TMap<FString, FDeskillzPerformanceStats>& Stats)
@@ -525,6 +811,43 @@ void UDeskillzTelemetry::SendReport(const TMap<FString, FDeskillzPerformanceStat
 	NetworkObj->SetNumberField(TEXT("bytes_received"), static_cast<double>(NetworkMetrics.BytesReceived));
 	Payload->SetObjectField(TEXT("network"), NetworkObj);
 	
+	// Add frame time / hitch summary
+	if (MatchHitchReport.FrameCount > 0)
+	{
+		FDeskillzMatchHitchReport HitchReport = GetMatchHitchReport();
+		TSharedPtr<FJsonObject> FramesObj = MakeShareable(new FJsonObject());
+		FramesObj->SetNumberField(TEXT("frames"), HitchReport.FrameCount);
+		FramesObj->SetNumberField(TEXT("median_ms"), HitchReport.MedianFrameTimeMs);
+		FramesObj->SetNumberField(TEXT("p99_ms"), HitchReport.P99FrameTimeMs);
+		FramesObj->SetNumberField(TEXT("worst_ms"), HitchReport.WorstFrameTimeMs);
+		FramesObj->SetNumberField(TEXT("hitches"), HitchReport.HitchCount);
+		FramesObj->SetNumberField(TEXT("sdk_hitches"), HitchReport.SdkHitchCount);
+		FramesObj->SetNumberField(TEXT("sdk_time_ms"), HitchReport.TotalSdkTimeMs);
+		
+		TArray<TSharedPtr<FJsonValue>> HistogramArray;
+		for (int32 Bucket = 0; Bucket < FDeskillzFrameTimeHistogram::NumBuckets; Bucket++)
+		{
+			HistogramArray.Add(MakeShareable(new FJsonValueNumber(FrameHistogram.GetBucketCounts()[Bucket])));
+		}
+		FramesObj->SetArrayField(TEXT("histogram"), HistogramArray);
+		
+		TArray<TSharedPtr<FJsonValue>> HitchArray;
+		for (const FDeskillzHitchRecord& Hitch : HitchReport.Hitches)
+		{
+			TSharedPtr<FJsonObject> HitchObj = MakeShareable(new FJsonObject());
+			HitchObj->SetNumberField(TEXT("timestamp"), static_cast<double>(Hitch.Timestamp));
+			HitchObj->SetNumberField(TEXT("frame_ms"), Hitch.FrameTimeMs);
+			HitchObj->SetNumberField(TEXT("sdk_ms"), Hitch.SdkTimeMs);
+			HitchObj->SetStringField(TEXT("activity"), GetActivityName(Hitch.PrimaryActivity));
+			HitchObj->SetNumberField(TEXT("activity_mask"), Hitch.ActivityMask);
+			HitchObj->SetBoolField(TEXT("sdk_attributed"), Hitch.bSdkAttributed);
+			HitchArray.Add(MakeShareable(new FJsonValueObject(HitchObj)));
+		}
+		FramesObj->SetArrayField(TEXT("hitch_list"), HitchArray);
+		
+		Payload->SetObjectField(TEXT("frames"), FramesObj);
+	}
+	
 	// Send to server
 	UDeskillzHttpClient* Http = UDeskillzHttpClient::Get();
 	Http->PostJson(TEXT("/api/v1/telemetry/report"), Payload,
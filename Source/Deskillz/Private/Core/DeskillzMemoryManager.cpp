@@ -0,0 +1,261 @@
+// Copyright Deskillz Games. All Rights Reserved.
+
+#include "Core/DeskillzMemoryManager.h"
+#include "Core/DeskillzConfig.h"
+#include "Core/DeskillzStats.h"
+#include "Network/DeskillzHttpClient.h"
+#include "Analytics/DeskillzAnalytics.h"
+#include "Analytics/DeskillzTelemetry.h"
+#include "Platform/DeskillzAppLifecycle.h"
+#include "Rooms/DeskillzRooms.h"
+#include "UI/DeskillzUIManager.h"
+#include "Deskillz.h"
+
+// Static singleton
+static UDeskillzMemoryManager* GMemoryManager = nullptr;
+
+// All budgeted subsystems
+static const EDeskillzMemorySubsystem GMemorySubsystems[] =
+{
+	EDeskillzMemorySubsystem::NetworkCache,
+	EDeskillzMemorySubsystem::AnalyticsQueue,
+	EDeskillzMemorySubsystem::Telemetry,
+	EDeskillzMemorySubsystem::RoomState,
+	EDeskillzMemorySubsystem::UIWidgets
+};
+
+UDeskillzMemoryManager::UDeskillzMemoryManager()
+{
+}
+
+UDeskillzMemoryManager* UDeskillzMemoryManager::Get()
+{
+	if (!GMemoryManager)
+	{
+		GMemoryManager = NewObject<UDeskillzMemoryManager>();
+		GMemoryManager->AddToRoot();
+	}
+	return GMemoryManager;
+}
+
+// ============================================================================
+// Initialization
+// ============================================================================
+
+void UDeskillzMemoryManager::Initialize()
+{
+	if (bIsInitialized)
+	{
+		return;
+	}
+
+	// Low memory warnings come through the lifecycle's platform delegates
+	UDeskillzAppLifecycle* Lifecycle = UDeskillzAppLifecycle::Get();
+	Lifecycle->Initialize();
+	Lifecycle->OnAppLowMemory.AddDynamic(this, &UDeskillzMemoryManager::HandleLowMemory);
+
+	bIsInitialized = true;
+
+	UE_LOG(LogDeskillz, Log, TEXT("Memory Manager initialized"));
+}
+
+void UDeskillzMemoryManager::Shutdown()
+{
+	if (!bIsInitialized)
+	{
+		return;
+	}
+
+	UDeskillzAppLifecycle::Get()->OnAppLowMemory.RemoveDynamic(this, &UDeskillzMemoryManager::HandleLowMemory);
+
+	bIsInitialized = false;
+
+	UE_LOG(LogDeskillz, Log, TEXT("Memory Manager shutdown"));
+}
+
+void UDeskillzMemoryManager::SetRoomsSubsystem(UDeskillzRooms* Rooms)
+{
+	RoomsSubsystem = Rooms;
+}
+
+// ============================================================================
+// Usage
+// ============================================================================
+
+FDeskillzMemoryUsage UDeskillzMemoryManager::GetMemoryUsage(EDeskillzMemorySubsystem Subsystem) const
+{
+	FDeskillzMemoryUsage Usage;
+	Usage.Subsystem = Subsystem;
+	Usage.UsedBytes = GetUsedBytes(Subsystem);
+	Usage.BudgetBytes = GetBudgetBytes(Subsystem);
+	return Usage;
+}
+
+TArray<FDeskillzMemoryUsage> UDeskillzMemoryManager::GetAllMemoryUsage() const
+{
+	TArray<FDeskillzMemoryUsage> Usage;
+	Usage.Reserve(UE_ARRAY_COUNT(GMemorySubsystems));
+
+	for (EDeskillzMemorySubsystem Subsystem : GMemorySubsystems)
+	{
+		Usage.Add(GetMemoryUsage(Subsystem));
+	}
+
+	return Usage;
+}
+
+int64 UDeskillzMemoryManager::GetTotalMemoryBytes() const
+{
+	int64 Total = 0;
+	for (EDeskillzMemorySubsystem Subsystem : GMemorySubsystems)
+	{
+		Total += GetUsedBytes(Subsystem);
+	}
+	return Total;
+}
+
+// ============================================================================
+// Budgets
+// ============================================================================
+
+void UDeskillzMemoryManager::EnforceBudgets()
+{
+	TArray<FDeskillzMemoryUsage> Usage = GetAllMemoryUsage();
+	UpdateMemoryStats(Usage);
+
+	UDeskillzConfig* Config = UDeskillzConfig::Get();
+	if (!Config || !Config->bEnforceMemoryBudgets)
+	{
+		return;
+	}
+
+	for (const FDeskillzMemoryUsage& Entry : Usage)
+	{
+		if (Entry.IsOverBudget())
+		{
+			UE_LOG(LogDeskillz, Warning, TEXT("Memory budget exceeded for subsystem %d: %lld / %lld bytes"),
+				static_cast<int32>(Entry.Subsystem), Entry.UsedBytes, Entry.BudgetBytes);
+
+			TrimSubsystem(Entry.Subsystem, Entry.BudgetBytes);
+		}
+	}
+}
+
+void UDeskillzMemoryManager::TrimMemory(float BudgetFraction)
+{
+	BudgetFraction = FMath::Clamp(BudgetFraction, 0.0f, 1.0f);
+
+	const int64 BytesBefore = GetTotalMemoryBytes();
+
+	for (EDeskillzMemorySubsystem Subsystem : GMemorySubsystems)
+	{
+		TrimSubsystem(Subsystem, static_cast<int64>(GetBudgetBytes(Subsystem) * BudgetFraction));
+	}
+
+	TArray<FDeskillzMemoryUsage> Usage = GetAllMemoryUsage();
+	UpdateMemoryStats(Usage);
+
+	UE_LOG(LogDeskillz, Log, TEXT("SDK memory trimmed: %lld -> %lld bytes"), BytesBefore, GetTotalMemoryBytes());
+}
+
+// ============================================================================
+// Internal Methods
+// ============================================================================
+
+void UDeskillzMemoryManager::HandleLowMemory()
+{
+	UDeskillzConfig* Config = UDeskillzConfig::Get();
+	TrimMemory(Config ? Config->LowMemoryTrimFraction : 0.0f);
+}
+
+int64 UDeskillzMemoryManager::GetBudgetBytes(EDeskillzMemorySubsystem Subsystem) const
+{
+	UDeskillzConfig* Config = UDeskillzConfig::Get();
+	if (!Config)
+	{
+		return 0;
+	}
+
+	int32 BudgetKB = 0;
+	switch (Subsystem)
+	{
+		case EDeskillzMemorySubsystem::NetworkCache: BudgetKB = Config->NetworkCacheBudgetKB; break;
+		case EDeskillzMemorySubsystem::AnalyticsQueue: BudgetKB = Config->AnalyticsQueueBudgetKB; break;
+		case EDeskillzMemorySubsystem::Telemetry: BudgetKB = Config->TelemetryBudgetKB; break;
+		case EDeskillzMemorySubsystem::RoomState: BudgetKB = Config->RoomStateBudgetKB; break;
+		case EDeskillzMemorySubsystem::UIWidgets: BudgetKB = Config->UIWidgetBudgetKB; break;
+	}
+
+	return static_cast<int64>(BudgetKB) * 1024;
+}
+
+int64 UDeskillzMemoryManager::GetUsedBytes(EDeskillzMemorySubsystem Subsystem) const
+{
+	switch (Subsystem)
+	{
+		case EDeskillzMemorySubsystem::NetworkCache:
+			return UDeskillzHttpClient::Get()->GetCacheMemoryBytes();
+
+		case EDeskillzMemorySubsystem::AnalyticsQueue:
+			return UDeskillzAnalytics::Get()->GetQueueMemoryBytes();
+
+		case EDeskillzMemorySubsystem::Telemetry:
+			return UDeskillzTelemetry::Get()->GetSampleMemoryBytes();
+
+		case EDeskillzMemorySubsystem::RoomState:
+			return RoomsSubsystem.IsValid() ? RoomsSubsystem->GetRoomStateMemoryBytes() : 0;
+
+		case EDeskillzMemorySubsystem::UIWidgets:
+			return UDeskillzUIManager::Get(nullptr)->GetWidgetMemoryBytes();
+	}
+
+	return 0;
+}
+
+void UDeskillzMemoryManager::TrimSubsystem(EDeskillzMemorySubsystem Subsystem, int64 MaxBytes)
+{
+	switch (Subsystem)
+	{
+		case EDeskillzMemorySubsystem::NetworkCache:
+			UDeskillzHttpClient::Get()->TrimCache(MaxBytes);
+			break;
+
+		case EDeskillzMemorySubsystem::AnalyticsQueue:
+			UDeskillzAnalytics::Get()->TrimQueue(MaxBytes);
+			break;
+
+		case EDeskillzMemorySubsystem::Telemetry:
+			UDeskillzTelemetry::Get()->TrimSamples(MaxBytes);
+			break;
+
+		case EDeskillzMemorySubsystem::RoomState:
+			if (RoomsSubsystem.IsValid())
+			{
+				RoomsSubsystem->TrimRoomState();
+			}
+			break;
+
+		case EDeskillzMemorySubsystem::UIWidgets:
+			// Widgets are all-or-nothing; release the hidden ones and let GC reclaim them
+			if (GetUsedBytes(Subsystem) > MaxBytes)
+			{
+				UDeskillzUIManager::Get(nullptr)->ReleaseHiddenWidgets();
+			}
+			break;
+	}
+}
+
+void UDeskillzMemoryManager::UpdateMemoryStats(const TArray<FDeskillzMemoryUsage>& Usage) const
+{
+	for (const FDeskillzMemoryUsage& Entry : Usage)
+	{
+		switch (Entry.Subsystem)
+		{
+			case EDeskillzMemorySubsystem::NetworkCache: SET_MEMORY_STAT(STAT_DeskillzMemoryNetworkCache, Entry.UsedBytes); break;
+			case EDeskillzMemorySubsystem::AnalyticsQueue: SET_MEMORY_STAT(STAT_DeskillzMemoryAnalyticsQueue, Entry.UsedBytes); break;
+			case EDeskillzMemorySubsystem::Telemetry: SET_MEMORY_STAT(STAT_DeskillzMemoryTelemetry, Entry.UsedBytes); break;
+			case EDeskillzMemorySubsystem::RoomState: SET_MEMORY_STAT(STAT_DeskillzMemoryRoomState, Entry.UsedBytes); break;
+			case EDeskillzMemorySubsystem::UIWidgets: SET_MEMORY_STAT(STAT_DeskillzMemoryUIWidgets, Entry.UsedBytes); break;
+		}
+	}
+}
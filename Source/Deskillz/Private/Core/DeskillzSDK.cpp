@@ -18,6 +18,10 @@
 #include "Engine/World.h"
 // NEW: Include lobby deep link handler
 #include "Lobby/DeskillzDeepLinkHandler.h"
+#include "Core/DeskillzMemoryManager.h"
+#include "Security/DeskillzSecureSubmitter.h"
+#include "Security/DeskillzScoreRules.h"
+#include "Network/DeskillzApiService.h"
 
 #define SDK_VERSION TEXT("2.0.0")  // Updated for centralized lobby
 
@@ -155,6 +159,12 @@ void UDeskillzSDK::InitializeWithCredentials(const FString& InAPIKey, const FStr
 		UE_LOG(LogDeskillz, Log, TEXT("Lobby Deep Link Handler initialized"));
 	}
 	
+	// Initialize memory budgets
+	UDeskillzMemoryManager::Get()->Initialize();
+	
+	// Restore score submissions persisted by a previous session
+	UDeskillzSecureSubmitter::Get(this)->Initialize(this);
+	
 	// Validate credentials with server
 	TSharedPtr<FJsonObject> RequestBody = MakeShareable(new FJsonObject());
 	RequestBody->SetStringField(TEXT("gameId"), GameId);
@@ -185,6 +195,19 @@ void UDeskillzSDK::InitializeWithCredentials(const FString& InAPIKey, const FStr
 				ConnectWebSocket();
 			}
 			
+			// Resend scores that didn't reach the server last session
+			UDeskillzSecureSubmitter::Get(this)->RetryQueuedSubmissions();
+			
+			// Score rules for this game (config defaults stay active until they arrive)
+			UDeskillzApiService::Get()->GetGameConfig(GameId,
+				[](bool bSuccess, TSharedPtr<FJsonObject> GameConfig)
+				{
+					if (bSuccess)
+					{
+						FDeskillzScoreValidator::ApplyGameConfig(GameConfig);
+					}
+				});
+			
 			// Process pending deep link after initialization
 			UDeskillzDeepLinkHandler* DeepLinkHandler = UDeskillzDeepLinkHandler::Get();
 			if (DeepLinkHandler && DeepLinkHandler->HasPendingLaunch())
@@ -222,6 +245,8 @@ void UDeskillzSDK::Shutdown()
 	{
 		DeepLinkHandler->Shutdown();
 	}
+	
+	UDeskillzMemoryManager::Get()->Shutdown();
 
 	// Reset state
 	SDKState = EDeskillzSDKState::Uninitialized;
@@ -458,6 +483,8 @@ void UDeskillzSDK::StartMatch()
 	MatchStartTime = FDateTime::UtcNow();
 	CurrentScore = 0;
 	
+	FDeskillzScoreValidator::SelectTournament(CurrentMatch.TournamentId);
+	
 	// Notify server that match started
 	TSharedPtr<FJsonObject> RequestBody = MakeShareable(new FJsonObject());
 	RequestBody->SetStringField(TEXT("matchId"), CurrentMatch.MatchId);
@@ -469,14 +496,8 @@ void UDeskillzSDK::StartMatch()
 
 void UDeskillzSDK::UpdateScore(int64 Score)
 {
-	CurrentScore = Score;
-	
 	// Validate score range
-	const UDeskillzConfig* Config = UDeskillzConfig::Get();
-	if (Config)
-	{
-		CurrentScore = FMath::Clamp(CurrentScore, Config->MinScore, Config->MaxScore);
-	}
+	CurrentScore = FDeskillzScoreValidator::GetActive().ClampScore(Score);
 	
 	// For synchronous matches, send score updates via WebSocket
 	if (CurrentMatch.IsSynchronous() && WebSocket.IsValid() && WebSocket->IsConnected())
@@ -507,16 +528,13 @@ void UDeskillzSDK::SubmitScore(int64 FinalScore, bool bForceSubmit)
 	}
 	
 	// Validate score
-	const UDeskillzConfig* Config = UDeskillzConfig::Get();
-	if (Config && !bForceSubmit)
+	const FDeskillzScoreValidator& ScoreRules = FDeskillzScoreValidator::GetActive();
+	if (!bForceSubmit && ScoreRules.CheckRange(FinalScore) != EDeskillzScoreRule::None)
 	{
-		if (FinalScore < Config->MinScore || FinalScore > Config->MaxScore)
-		{
-			BroadcastError(FDeskillzError(EDeskillzErrorCode::InvalidScore, 
-				FString::Printf(TEXT("Score %lld is outside valid range [%lld, %lld]"), 
-					FinalScore, Config->MinScore, Config->MaxScore)));
-			return;
-		}
+		BroadcastError(FDeskillzError(EDeskillzErrorCode::InvalidScore, 
+			FString::Printf(TEXT("Score %lld is outside valid range [%lld, %lld]"), 
+				FinalScore, ScoreRules.GetRules().MinScore, ScoreRules.GetRules().MaxScore)));
+		return;
 	}
 	
 	// Practice mode - no server submission
@@ -649,6 +667,8 @@ void UDeskillzSDK::StartPractice(int32 DurationSeconds)
 	CurrentScore = 0;
 	MatchStartTime = FDateTime::UtcNow();
 	
+	FDeskillzScoreValidator::SelectTournament(FString());
+	
 	// Create a practice match info
 	CurrentMatch.MatchId = TEXT("practice_") + FGuid::NewGuid().ToString();
 	CurrentMatch.DurationSeconds = DurationSeconds;
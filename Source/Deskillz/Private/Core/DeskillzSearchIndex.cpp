@@ -0,0 +1,300 @@
+// Copyright Deskillz Games. All Rights Reserved.
+
+#include "Core/DeskillzSearchIndex.h"
+#include "Core/DeskillzStats.h"
+
+namespace
+{
+	/** 21 bits holds any code point (grams of different lengths never collide, as no character is 0) */
+	constexpr int32 GramCharBits = 21;
+	constexpr uint64 GramCharMask = (1ull << GramCharBits) - 1;
+
+	/** Rank of the best way a term can match a field */
+	constexpr int32 ScoreWholeField = 100;
+	constexpr int32 ScoreFieldPrefix = 70;
+	constexpr int32 ScoreWordPrefix = 50;
+	constexpr int32 ScoreSubstring = 20;
+
+	/** Penalty per field of lower priority */
+	constexpr int32 ScoreFieldStep = 5;
+
+	bool IsWordStart(const FString& Text, int32 Pos)
+	{
+		return Pos == 0 || !FChar::IsAlnum(Text[Pos - 1]);
+	}
+}
+
+// ============================================================================
+// Entries
+// ============================================================================
+
+void FDeskillzSearchIndex::Update(const FString& Id, const TArray<FString>& Fields)
+{
+	TArray<FString> LowerFields;
+	LowerFields.Reserve(Fields.Num());
+	for (const FString& Field : Fields)
+	{
+		LowerFields.Add(Field.ToLower());
+	}
+
+	if (const int32* Existing = EntryById.Find(Id))
+	{
+		FEntry& Entry = Entries[*Existing];
+		if (Entry.Fields == LowerFields)
+		{
+			return;
+		}
+
+		RemovePostings(*Existing);
+		Entry.Fields = MoveTemp(LowerFields);
+		AddPostings(*Existing);
+		return;
+	}
+
+	const int32 EntryIndex = FreeEntries.Num() > 0 ? FreeEntries.Pop() : Entries.AddDefaulted();
+	FEntry& Entry = Entries[EntryIndex];
+	Entry.Id = Id;
+	Entry.Fields = MoveTemp(LowerFields);
+	Entry.bLive = true;
+
+	EntryById.Add(Id, EntryIndex);
+	AddPostings(EntryIndex);
+}
+
+bool FDeskillzSearchIndex::Remove(const FString& Id)
+{
+	int32 EntryIndex = INDEX_NONE;
+	if (!EntryById.RemoveAndCopyValue(Id, EntryIndex))
+	{
+		return false;
+	}
+
+	RemovePostings(EntryIndex);
+
+	FEntry& Entry = Entries[EntryIndex];
+	Entry.Id.Empty();
+	Entry.Fields.Empty();
+	Entry.bLive = false;
+	FreeEntries.Add(EntryIndex);
+	return true;
+}
+
+void FDeskillzSearchIndex::Retain(const TSet<FString>& Ids)
+{
+	TArray<FString> Stale;
+	for (const TPair<FString, int32>& Pair : EntryById)
+	{
+		if (!Ids.Contains(Pair.Key))
+		{
+			Stale.Add(Pair.Key);
+		}
+	}
+
+	for (const FString& Id : Stale)
+	{
+		Remove(Id);
+	}
+}
+
+void FDeskillzSearchIndex::Reset()
+{
+	Entries.Empty();
+	FreeEntries.Empty();
+	EntryById.Empty();
+	Postings.Empty();
+}
+
+// ============================================================================
+// Grams
+// ============================================================================
+
+uint64 FDeskillzSearchIndex::MakeGram(const TCHAR* Chars, int32 Len)
+{
+	uint64 Gram = 0;
+	for (int32 i = 0; i < Len; i++)
+	{
+		Gram |= (static_cast<uint64>(Chars[i]) & GramCharMask) << (i * GramCharBits);
+	}
+	return Gram;
+}
+
+void FDeskillzSearchIndex::CollectGrams(const TArray<FString>& LowerFields, TArray<uint64>& OutGrams)
+{
+	TSet<uint64> Grams;
+
+	for (const FString& Field : LowerFields)
+	{
+		const TCHAR* Chars = *Field;
+		const int32 Len = Field.Len();
+
+		// Shorter grams serve 1-2 character queries, which match anywhere
+		for (int32 i = 0; i < Len; i++)
+		{
+			for (int32 GramLen = 1; GramLen <= 3 && i + GramLen <= Len; GramLen++)
+			{
+				Grams.Add(MakeGram(Chars + i, GramLen));
+			}
+		}
+	}
+
+	OutGrams = Grams.Array();
+}
+
+void FDeskillzSearchIndex::AddPostings(int32 EntryIndex)
+{
+	FEntry& Entry = Entries[EntryIndex];
+	CollectGrams(Entry.Fields, Entry.Grams);
+
+	for (uint64 Gram : Entry.Grams)
+	{
+		Postings.FindOrAdd(Gram).Add(EntryIndex);
+	}
+}
+
+void FDeskillzSearchIndex::RemovePostings(int32 EntryIndex)
+{
+	FEntry& Entry = Entries[EntryIndex];
+
+	for (uint64 Gram : Entry.Grams)
+	{
+		if (TArray<int32>* List = Postings.Find(Gram))
+		{
+			List->RemoveSingleSwap(EntryIndex);
+			if (List->Num() == 0)
+			{
+				Postings.Remove(Gram);
+			}
+		}
+	}
+
+	Entry.Grams.Empty();
+}
+
+// ============================================================================
+// Search
+// ============================================================================
+
+int32 FDeskillzSearchIndex::ScoreTerm(const FEntry& Entry, const FString& Term)
+{
+	int32 Best = 0;
+
+	for (int32 FieldIndex = 0; FieldIndex < Entry.Fields.Num(); FieldIndex++)
+	{
+		const FString& Field = Entry.Fields[FieldIndex];
+		int32 Score = 0;
+
+		if (Field == Term)
+		{
+			Score = ScoreWholeField;
+		}
+		else
+		{
+			int32 Pos = Field.Find(Term, ESearchCase::CaseSensitive);
+			if (Pos == 0)
+			{
+				Score = ScoreFieldPrefix;
+			}
+			else if (Pos != INDEX_NONE)
+			{
+				// Prefer an occurrence at a word start over the first occurrence
+				while (Pos != INDEX_NONE && !IsWordStart(Field, Pos))
+				{
+					Pos = Field.Find(Term, ESearchCase::CaseSensitive, ESearchDir::FromStart, Pos + 1);
+				}
+
+				Score = Pos != INDEX_NONE ? ScoreWordPrefix : ScoreSubstring;
+			}
+		}
+
+		if (Score > 0)
+		{
+			Best = FMath::Max(Best, FMath::Max(Score - FieldIndex * ScoreFieldStep, 1));
+		}
+	}
+
+	return Best;
+}
+
+TArray<FDeskillzSearchIndex::FMatch> FDeskillzSearchIndex::Search(const FString& Query, int32 MaxResults) const
+{
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzSearchIndexQuery, DeskillzUIChannel);
+
+	TArray<FMatch> Matches;
+
+	TArray<FString> Terms;
+	Query.ToLower().ParseIntoArrayWS(Terms);
+	if (Terms.Num() == 0 || EntryById.Num() == 0)
+	{
+		return Matches;
+	}
+
+	// Every match is in the posting list of each of its grams; verify only
+	// the entries in the smallest one
+	const TArray<int32>* Candidates = nullptr;
+	for (const FString& Term : Terms)
+	{
+		const TCHAR* Chars = *Term;
+		const int32 Len = Term.Len();
+
+		TArray<uint64, TInlineAllocator<16>> TermGrams;
+		if (Len < 3)
+		{
+			TermGrams.Add(MakeGram(Chars, Len));
+		}
+		else
+		{
+			for (int32 i = 0; i + 3 <= Len; i++)
+			{
+				TermGrams.Add(MakeGram(Chars + i, 3));
+			}
+		}
+
+		for (uint64 Gram : TermGrams)
+		{
+			const TArray<int32>* List = Postings.Find(Gram);
+			if (!List)
+			{
+				return Matches;
+			}
+			if (!Candidates || List->Num() < Candidates->Num())
+			{
+				Candidates = List;
+			}
+		}
+	}
+
+	Matches.Reserve(Candidates->Num());
+	for (int32 EntryIndex : *Candidates)
+	{
+		const FEntry& Entry = Entries[EntryIndex];
+
+		int32 Total = 0;
+		for (const FString& Term : Terms)
+		{
+			const int32 Score = ScoreTerm(Entry, Term);
+			if (Score == 0)
+			{
+				Total = 0;
+				break;
+			}
+			Total += Score;
+		}
+
+		if (Total > 0)
+		{
+			Matches.Add({ Entry.Id, Total });
+		}
+	}
+
+	Matches.StableSort([](const FMatch& A, const FMatch& B)
+	{
+		return A.Score > B.Score;
+	});
+
+	if (MaxResults > 0 && Matches.Num() > MaxResults)
+	{
+		Matches.SetNum(MaxResults);
+	}
+
+	return Matches;
+}
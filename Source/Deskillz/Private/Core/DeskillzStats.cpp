@@ -0,0 +1,60 @@
+// Copyright Deskillz Games. All Rights Reserved.
+
+#include "Core/DeskillzStats.h"
+
+// Network
+DEFINE_STAT(STAT_DeskillzHttpResponse);
+DEFINE_STAT(STAT_DeskillzJsonParse);
+DEFINE_STAT(STAT_DeskillzWebSocketHandleMessage);
+DEFINE_STAT(STAT_DeskillzApiParse);
+
+// Security
+DEFINE_STAT(STAT_DeskillzEncryptScore);
+DEFINE_STAT(STAT_DeskillzScoreHash);
+DEFINE_STAT(STAT_DeskillzIntegrityCheck);
+DEFINE_STAT(STAT_DeskillzRecordInput);
+DEFINE_STAT(STAT_DeskillzSubmitScore);
+
+// Analytics
+DEFINE_STAT(STAT_DeskillzTrackEvent);
+DEFINE_STAT(STAT_DeskillzAnalyticsFlush);
+DEFINE_STAT(STAT_DeskillzTelemetryTick);
+
+// Match
+DEFINE_STAT(STAT_DeskillzMatchTick);
+DEFINE_STAT(STAT_DeskillzUpdateScore);
+
+// Rooms
+DEFINE_STAT(STAT_DeskillzRoomEvent);
+DEFINE_STAT(STAT_DeskillzRoomStateUpdate);
+DEFINE_STAT(STAT_DeskillzRoomPatch);
+
+// UI
+DEFINE_STAT(STAT_DeskillzPopulateTournaments);
+DEFINE_STAT(STAT_DeskillzPopulateLeaderboard);
+DEFINE_STAT(STAT_DeskillzPopulateWallet);
+DEFINE_STAT(STAT_DeskillzPopulateRoomList);
+DEFINE_STAT(STAT_DeskillzPopulateRoomLobby);
+DEFINE_STAT(STAT_DeskillzSearchIndexQuery);
+
+// Memory
+DEFINE_STAT(STAT_DeskillzMemoryNetworkCache);
+DEFINE_STAT(STAT_DeskillzMemoryAnalyticsQueue);
+DEFINE_STAT(STAT_DeskillzMemoryTelemetry);
+DEFINE_STAT(STAT_DeskillzMemoryRoomState);
+DEFINE_STAT(STAT_DeskillzMemoryUIWidgets);
+
+// LLM tags
+LLM_DEFINE_TAG(Deskillz_Network);
+LLM_DEFINE_TAG(Deskillz_Analytics);
+LLM_DEFINE_TAG(Deskillz_Telemetry);
+LLM_DEFINE_TAG(Deskillz_Rooms);
+LLM_DEFINE_TAG(Deskillz_UI);
+
+// Trace channels
+UE_TRACE_CHANNEL_DEFINE(DeskillzNetworkChannel);
+UE_TRACE_CHANNEL_DEFINE(DeskillzSecurityChannel);
+UE_TRACE_CHANNEL_DEFINE(DeskillzAnalyticsChannel);
+UE_TRACE_CHANNEL_DEFINE(DeskillzMatchChannel);
+UE_TRACE_CHANNEL_DEFINE(DeskillzRoomsChannel);
+UE_TRACE_CHANNEL_DEFINE(DeskillzUIChannel);
@@ -0,0 +1,81 @@
+// Copyright Deskillz Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Varint coding shared by the SDK's compact binary streams (score history,
+ * replay recorder). Unsigned values are LEB128; signed values are zigzag
+ * encoded first so small magnitudes stay small.
+ */
+namespace DeskillzVarInt
+{
+	/** Most bytes one 64-bit varint takes */
+	constexpr int32 MaxBytes = 10;
+
+	/** Write an unsigned varint; returns the end of the written bytes */
+	inline uint8* WriteUInt(uint8* Dest, uint64 Value)
+	{
+		while (Value >= 0x80)
+		{
+			*Dest++ = static_cast<uint8>(Value) | 0x80;
+			Value >>= 7;
+		}
+		*Dest++ = static_cast<uint8>(Value);
+		return Dest;
+	}
+
+	/** Write a signed varint; returns the end of the written bytes */
+	inline uint8* WriteInt(uint8* Dest, int64 Value)
+	{
+		return WriteUInt(Dest, (static_cast<uint64>(Value) << 1) ^ static_cast<uint64>(Value >> 63));
+	}
+
+	inline void WriteUInt(TArray<uint8>& Dest, uint64 Value)
+	{
+		uint8 Bytes[MaxBytes];
+		Dest.Append(Bytes, WriteUInt(Bytes, Value) - Bytes);
+	}
+
+	inline void WriteInt(TArray<uint8>& Dest, int64 Value)
+	{
+		uint8 Bytes[MaxBytes];
+		Dest.Append(Bytes, WriteInt(Bytes, Value) - Bytes);
+	}
+
+	/** Read an unsigned varint and advance the cursor (input must be well formed) */
+	inline uint64 ReadUInt(const uint8*& Cursor)
+	{
+		uint64 Value = 0;
+		int32 Shift = 0;
+		uint8 Byte;
+		do
+		{
+			Byte = *Cursor++;
+			Value |= static_cast<uint64>(Byte & 0x7F) << Shift;
+			Shift += 7;
+		}
+		while (Byte & 0x80);
+		return Value;
+	}
+
+	/** Read a signed varint and advance the cursor (input must be well formed) */
+	inline int64 ReadInt(const uint8*& Cursor)
+	{
+		const uint64 Value = ReadUInt(Cursor);
+		return static_cast<int64>(Value >> 1) ^ -static_cast<int64>(Value & 1);
+	}
+
+	/** Wrapping Value - Base: defined for any pair, undone exactly by ApplyDelta */
+	inline int64 Delta(int64 Value, int64 Base)
+	{
+		return static_cast<int64>(static_cast<uint64>(Value) - static_cast<uint64>(Base));
+	}
+
+	/** Wrapping Base + Delta */
+	inline int64 ApplyDelta(int64 Base, int64 Delta)
+	{
+		return static_cast<int64>(static_cast<uint64>(Base) + static_cast<uint64>(Delta));
+	}
+}
@@ -3,11 +3,23 @@
 #include "Match/DeskillzMatchManager.h"
 #include "Core/DeskillzSDK.h"
 #include "Core/DeskillzConfig.h"
+#include "Security/DeskillzScoreRules.h"
+#include "Network/DeskillzClockSync.h"
 #include "Deskillz.h"
+#include "Core/DeskillzStats.h"
 #include "Engine/GameInstance.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
 
+namespace
+{
+	/** A warning this close to its deadline is treated as due (seconds) */
+	constexpr float TimeWarningSlackSeconds = 0.05f;
+	
+	/** Period of the real-time deadline check during gameplay (seconds) */
+	constexpr float DeadlineCheckSeconds = 0.25f;
+}
+
 // ============================================================================
 // Constructor & Lifecycle
 // ============================================================================
@@ -42,7 +54,10 @@ void UDeskillzMatchManager::Deinitialize()
 		World->GetTimerManager().ClearTimer(MatchTickHandle);
 		World->GetTimerManager().ClearTimer(CountdownHandle);
 		World->GetTimerManager().ClearTimer(TimeoutHandle);
+		World->GetTimerManager().ClearTimer(ProgressBroadcastHandle);
 	}
+	ClearTimeWarnings();
+	StopDeadlineTicker();
 	
 	Super::Deinitialize();
 }
@@ -180,19 +195,33 @@ void UDeskillzMatchManager::StartCountdown(int32 CountdownDuration)
 		return;
 	}
 	
-	UE_LOG(LogDeskillz, Log, TEXT("Starting countdown: %d seconds"), CountdownDuration);
+	// Count down to a server instant so both players of a sync match start together
+	const UDeskillzClockSync* Clock = UDeskillzClockSync::Get();
+	CountdownEndServerMs = Clock->GetServerTimeMs() + static_cast<int64>(CountdownDuration) * 1000;
+	
+	if (IsSynchronousMatch())
+	{
+		const int64 ScheduledStartMs = CurrentMatchInfo.StartTime.ToUnixTimestamp() * 1000 + CurrentMatchInfo.StartTime.GetMillisecond();
+		if (ScheduledStartMs > Clock->GetServerTimeMs())
+		{
+			CountdownEndServerMs = ScheduledStartMs;
+		}
+	}
+	
+	CountdownRemaining = FMath::Max(FMath::CeilToInt(Clock->GetSecondsUntil(CountdownEndServerMs)), 0);
+	
+	UE_LOG(LogDeskillz, Log, TEXT("Starting countdown: %d seconds"), CountdownRemaining);
 	
-	CountdownRemaining = CountdownDuration;
 	TransitionToState(EDeskillzMatchState::Countdown);
 	
-	// Start countdown timer
+	// Poll the server clock; a stalled frame must not stretch the countdown
 	if (UWorld* World = GetWorld())
 	{
 		World->GetTimerManager().SetTimer(
 			CountdownHandle,
 			this,
 			&UDeskillzMatchManager::CountdownTick,
-			1.0f,
+			0.1f,
 			true
 		);
 	}
@@ -217,34 +246,33 @@ void UDeskillzMatchManager::BeginGameplay()
 		World->GetTimerManager().ClearTimer(CountdownHandle);
 	}
 	
-	// Set gameplay start time
-	GameplayStartTime = FDateTime::UtcNow();
+	// Start at the countdown deadline rather than when the tick noticed it
+	const int64 NowServerMs = UDeskillzClockSync::Get()->GetServerTimeMs();
+	GameplayStartServerMs = (MatchState == EDeskillzMatchState::Countdown && CountdownEndServerMs > 0)
+		? FMath::Min(CountdownEndServerMs, NowServerMs)
+		: NowServerMs;
+	GameplayEndServerMs = GameplayStartServerMs + static_cast<int64>(CurrentMatchInfo.DurationSeconds) * 1000;
+	
+	if (const UDeskillzConfig* Config = UDeskillzConfig::Get())
+	{
+		ScoreHistory.SetCapacity(Config->MaxScoreCheckpoints);
+	}
+	
 	CurrentMatchInfo.Status = EDeskillzMatchStatus::InProgress;
 	
 	// Transition to playing
 	TransitionToState(EDeskillzMatchState::Playing);
 	
-	// Start match tick
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().SetTimer(
-			MatchTickHandle,
-			this,
-			&UDeskillzMatchManager::MatchTick,
-			0.1f, // 10 Hz update
-			true
-		);
-		
-		// Set timeout for match duration
-		float MatchDuration = (float)CurrentMatchInfo.DurationSeconds;
-		World->GetTimerManager().SetTimer(
-			TimeoutHandle,
-			this,
-			&UDeskillzMatchManager::OnMatchTimeout,
-			MatchDuration,
-			false
-		);
-	}
+	// Warnings and timeout fire at their deadlines. World timers follow game
+	// time, which stops in the background and is clamped on long frames, so a
+	// low-rate real-time check catches whatever they would deliver late.
+	ScheduleTimeWarnings();
+	ScheduleMatchTimeout();
+	StopDeadlineTicker();
+	DeadlineTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &UDeskillzMatchManager::DeadlineTick),
+		DeadlineCheckSeconds
+	);
 	
 	// Notify SDK
 	if (UDeskillzSDK* SDK = GetSDK())
@@ -272,12 +300,14 @@ void UDeskillzMatchManager::EndMatch(int64 FinalScore)
 		World->GetTimerManager().ClearTimer(MatchTickHandle);
 		World->GetTimerManager().ClearTimer(TimeoutHandle);
 	}
+	ClearTimeWarnings();
+	StopDeadlineTicker();
 	
 	// Update final score
 	CurrentScore = FinalScore;
 	
 	// Create final checkpoint
-	CreateScoreCheckpoint(TEXT("final"));
+	RecordCheckpoint(EDeskillzCheckpointEvent::Final);
 	
 	// Transition to submitting
 	TransitionToState(EDeskillzMatchState::Submitting);
@@ -305,6 +335,8 @@ void UDeskillzMatchManager::AbortMatch(const FString& Reason)
 		World->GetTimerManager().ClearTimer(CountdownHandle);
 		World->GetTimerManager().ClearTimer(TimeoutHandle);
 	}
+	ClearTimeWarnings();
+	StopDeadlineTicker();
 	
 	// Notify SDK
 	if (UDeskillzSDK* SDK = GetSDK())
@@ -333,6 +365,8 @@ void UDeskillzMatchManager::AbortMatch(const FString& Reason)
 
 void UDeskillzMatchManager::UpdateScore(int64 NewScore)
 {
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzUpdateScore, DeskillzMatchChannel);
+	
 	if (!IsMatchActive())
 	{
 		return;
@@ -348,6 +382,11 @@ void UDeskillzMatchManager::UpdateScore(int64 NewScore)
 	int64 OldScore = CurrentScore;
 	CurrentScore = NewScore;
 	
+	if (NewScore != OldScore)
+	{
+		MarkProgressDirty();
+	}
+	
 	// Notify SDK for real-time sync
 	if (UDeskillzSDK* SDK = GetSDK())
 	{
@@ -355,12 +394,33 @@ void UDeskillzMatchManager::UpdateScore(int64 NewScore)
 	}
 	
 	// Log significant score changes
-	if (FMath::Abs(NewScore - OldScore) > 1000)
+	if (FDeskillzScoreValidator::Distance(OldScore, NewScore) > 1000)
+	{
+		RecordCheckpoint(EDeskillzCheckpointEvent::SignificantChange);
+	}
+	else
 	{
-		CreateScoreCheckpoint(TEXT("significant_change"));
+		// Periodic checkpoints at the cadence the score rules ask for
+		const float LastCheckpointTime = ScoreHistory.GetLastTimestamp();
+		if (FDeskillzScoreValidator::GetActive().IsCheckpointDue(GetElapsedTime() - LastCheckpointTime))
+		{
+			RecordCheckpoint(EDeskillzCheckpointEvent::Cadence);
+		}
 	}
 }
 
+void UDeskillzMatchManager::UpdateOpponentScore(int64 NewOpponentScore)
+{
+	if (!IsInMatch() || NewOpponentScore == OpponentScore)
+	{
+		return;
+	}
+	
+	OpponentScore = NewOpponentScore;
+	OnOpponentScoreUpdate.Broadcast(OpponentScore);
+	MarkProgressDirty();
+}
+
 void UDeskillzMatchManager::AddScore(int64 Points)
 {
 	UpdateScore(CurrentScore + Points);
@@ -375,13 +435,36 @@ void UDeskillzMatchManager::CreateScoreCheckpoint(const FString& EventType)
 {
 	float Timestamp = GetElapsedTime();
 	
-	FDeskillzScoreCheckpoint Checkpoint(CurrentScore, Timestamp, EventType);
-	ScoreHistory.Add(Checkpoint);
+	ScoreHistory.Add(CurrentScore, Timestamp, FName(*EventType));
 	
 	UE_LOG(LogDeskillz, Verbose, TEXT("Score checkpoint: %lld at %.2fs (%s)"), 
 		CurrentScore, Timestamp, *EventType);
 }
 
+void UDeskillzMatchManager::RecordCheckpoint(EDeskillzCheckpointEvent EventType)
+{
+	float Timestamp = GetElapsedTime();
+	
+	ScoreHistory.Add(CurrentScore, Timestamp, EventType);
+	
+	UE_LOG(LogDeskillz, Verbose, TEXT("Score checkpoint: %lld at %.2fs (%d)"), 
+		CurrentScore, Timestamp, (int32)EventType);
+}
+
+TArray<FDeskillzScoreCheckpoint> UDeskillzMatchManager::GetScoreHistory() const
+{
+	TArray<FDeskillzScoreCheckpoint> Checkpoints;
+	Checkpoints.Reserve(ScoreHistory.Num());
+	
+	const TArray<FName>& EventTypes = ScoreHistory.GetEventTypes();
+	ScoreHistory.ForEach([&Checkpoints, &EventTypes](const FDeskillzScoreHistory::FEntry& Entry)
+	{
+		Checkpoints.Emplace(Entry.Score, Entry.GetTimestamp(), EventTypes[Entry.EventType].ToString());
+	});
+	
+	return Checkpoints;
+}
+
 // ============================================================================
 // Match State & Timing
 // ============================================================================
@@ -406,8 +489,8 @@ float UDeskillzMatchManager::GetElapsedTime() const
 		return 0.0f;
 	}
 	
-	FTimespan Duration = FDateTime::UtcNow() - GameplayStartTime;
-	return (float)Duration.GetTotalSeconds();
+	const int64 ElapsedMs = UDeskillzClockSync::Get()->GetServerTimeMs() - GameplayStartServerMs;
+	return (float)FMath::Max<int64>(ElapsedMs, 0) / 1000.0f;
 }
 
 float UDeskillzMatchManager::GetRemainingTime() const
@@ -417,8 +500,8 @@ float UDeskillzMatchManager::GetRemainingTime() const
 		return (float)CurrentMatchInfo.DurationSeconds;
 	}
 	
-	float Elapsed = GetElapsedTime();
-	return FMath::Max(0.0f, (float)CurrentMatchInfo.DurationSeconds - Elapsed);
+	const double Remaining = UDeskillzClockSync::Get()->GetSecondsUntil(GameplayEndServerMs);
+	return FMath::Max(0.0f, (float)Remaining);
 }
 
 float UDeskillzMatchManager::GetProgressPercent() const
@@ -443,13 +526,7 @@ bool UDeskillzMatchManager::IsSynchronousMatch() const
 
 bool UDeskillzMatchManager::ValidateScore(int64 Score) const
 {
-	const UDeskillzConfig* Config = UDeskillzConfig::Get();
-	if (!Config)
-	{
-		return true;
-	}
-	
-	return Score >= Config->MinScore && Score <= Config->MaxScore;
+	return FDeskillzScoreValidator::GetActive().CheckRange(Score) == EDeskillzScoreRule::None;
 }
 
 bool UDeskillzMatchManager::IsTimeExpired() const
@@ -465,6 +542,204 @@ void UDeskillzMatchManager::SetTimeWarningThresholds(const TArray<float>& Thresh
 {
 	TimeWarnings = Thresholds;
 	TimeWarnings.Sort([](float A, float B) { return A > B; }); // Sort descending
+	
+	if (IsMatchActive())
+	{
+		ClearTimeWarnings();
+		ScheduleTimeWarnings();
+	}
+}
+
+TArray<float> UDeskillzMatchManager::GetDueTimeWarnings(const TArray<float>& Thresholds, const TSet<float>& Triggered,
+	int32 DurationSeconds, float RemainingSeconds)
+{
+	TArray<float> Due;
+	for (float Threshold : Thresholds)
+	{
+		if (Threshold >= (float)DurationSeconds || Threshold <= 0.0f || Triggered.Contains(Threshold))
+		{
+			continue;
+		}
+		
+		if (RemainingSeconds <= Threshold + TimeWarningSlackSeconds)
+		{
+			Due.Add(Threshold);
+		}
+	}
+	
+	Due.Sort([](float A, float B) { return A > B; });
+	return Due;
+}
+
+void UDeskillzMatchManager::ScheduleTimeWarnings()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+	
+	const float Remaining = GetRemainingTime();
+	for (float Threshold : TimeWarnings)
+	{
+		// Thresholds past when the match started (e.g. 60s in a 30s match) never fire
+		if (Threshold >= (float)CurrentMatchInfo.DurationSeconds || Threshold <= 0.0f ||
+			TriggeredWarnings.Contains(Threshold))
+		{
+			continue;
+		}
+		
+		FTimerHandle& Handle = TimeWarningHandles.AddDefaulted_GetRef();
+		World->GetTimerManager().SetTimer(
+			Handle,
+			FTimerDelegate::CreateUObject(this, &UDeskillzMatchManager::OnTimeWarningDue, Threshold),
+			FMath::Max(Remaining - Threshold, 0.01f),
+			false
+		);
+	}
+}
+
+void UDeskillzMatchManager::ClearTimeWarnings()
+{
+	if (UWorld* World = GetWorld())
+	{
+		for (FTimerHandle& Handle : TimeWarningHandles)
+		{
+			World->GetTimerManager().ClearTimer(Handle);
+		}
+	}
+	TimeWarningHandles.Reset();
+}
+
+void UDeskillzMatchManager::OnTimeWarningDue(float Threshold)
+{
+	if (!IsMatchActive() || TriggeredWarnings.Contains(Threshold))
+	{
+		return;
+	}
+	
+	// World timers follow game time; re-arm if the server clock is not there yet
+	const float Remaining = GetRemainingTime();
+	if (Remaining > Threshold + TimeWarningSlackSeconds)
+	{
+		if (UWorld* World = GetWorld())
+		{
+			FTimerHandle& Handle = TimeWarningHandles.AddDefaulted_GetRef();
+			World->GetTimerManager().SetTimer(
+				Handle,
+				FTimerDelegate::CreateUObject(this, &UDeskillzMatchManager::OnTimeWarningDue, Threshold),
+				Remaining - Threshold,
+				false
+			);
+		}
+		return;
+	}
+	
+	TriggeredWarnings.Add(Threshold);
+	OnTimeWarning.Broadcast(Remaining);
+	
+	// Special case for expiring warning
+	if (Threshold <= 10.0f)
+	{
+		OnMatchExpiring.Broadcast();
+	}
+	
+	MarkProgressDirty();
+}
+
+// ============================================================================
+// Progress Refresh
+// ============================================================================
+
+void UDeskillzMatchManager::SetProgressRefreshRate(UObject* Listener, float RefreshHz)
+{
+	if (!Listener)
+	{
+		return;
+	}
+	
+	if (RefreshHz > 0.0f)
+	{
+		ProgressRefreshRates.Add(Listener, RefreshHz);
+	}
+	else
+	{
+		ProgressRefreshRates.Remove(Listener);
+	}
+	
+	UpdateProgressTick();
+}
+
+void UDeskillzMatchManager::UpdateProgressTick()
+{
+	float RefreshHz = 0.0f;
+	for (auto It = ProgressRefreshRates.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+		RefreshHz = FMath::Max(RefreshHz, It.Value());
+	}
+	
+	// Only the countdown and gameplay have a clock worth refreshing
+	const bool bTicking = MatchState == EDeskillzMatchState::Countdown || MatchState == EDeskillzMatchState::Playing;
+	if (!bTicking)
+	{
+		RefreshHz = 0.0f;
+	}
+	
+	UWorld* World = GetWorld();
+	const bool bTimerActive = World && World->GetTimerManager().IsTimerActive(MatchTickHandle);
+	if (RefreshHz == ActiveProgressRefreshHz && (RefreshHz > 0.0f) == bTimerActive)
+	{
+		return;
+	}
+	
+	ActiveProgressRefreshHz = RefreshHz;
+	
+	if (World)
+	{
+		if (RefreshHz > 0.0f)
+		{
+			World->GetTimerManager().SetTimer(
+				MatchTickHandle,
+				this,
+				&UDeskillzMatchManager::MatchTick,
+				1.0f / RefreshHz,
+				true
+			);
+		}
+		else
+		{
+			World->GetTimerManager().ClearTimer(MatchTickHandle);
+		}
+	}
+}
+
+void UDeskillzMatchManager::MarkProgressDirty()
+{
+	if (bProgressBroadcastPending)
+	{
+		return;
+	}
+	
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		OnMatchProgressUpdate.Broadcast(GetProgress());
+		return;
+	}
+	
+	bProgressBroadcastPending = true;
+	ProgressBroadcastHandle = World->GetTimerManager().SetTimerForNextTick(this, &UDeskillzMatchManager::BroadcastProgress);
+}
+
+void UDeskillzMatchManager::BroadcastProgress()
+{
+	bProgressBroadcastPending = false;
+	OnMatchProgressUpdate.Broadcast(GetProgress());
 }
 
 // ============================================================================
@@ -485,6 +760,9 @@ void UDeskillzMatchManager::TransitionToState(EDeskillzMatchState NewState)
 	UE_LOG(LogDeskillz, Log, TEXT("Match state: %d -> %d"), (int32)OldState, (int32)NewState);
 	
 	OnMatchStateChanged.Broadcast(OldState, NewState);
+	
+	UpdateProgressTick();
+	MarkProgressDirty();
 }
 
 bool UDeskillzMatchManager::CanTransitionTo(EDeskillzMatchState NewState) const
@@ -528,31 +806,39 @@ bool UDeskillzMatchManager::CanTransitionTo(EDeskillzMatchState NewState) const
 
 void UDeskillzMatchManager::MatchTick()
 {
-	if (!IsMatchActive())
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzMatchTick, DeskillzMatchChannel);
+	
+	// Drop rates requested by listeners that have gone away
+	for (const TPair<TWeakObjectPtr<UObject>, float>& Pair : ProgressRefreshRates)
 	{
-		return;
+		if (!Pair.Key.IsValid())
+		{
+			UpdateProgressTick();
+			break;
+		}
 	}
 	
-	// Check time warnings
-	CheckTimeWarnings();
-	
-	// Broadcast progress update
-	OnMatchProgressUpdate.Broadcast(GetProgress());
-	
-	// Check for timeout
-	if (IsTimeExpired())
+	if (ActiveProgressRefreshHz > 0.0f)
 	{
-		OnMatchTimeout();
+		OnMatchProgressUpdate.Broadcast(GetProgress());
 	}
 }
 
 void UDeskillzMatchManager::CountdownTick()
 {
-	CountdownRemaining--;
+	const double SecondsLeft = UDeskillzClockSync::Get()->GetSecondsUntil(CountdownEndServerMs);
+	const int32 NewRemaining = FMath::Max(FMath::CeilToInt(SecondsLeft), 0);
+	if (NewRemaining == CountdownRemaining)
+	{
+		return;
+	}
+	
+	CountdownRemaining = NewRemaining;
 	
 	UE_LOG(LogDeskillz, Log, TEXT("Countdown: %d"), CountdownRemaining);
 	
 	OnCountdown.Broadcast(CountdownRemaining);
+	MarkProgressDirty();
 	
 	if (CountdownRemaining <= 0)
 	{
@@ -565,28 +851,6 @@ void UDeskillzMatchManager::CountdownTick()
 	}
 }
 
-void UDeskillzMatchManager::CheckTimeWarnings()
-{
-	float Remaining = GetRemainingTime();
-	
-	for (float Threshold : TimeWarnings)
-	{
-		if (Remaining <= Threshold && !TriggeredWarnings.Contains(Threshold))
-		{
-			TriggeredWarnings.Add(Threshold);
-			OnTimeWarning.Broadcast(Remaining);
-			
-			// Special case for expiring warning
-			if (Threshold <= 10.0f)
-			{
-				OnMatchExpiring.Broadcast();
-			}
-			
-			break; // Only trigger one warning per tick
-		}
-	}
-}
-
 void UDeskillzMatchManager::OnMatchTimeout()
 {
 	if (!IsMatchActive())
@@ -594,6 +858,20 @@ void UDeskillzMatchManager::OnMatchTimeout()
 		return;
 	}
 	
+	// World timers follow game time; only the server clock decides the end
+	if (!IsTimeExpired())
+	{
+		ScheduleMatchTimeout();
+		return;
+	}
+	
+	// Whichever of the timer and the real-time check got here first, the other is done
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(TimeoutHandle);
+	}
+	StopDeadlineTicker();
+	
 	UE_LOG(LogDeskillz, Log, TEXT("Match timeout - auto-submitting score"));
 	
 	// Auto-submit current score
@@ -604,15 +882,65 @@ void UDeskillzMatchManager::OnMatchTimeout()
 	}
 }
 
+void UDeskillzMatchManager::ScheduleMatchTimeout()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().SetTimer(
+			TimeoutHandle,
+			this,
+			&UDeskillzMatchManager::OnMatchTimeout,
+			FMath::Max(GetRemainingTime(), 0.01f),
+			false
+		);
+	}
+}
+
+bool UDeskillzMatchManager::DeadlineTick(float DeltaTime)
+{
+	if (!IsMatchActive())
+	{
+		DeadlineTickerHandle.Reset();
+		return false;
+	}
+	
+	for (float Threshold : GetDueTimeWarnings(TimeWarnings, TriggeredWarnings, CurrentMatchInfo.DurationSeconds, GetRemainingTime()))
+	{
+		OnTimeWarningDue(Threshold);
+	}
+	
+	if (IsTimeExpired())
+	{
+		// Returning false removes this ticker; OnMatchTimeout must not remove it again
+		DeadlineTickerHandle.Reset();
+		OnMatchTimeout();
+		return false;
+	}
+	
+	return true;
+}
+
+void UDeskillzMatchManager::StopDeadlineTicker()
+{
+	if (DeadlineTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(DeadlineTickerHandle);
+		DeadlineTickerHandle.Reset();
+	}
+}
+
 void UDeskillzMatchManager::ResetMatchState()
 {
 	MatchState = EDeskillzMatchState::None;
 	CurrentMatchInfo = FDeskillzMatchInfo();
 	CurrentScore = 0;
 	OpponentScore = 0;
-	ScoreHistory.Empty();
+	ScoreHistory.Reset();
 	TriggeredWarnings.Empty();
 	CountdownRemaining = 0;
+	CountdownEndServerMs = 0;
+	GameplayStartServerMs = 0;
+	GameplayEndServerMs = 0;
 	bIsPlayerReady = false;
 	bIsOpponentReady = false;
 }
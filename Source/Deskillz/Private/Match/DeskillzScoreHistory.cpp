@@ -0,0 +1,228 @@
+// Copyright Deskillz Games. All Rights Reserved.
+
+#include "Match/DeskillzScoreHistory.h"
+#include "Deskillz.h"
+#include "Core/DeskillzVarInt.h"
+
+namespace
+{
+	/** Names of the built-in event types, in enum order */
+	const TCHAR* BuiltInEventNames[] =
+	{
+		TEXT("update"),
+		TEXT("checkpoint"),
+		TEXT("cadence"),
+		TEXT("significant_change"),
+		TEXT("final"),
+	};
+	static_assert(UE_ARRAY_COUNT(BuiltInEventNames) == static_cast<int32>(EDeskillzCheckpointEvent::BuiltInCount),
+		"Every built-in checkpoint event needs a name");
+}
+
+FDeskillzScoreHistory::FDeskillzScoreHistory()
+{
+	EventTypes.Reserve(static_cast<int32>(EDeskillzCheckpointEvent::BuiltInCount));
+	for (const TCHAR* Name : BuiltInEventNames)
+	{
+		EventTypes.Add(FName(Name));
+	}
+}
+
+// ============================================================================
+// Updates
+// ============================================================================
+
+void FDeskillzScoreHistory::SetCapacity(int32 InMaxCheckpoints)
+{
+	MaxCheckpoints = FMath::Max(InMaxCheckpoints, 16);
+	while (Count > MaxCheckpoints)
+	{
+		const int32 Before = Count;
+		Downsample();
+		if (Count == Before)
+		{
+			break;
+		}
+	}
+}
+
+void FDeskillzScoreHistory::Add(int64 Score, float Timestamp, EDeskillzCheckpointEvent EventType)
+{
+	const uint32 TimeMs = static_cast<uint32>(FMath::Max(FMath::RoundToInt64(Timestamp * 1000.0), (int64)0));
+	Append(Score, TimeMs, static_cast<int32>(EventType));
+}
+
+void FDeskillzScoreHistory::Add(int64 Score, float Timestamp, FName EventType)
+{
+	int32 TypeIndex = EventTypes.IndexOfByKey(EventType);
+	if (TypeIndex == INDEX_NONE)
+	{
+		if (EventTypes.Num() < MaxEventTypes)
+		{
+			TypeIndex = EventTypes.Add(EventType);
+		}
+		else
+		{
+			UE_LOG(LogDeskillz, Warning, TEXT("Too many checkpoint event types; recording %s as checkpoint"), *EventType.ToString());
+			TypeIndex = static_cast<int32>(EDeskillzCheckpointEvent::Checkpoint);
+		}
+	}
+
+	const uint32 TimeMs = static_cast<uint32>(FMath::Max(FMath::RoundToInt64(Timestamp * 1000.0), (int64)0));
+	Append(Score, TimeMs, TypeIndex);
+}
+
+void FDeskillzScoreHistory::Reset()
+{
+	Encoded.Reset();
+	Count = 0;
+	DownsampleCount = 0;
+	LastScore = 0;
+	LastTimeMs = 0;
+}
+
+void FDeskillzScoreHistory::Append(int64 Score, uint32 TimeMs, int32 EventType)
+{
+	if (Count >= MaxCheckpoints)
+	{
+		Downsample();
+	}
+
+	// Elapsed time only moves forward; keep deltas unsigned
+	TimeMs = FMath::Max(TimeMs, LastTimeMs);
+
+	DeskillzVarInt::WriteUInt(Encoded, TimeMs - LastTimeMs);
+	DeskillzVarInt::WriteInt(Encoded, DeskillzVarInt::Delta(Score, LastScore));
+	DeskillzVarInt::WriteUInt(Encoded, static_cast<uint64>(EventType));
+
+	LastScore = Score;
+	LastTimeMs = TimeMs;
+	Count++;
+}
+
+// ============================================================================
+// Downsampling
+// ============================================================================
+
+bool FDeskillzScoreHistory::IsRoutine(int32 EventType)
+{
+	return EventType == static_cast<int32>(EDeskillzCheckpointEvent::Update) ||
+		EventType == static_cast<int32>(EDeskillzCheckpointEvent::Cadence);
+}
+
+void FDeskillzScoreHistory::Downsample()
+{
+	if (Count < 3)
+	{
+		return;
+	}
+
+	TArray<FEntry> Entries;
+	Entries.Reserve(Count);
+	ForEach([&Entries](const FEntry& Entry)
+	{
+		Entries.Add(Entry);
+	});
+
+	int32 MinIndex = 0;
+	int32 MaxIndex = 0;
+	for (int32 i = 1; i < Entries.Num(); i++)
+	{
+		if (Entries[i].Score < Entries[MinIndex].Score)
+		{
+			MinIndex = i;
+		}
+		if (Entries[i].Score > Entries[MaxIndex].Score)
+		{
+			MaxIndex = i;
+		}
+	}
+
+	// Keep the first checkpoint in each of MaxCheckpoints / 4 equal slices of
+	// the match; without this, every pass halves the oldest stretch again and
+	// early play keeps losing resolution geometrically
+	const int32 NumBuckets = FMath::Max(MaxCheckpoints / 4, 1);
+	const uint64 Span = static_cast<uint64>(Entries.Last().TimeMs) + 1;
+	TBitArray<> BucketFirst(false, Entries.Num());
+	int32 LastBucket = INDEX_NONE;
+	for (int32 i = 0; i < Entries.Num(); i++)
+	{
+		const int32 Bucket = static_cast<int32>(static_cast<uint64>(Entries[i].TimeMs) * NumBuckets / Span);
+		if (Bucket != LastBucket)
+		{
+			BucketFirst[i] = true;
+			LastBucket = Bucket;
+		}
+	}
+
+	auto IsPinned = [&](int32 Index)
+	{
+		return Index == 0 || Index == Entries.Num() - 1 || Index == MinIndex || Index == MaxIndex || BucketFirst[Index];
+	};
+
+	// Drop every other routine checkpoint until half the cap is free; thin
+	// significant events the same way only once no routine ones are left
+	TBitArray<> Keep(true, Entries.Num());
+	int32 Kept = Entries.Num();
+	for (const bool bRoutineOnly : { true, false })
+	{
+		while (Kept > MaxCheckpoints / 2)
+		{
+			const int32 Before = Kept;
+			bool bDropNext = false;
+			for (int32 i = 0; i < Entries.Num(); i++)
+			{
+				if (!Keep[i] || IsPinned(i) || (bRoutineOnly && !IsRoutine(Entries[i].EventType)))
+				{
+					continue;
+				}
+
+				if (bDropNext)
+				{
+					Keep[i] = false;
+					Kept--;
+				}
+				bDropNext = !bDropNext;
+			}
+
+			if (Kept == Before)
+			{
+				break;
+			}
+		}
+	}
+
+	const int32 Downsamples = DownsampleCount + 1;
+	Reset();
+	DownsampleCount = Downsamples;
+
+	Encoded.Reserve(Kept * 4);
+	for (int32 i = 0; i < Entries.Num(); i++)
+	{
+		if (Keep[i])
+		{
+			Append(Entries[i].Score, Entries[i].TimeMs, Entries[i].EventType);
+		}
+	}
+
+	UE_LOG(LogDeskillz, Verbose, TEXT("Score history downsampled: %d -> %d checkpoints"), Entries.Num(), Count);
+}
+
+// ============================================================================
+// Reading
+// ============================================================================
+
+void FDeskillzScoreHistory::ForEach(TFunctionRef<void(const FEntry&)> Visitor) const
+{
+	const uint8* Cursor = Encoded.GetData();
+	const uint8* End = Cursor + Encoded.Num();
+
+	FEntry Entry;
+	while (Cursor < End)
+	{
+		Entry.TimeMs += static_cast<uint32>(DeskillzVarInt::ReadUInt(Cursor));
+		Entry.Score = DeskillzVarInt::ApplyDelta(Entry.Score, DeskillzVarInt::ReadInt(Cursor));
+		Entry.EventType = static_cast<int32>(DeskillzVarInt::ReadUInt(Cursor));
+		Visitor(Entry);
+	}
+}
@@ -0,0 +1,415 @@
+// Copyright Deskillz Games. All Rights Reserved.
+
+#include "Match/DeskillzTournamentManager.h"
+#include "Core/DeskillzConfig.h"
+#include "Deskillz.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace
+{
+	/**
+	 * Pushed tournament events. Each is subscribed by name: the socket keeps
+	 * one callback per event, so a "tournament:*" wildcard would replace (or be
+	 * replaced by) any other subscriber's.
+	 */
+	const TCHAR* TournamentEvents[] =
+	{
+		TEXT("tournament:subscribed"),
+		TEXT("tournament:added"),
+		TEXT("tournament:updated"),
+		TEXT("tournament:status"),
+		TEXT("tournament:removed"),
+		TEXT("tournament:closed"),
+	};
+
+	/** Server acknowledgement of the channel join */
+	const TCHAR* SubscribedEvent = TEXT("tournament:subscribed");
+
+	/** Without an ack or delta for this long, polling takes over again (seconds) */
+	constexpr double UpdatesQuietTimeoutSeconds = 120.0;
+}
+
+// ============================================================================
+// Tournament Discovery
+// ============================================================================
+
+TArray<FDeskillzTournament> UDeskillzTournamentManager::GetFilteredTournaments(const FDeskillzTournamentFilter& Filter) const
+{
+	return ApplyFilter(Filter);
+}
+
+TArray<FDeskillzTournament> UDeskillzTournamentManager::ApplyFilter(const FDeskillzTournamentFilter& Filter, int32 MaxCount) const
+{
+	TArray<FDeskillzTournament> Result;
+
+	GetTournamentStore().Query(Filter, [this, &Filter, &Result, MaxCount](const FDeskillzTournament& Tournament)
+	{
+		if (!Filter.bOnlyAffordable || CanAffordEntry(Tournament, Tournament.EntryFee.Currency))
+		{
+			Result.Add(Tournament);
+		}
+		return MaxCount <= 0 || Result.Num() < MaxCount;
+	});
+
+	return Result;
+}
+
+void UDeskillzTournamentManager::OnTournamentsReceived(const TArray<FDeskillzTournament>& Tournaments, const FDeskillzError& Error)
+{
+	if (Error.IsError())
+	{
+		UE_LOG(LogDeskillz, Warning, TEXT("Failed to fetch tournaments: %s"), *Error.Message);
+		return;
+	}
+
+	TSet<FString> ListedIds;
+	ListedIds.Reserve(Tournaments.Num());
+	for (const FDeskillzTournament& Tournament : Tournaments)
+	{
+		ListedIds.Add(Tournament.TournamentId);
+		ApplyTournamentChange(Tournament);
+	}
+
+	TArray<FString> DelistedIds;
+	for (const FDeskillzTournament& Cached : GetTournamentStore().ToArray())
+	{
+		if (!ListedIds.Contains(Cached.TournamentId))
+		{
+			DelistedIds.Add(Cached.TournamentId);
+		}
+	}
+	for (const FString& TournamentId : DelistedIds)
+	{
+		ApplyTournamentRemoval(TournamentId);
+	}
+
+	LastFetchTime = FDateTime::UtcNow();
+
+	UE_LOG(LogDeskillz, Verbose, TEXT("Tournament cache synced: %d tournaments, %d delisted"),
+		GetTournamentStore().Num(), DelistedIds.Num());
+
+	OnTournamentsUpdated.Broadcast(Tournaments);
+
+	// The cache is populated; keep it current with pushed deltas from here on
+	if (UpdatesChannel.IsEmpty())
+	{
+		SubscribeToUpdates();
+	}
+}
+
+void UDeskillzTournamentManager::AutoRefresh()
+{
+	// Pushed deltas keep the cache current; the full fetch is only a safety net
+	if (IsReceivingUpdates() && (FDateTime::UtcNow() - LastFetchTime).GetTotalSeconds() < FullResyncIntervalSeconds)
+	{
+		return;
+	}
+
+	FetchTournaments();
+}
+
+// ============================================================================
+// Realtime Updates
+// ============================================================================
+
+void UDeskillzTournamentManager::SubscribeToUpdates()
+{
+	UDeskillzWebSocket* Socket = UDeskillzWebSocket::Get();
+	const UDeskillzConfig* Config = UDeskillzConfig::Get();
+	if (!Socket || !Config || Config->GameId.IsEmpty())
+	{
+		UE_LOG(LogDeskillz, Warning, TEXT("Cannot subscribe to tournament updates: socket or game ID unavailable"));
+		return;
+	}
+
+	if (!UpdatesChannel.IsEmpty())
+	{
+		return;
+	}
+
+	UpdatesChannel = FString::Printf(TEXT("tournaments:%s"), *Config->GameId);
+	LastUpdateSequence = 0;
+	LastUpdateActivitySeconds = 0.0;
+
+	for (const TCHAR* EventType : TournamentEvents)
+	{
+		Socket->SubscribeToEvent(EventType,
+			FOnDeskillzWSMessageNative::CreateUObject(this, &UDeskillzTournamentManager::HandleTournamentEvent));
+	}
+	Socket->OnConnected.AddUniqueDynamic(this, &UDeskillzTournamentManager::HandleSocketConnected);
+
+	// While disconnected the join is only queued; HandleSocketConnected joins again
+	Socket->JoinRoom(UpdatesChannel);
+
+	UE_LOG(LogDeskillz, Log, TEXT("Subscribed to tournament updates (%s)"), *UpdatesChannel);
+}
+
+void UDeskillzTournamentManager::UnsubscribeFromUpdates()
+{
+	if (UpdatesChannel.IsEmpty())
+	{
+		return;
+	}
+
+	if (UDeskillzWebSocket* Socket = UDeskillzWebSocket::Get())
+	{
+		Socket->LeaveRoom(UpdatesChannel);
+		for (const TCHAR* EventType : TournamentEvents)
+		{
+			Socket->UnsubscribeFromEvent(EventType);
+		}
+		Socket->OnConnected.RemoveDynamic(this, &UDeskillzTournamentManager::HandleSocketConnected);
+	}
+
+	UpdatesChannel.Empty();
+	LastUpdateSequence = 0;
+	LastUpdateActivitySeconds = 0.0;
+
+	UE_LOG(LogDeskillz, Log, TEXT("Unsubscribed from tournament updates"));
+}
+
+bool UDeskillzTournamentManager::IsReceivingUpdates() const
+{
+	// A connected socket alone proves nothing; the server must have acked
+	// the join or pushed a delta recently
+	const UDeskillzWebSocket* Socket = UDeskillzWebSocket::Get();
+	return !UpdatesChannel.IsEmpty() && Socket && Socket->IsConnected()
+		&& LastUpdateActivitySeconds > 0.0
+		&& FPlatformTime::Seconds() - LastUpdateActivitySeconds < UpdatesQuietTimeoutSeconds;
+}
+
+void UDeskillzTournamentManager::HandleSocketConnected()
+{
+	if (UpdatesChannel.IsEmpty())
+	{
+		return;
+	}
+
+	// A join sent while disconnected was never recorded for rejoin
+	LastUpdateActivitySeconds = 0.0;
+	if (UDeskillzWebSocket* Socket = UDeskillzWebSocket::Get())
+	{
+		Socket->JoinRoom(UpdatesChannel);
+	}
+
+	RequestResync(TEXT("socket reconnected"));
+}
+
+void UDeskillzTournamentManager::RequestResync(const TCHAR* Reason)
+{
+	UE_LOG(LogDeskillz, Log, TEXT("Resyncing tournaments: %s"), Reason);
+
+	// The next delta starts a fresh sequence
+	LastUpdateSequence = 0;
+	FetchTournaments();
+}
+
+void UDeskillzTournamentManager::HandleTournamentEvent(const FDeskillzWebSocketMessage& Message)
+{
+	LastUpdateActivitySeconds = FPlatformTime::Seconds();
+
+	// Join ack: the channel is live, and its sequence starts afresh
+	if (Message.EventType == SubscribedEvent)
+	{
+		LastUpdateSequence = 0;
+		return;
+	}
+
+	TSharedPtr<FJsonObject> Json;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Message.Data);
+	if (!FJsonSerializer::Deserialize(Reader, Json) || !Json.IsValid())
+	{
+		return;
+	}
+
+	// Deltas are numbered per channel; a gap means one was missed
+	double SequenceNumber = 0.0;
+	if (Json->TryGetNumberField(TEXT("seq"), SequenceNumber))
+	{
+		const int64 Sequence = static_cast<int64>(SequenceNumber);
+		if (LastUpdateSequence > 0 && Sequence <= LastUpdateSequence)
+		{
+			return;
+		}
+
+		const bool bGap = LastUpdateSequence > 0 && Sequence > LastUpdateSequence + 1;
+		LastUpdateSequence = Sequence;
+		if (bGap)
+		{
+			RequestResync(TEXT("missed tournament update"));
+			return;
+		}
+	}
+
+	const TSharedPtr<FJsonObject>* DataObject = nullptr;
+	const TSharedPtr<FJsonObject> Data = Json->TryGetObjectField(TEXT("data"), DataObject) ? *DataObject : Json;
+
+	FString TournamentId;
+	if (!Data->TryGetStringField(TEXT("tournamentId"), TournamentId))
+	{
+		Data->TryGetStringField(TEXT("id"), TournamentId);
+	}
+	if (TournamentId.IsEmpty())
+	{
+		return;
+	}
+
+	if (Message.EventType == TEXT("tournament:removed") || Message.EventType == TEXT("tournament:closed"))
+	{
+		ApplyTournamentRemoval(TournamentId);
+		return;
+	}
+
+	// Updates carry only the fields that changed
+	const FDeskillzTournament* Cached = GetTournamentStore().Find(TournamentId);
+	if (!Cached && Message.EventType != TEXT("tournament:added"))
+	{
+		UE_LOG(LogDeskillz, Verbose, TEXT("Ignoring %s for uncached tournament %s"), *Message.EventType, *TournamentId);
+		return;
+	}
+
+	FDeskillzTournament Tournament = Cached ? *Cached : FDeskillzTournament();
+	Tournament.TournamentId = TournamentId;
+	ReadTournamentFields(Data, Tournament);
+	ApplyTournamentChange(Tournament);
+}
+
+void UDeskillzTournamentManager::ApplyTournamentChange(const FDeskillzTournament& Tournament)
+{
+	FDeskillzTournamentStore& Store = FDeskillzTournamentStore::GetMutable();
+
+	const FDeskillzTournament* Cached = Store.Find(Tournament.TournamentId);
+	const bool bStatusChanged = Cached && Cached->Status != Tournament.Status;
+
+	const FDeskillzTournamentStore::EChange Change = Store.Upsert(Tournament);
+	if (Change == FDeskillzTournamentStore::EChange::None)
+	{
+		return;
+	}
+
+	OnTournamentStateChanged.Broadcast(Tournament,
+		Change == FDeskillzTournamentStore::EChange::Added ? EDeskillzTournamentChange::Added : EDeskillzTournamentChange::Updated);
+
+	if (bStatusChanged)
+	{
+		OnTournamentStatusChanged.Broadcast(Tournament.TournamentId, Tournament.Status);
+	}
+}
+
+void UDeskillzTournamentManager::ApplyTournamentRemoval(const FString& TournamentId)
+{
+	FDeskillzTournamentStore& Store = FDeskillzTournamentStore::GetMutable();
+
+	const FDeskillzTournament* Cached = Store.Find(TournamentId);
+	if (!Cached)
+	{
+		return;
+	}
+
+	const FDeskillzTournament Removed = *Cached;
+	Store.Remove(TournamentId);
+
+	OnTournamentStateChanged.Broadcast(Removed, EDeskillzTournamentChange::Removed);
+}
+
+void UDeskillzTournamentManager::ReadTournamentFields(const TSharedPtr<FJsonObject>& Json, FDeskillzTournament& InOutTournament)
+{
+	static const TMap<FString, EDeskillzTournamentStatus> StatusByName = {
+		{ TEXT("upcoming"), EDeskillzTournamentStatus::Upcoming },
+		{ TEXT("open"), EDeskillzTournamentStatus::Open },
+		{ TEXT("in_progress"), EDeskillzTournamentStatus::InProgress },
+		{ TEXT("active"), EDeskillzTournamentStatus::InProgress },
+		{ TEXT("completed"), EDeskillzTournamentStatus::Completed },
+		{ TEXT("cancelled"), EDeskillzTournamentStatus::Cancelled }
+	};
+
+	Json->TryGetStringField(TEXT("name"), InOutTournament.Name);
+	Json->TryGetStringField(TEXT("description"), InOutTournament.Description);
+	Json->TryGetStringField(TEXT("gameId"), InOutTournament.GameId);
+
+	FString StatusName;
+	if (Json->TryGetStringField(TEXT("status"), StatusName))
+	{
+		if (const EDeskillzTournamentStatus* Status = StatusByName.Find(StatusName.ToLower()))
+		{
+			InOutTournament.Status = *Status;
+		}
+	}
+
+	double Number = 0.0;
+	if (Json->TryGetNumberField(TEXT("currentPlayers"), Number))
+	{
+		InOutTournament.CurrentPlayers = static_cast<int32>(Number);
+	}
+	if (Json->TryGetNumberField(TEXT("maxPlayers"), Number))
+	{
+		InOutTournament.MaxPlayers = static_cast<int32>(Number);
+	}
+	if (Json->TryGetNumberField(TEXT("prizePool"), Number))
+	{
+		InOutTournament.PrizePool = Number;
+	}
+	if (Json->TryGetNumberField(TEXT("entryFee"), Number))
+	{
+		InOutTournament.EntryFee.Amount = Number;
+	}
+	if (Json->TryGetNumberField(TEXT("matchDuration"), Number))
+	{
+		InOutTournament.MatchDurationSeconds = static_cast<int32>(Number);
+	}
+
+	// Times are Unix milliseconds
+	if (Json->TryGetNumberField(TEXT("startTime"), Number))
+	{
+		InOutTournament.StartTime = FDateTime::FromUnixTimestamp(static_cast<int64>(Number) / 1000);
+	}
+	if (Json->TryGetNumberField(TEXT("endTime"), Number))
+	{
+		InOutTournament.EndTime = FDateTime::FromUnixTimestamp(static_cast<int64>(Number) / 1000);
+	}
+}
+
+// ============================================================================
+// Utility
+// ============================================================================
+
+TArray<FDeskillzTournament> UDeskillzTournamentManager::GetRecommendedTournaments(int32 MaxCount) const
+{
+	// Joinable, affordable and not yet entered, soonest first
+	FDeskillzTournamentFilter Filter;
+	Filter.StatusFilter.Add(EDeskillzTournamentStatus::Open);
+	Filter.bOnlyOpenSlots = true;
+	Filter.SortBy = EDeskillzTournamentSort::StartTime;
+	Filter.bSortAscending = true;
+
+	TArray<FDeskillzTournament> Result;
+
+	GetTournamentStore().Query(Filter, [this, &Result, MaxCount](const FDeskillzTournament& Tournament)
+	{
+		if (!IsRegisteredFor(Tournament.TournamentId) && CanAffordEntry(Tournament, Tournament.EntryFee.Currency))
+		{
+			Result.Add(Tournament);
+		}
+		return MaxCount <= 0 || Result.Num() < MaxCount;
+	});
+
+	return Result;
+}
+
+TArray<FDeskillzTournament> UDeskillzTournamentManager::GetTournamentsStartingSoon(int32 WithinMinutes) const
+{
+	const FDateTime Now = FDateTime::UtcNow();
+
+	TArray<FDeskillzTournament> Result;
+
+	GetTournamentStore().ForEachStartingBetween(Now, Now + FTimespan::FromMinutes(WithinMinutes),
+		[&Result](const FDeskillzTournament& Tournament)
+		{
+			Result.Add(Tournament);
+			return true;
+		});
+
+	return Result;
+}
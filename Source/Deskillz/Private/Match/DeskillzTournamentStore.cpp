@@ -0,0 +1,434 @@
+// Copyright Deskillz Games. All Rights Reserved.
+
+#include "Match/DeskillzTournamentStore.h"
+#include "Match/DeskillzTournamentManager.h"
+
+namespace
+{
+	template<typename EnumType>
+	uint32 EnumBit(EnumType Value)
+	{
+		return 1u << static_cast<uint32>(Value);
+	}
+
+	/** Mask of the listed values (empty list = everything) */
+	template<typename EnumType>
+	uint32 EnumMask(const TArray<EnumType>& Values)
+	{
+		if (Values.Num() == 0)
+		{
+			return MAX_uint32;
+		}
+
+		uint32 Mask = 0;
+		for (EnumType Value : Values)
+		{
+			Mask |= EnumBit(Value);
+		}
+		return Mask;
+	}
+
+	bool HasTournamentChanged(const FDeskillzTournament& A, const FDeskillzTournament& B)
+	{
+		return A.CurrentPlayers != B.CurrentPlayers
+			|| A.Status != B.Status
+			|| A.PrizePool != B.PrizePool
+			|| A.MaxPlayers != B.MaxPlayers
+			|| A.StartTime != B.StartTime
+			|| A.EndTime != B.EndTime
+			|| A.EntryFee.Amount != B.EntryFee.Amount
+			|| A.EntryFee.Currency != B.EntryFee.Currency
+			|| A.MatchType != B.MatchType
+			|| A.MatchDurationSeconds != B.MatchDurationSeconds
+			|| A.Name != B.Name
+			|| A.Description != B.Description
+			|| A.GameId != B.GameId
+			|| !A.CustomRules.OrderIndependentCompareEqual(B.CustomRules);
+	}
+}
+
+const FDeskillzTournamentStore& FDeskillzTournamentStore::Get()
+{
+	return GetMutable();
+}
+
+FDeskillzTournamentStore& FDeskillzTournamentStore::GetMutable()
+{
+	static FDeskillzTournamentStore Store;
+	return Store;
+}
+
+// ============================================================================
+// Updates
+// ============================================================================
+
+FDeskillzTournamentStore::EChange FDeskillzTournamentStore::Upsert(const FDeskillzTournament& Tournament)
+{
+	if (const int32* Existing = SlotById.Find(Tournament.TournamentId))
+	{
+		const int32 SlotIndex = *Existing;
+		if (!HasTournamentChanged(Slots[SlotIndex].Tournament, Tournament))
+		{
+			return EChange::None;
+		}
+
+		// Keys may move, so re-seat the slot in every index
+		Unlink(SlotIndex);
+		Slots[SlotIndex].Tournament = Tournament;
+		SetKeys(Slots[SlotIndex]);
+		Link(SlotIndex);
+
+		SearchIndex.Update(Tournament.TournamentId, { Tournament.Name, Tournament.Description });
+		return EChange::Updated;
+	}
+
+	const int32 SlotIndex = FreeSlots.Num() > 0 ? FreeSlots.Pop() : Slots.AddDefaulted();
+	FSlot& Slot = Slots[SlotIndex];
+	Slot.Tournament = Tournament;
+	Slot.bLive = true;
+	SetKeys(Slot);
+	Link(SlotIndex);
+
+	SlotById.Add(Tournament.TournamentId, SlotIndex);
+	SearchIndex.Update(Tournament.TournamentId, { Tournament.Name, Tournament.Description });
+	return EChange::Added;
+}
+
+bool FDeskillzTournamentStore::Remove(const FString& TournamentId)
+{
+	int32 SlotIndex = INDEX_NONE;
+	if (!SlotById.RemoveAndCopyValue(TournamentId, SlotIndex))
+	{
+		return false;
+	}
+
+	Unlink(SlotIndex);
+	SearchIndex.Remove(TournamentId);
+
+	Slots[SlotIndex] = FSlot();
+	FreeSlots.Add(SlotIndex);
+	return true;
+}
+
+int32 FDeskillzTournamentStore::Sync(const TArray<FDeskillzTournament>& Tournaments, TArray<FString>* OutRemovedIds)
+{
+	int32 NumChanged = 0;
+
+	TSet<FString> ListedIds;
+	ListedIds.Reserve(Tournaments.Num());
+	for (const FDeskillzTournament& Tournament : Tournaments)
+	{
+		ListedIds.Add(Tournament.TournamentId);
+		if (Upsert(Tournament) != EChange::None)
+		{
+			++NumChanged;
+		}
+	}
+
+	TArray<FString> RemovedIds;
+	for (const TPair<FString, int32>& Pair : SlotById)
+	{
+		if (!ListedIds.Contains(Pair.Key))
+		{
+			RemovedIds.Add(Pair.Key);
+		}
+	}
+
+	for (const FString& Id : RemovedIds)
+	{
+		Remove(Id);
+	}
+
+	if (OutRemovedIds)
+	{
+		*OutRemovedIds = MoveTemp(RemovedIds);
+	}
+
+	return NumChanged;
+}
+
+void FDeskillzTournamentStore::Reset()
+{
+	Slots.Empty();
+	FreeSlots.Empty();
+	SlotById.Empty();
+	for (TArray<int32>& Order : Sorted)
+	{
+		Order.Empty();
+	}
+	SearchIndex.Reset();
+}
+
+// ============================================================================
+// Indexes
+// ============================================================================
+
+FDeskillzTournamentStore::ESortIndex FDeskillzTournamentStore::GetSortIndex(EDeskillzTournamentSort SortBy)
+{
+	switch (SortBy)
+	{
+	case EDeskillzTournamentSort::PrizePool:
+		return ByPrizePool;
+	case EDeskillzTournamentSort::EntryFee:
+		return ByEntryFee;
+	case EDeskillzTournamentSort::PlayerCount:
+	case EDeskillzTournamentSort::Popularity:
+		return ByPlayerCount;
+	case EDeskillzTournamentSort::StartTime:
+	default:
+		return ByStartTime;
+	}
+}
+
+void FDeskillzTournamentStore::SetKeys(FSlot& Slot) const
+{
+	const FDeskillzTournament& Tournament = Slot.Tournament;
+	Slot.StartTicks = Tournament.StartTime.GetTicks();
+	Slot.PrizePool = Tournament.PrizePool;
+	Slot.EntryFee = Tournament.EntryFee.Amount;
+	Slot.PlayerCount = Tournament.CurrentPlayers;
+	Slot.StatusBit = EnumBit(Tournament.Status);
+	Slot.MatchTypeBit = EnumBit(Tournament.MatchType);
+	Slot.CurrencyBit = EnumBit(Tournament.EntryFee.Currency);
+}
+
+bool FDeskillzTournamentStore::IsBefore(ESortIndex Index, int32 SlotA, int32 SlotB) const
+{
+	const FSlot& A = Slots[SlotA];
+	const FSlot& B = Slots[SlotB];
+
+	switch (Index)
+	{
+	case ByStartTime:
+		if (A.StartTicks != B.StartTicks)
+		{
+			return A.StartTicks < B.StartTicks;
+		}
+		break;
+	case ByPrizePool:
+		if (A.PrizePool != B.PrizePool)
+		{
+			return A.PrizePool < B.PrizePool;
+		}
+		break;
+	case ByEntryFee:
+		if (A.EntryFee != B.EntryFee)
+		{
+			return A.EntryFee < B.EntryFee;
+		}
+		break;
+	case ByPlayerCount:
+		if (A.PlayerCount != B.PlayerCount)
+		{
+			return A.PlayerCount < B.PlayerCount;
+		}
+		break;
+	default:
+		break;
+	}
+
+	return SlotA < SlotB;
+}
+
+int32 FDeskillzTournamentStore::LowerBound(ESortIndex Index, int32 Slot) const
+{
+	const TArray<int32>& Order = Sorted[Index];
+
+	int32 Low = 0;
+	int32 High = Order.Num();
+	while (Low < High)
+	{
+		const int32 Mid = Low + (High - Low) / 2;
+		if (IsBefore(Index, Order[Mid], Slot))
+		{
+			Low = Mid + 1;
+		}
+		else
+		{
+			High = Mid;
+		}
+	}
+	return Low;
+}
+
+void FDeskillzTournamentStore::Link(int32 Slot)
+{
+	for (uint8 Index = 0; Index < SortIndexCount; Index++)
+	{
+		const ESortIndex SortIndex = static_cast<ESortIndex>(Index);
+		Sorted[Index].Insert(Slot, LowerBound(SortIndex, Slot));
+	}
+}
+
+void FDeskillzTournamentStore::Unlink(int32 Slot)
+{
+	for (uint8 Index = 0; Index < SortIndexCount; Index++)
+	{
+		const ESortIndex SortIndex = static_cast<ESortIndex>(Index);
+		const int32 Position = LowerBound(SortIndex, Slot);
+		if (Sorted[Index].IsValidIndex(Position) && Sorted[Index][Position] == Slot)
+		{
+			Sorted[Index].RemoveAt(Position);
+		}
+	}
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+const FDeskillzTournament* FDeskillzTournamentStore::Find(const FString& TournamentId) const
+{
+	const int32* SlotIndex = SlotById.Find(TournamentId);
+	return SlotIndex ? &Slots[*SlotIndex].Tournament : nullptr;
+}
+
+void FDeskillzTournamentStore::Query(const FDeskillzTournamentFilter& Filter, FVisitor Visitor) const
+{
+	const uint32 StatusMask = EnumMask(Filter.StatusFilter);
+	const uint32 MatchTypeMask = EnumMask(Filter.MatchTypeFilter);
+	const uint32 CurrencyMask = EnumMask(Filter.CurrencyFilter);
+	const double MinFee = Filter.MinEntryFee;
+	const double MaxFee = Filter.MaxEntryFee > 0.0f ? Filter.MaxEntryFee : TNumericLimits<double>::Max();
+
+	TSet<FString> SearchHits;
+	const bool bSearch = !Filter.SearchText.TrimStartAndEnd().IsEmpty();
+	if (bSearch)
+	{
+		for (const FDeskillzSearchIndex::FMatch& Match : SearchIndex.Search(Filter.SearchText))
+		{
+			SearchHits.Add(Match.Id);
+		}
+		if (SearchHits.Num() == 0)
+		{
+			return;
+		}
+	}
+
+	const ESortIndex Index = GetSortIndex(Filter.SortBy);
+	const TArray<int32>& Order = Sorted[Index];
+
+	// Sorting by fee turns the fee range into the scan bounds
+	int32 Begin = 0;
+	int32 End = Order.Num();
+	if (Index == ByEntryFee)
+	{
+		auto FeeBound = [this, &Order](double Fee, bool bInclusive)
+		{
+			int32 Low = 0;
+			int32 High = Order.Num();
+			while (Low < High)
+			{
+				const int32 Mid = Low + (High - Low) / 2;
+				const double MidFee = Slots[Order[Mid]].EntryFee;
+				if (bInclusive ? MidFee <= Fee : MidFee < Fee)
+				{
+					Low = Mid + 1;
+				}
+				else
+				{
+					High = Mid;
+				}
+			}
+			return Low;
+		};
+
+		Begin = FeeBound(MinFee, false);
+		End = FeeBound(MaxFee, true);
+	}
+
+	auto Visit = [&](int32 SlotIndex)
+	{
+		const FSlot& Slot = Slots[SlotIndex];
+		if (!(Slot.StatusBit & StatusMask) || !(Slot.MatchTypeBit & MatchTypeMask) || !(Slot.CurrencyBit & CurrencyMask))
+		{
+			return true;
+		}
+		if (Slot.EntryFee < MinFee || Slot.EntryFee > MaxFee)
+		{
+			return true;
+		}
+		if (Filter.bOnlyOpenSlots && Slot.Tournament.IsFull())
+		{
+			return true;
+		}
+		if (bSearch && !SearchHits.Contains(Slot.Tournament.TournamentId))
+		{
+			return true;
+		}
+		return Visitor(Slot.Tournament);
+	};
+
+	if (Filter.bSortAscending)
+	{
+		for (int32 i = Begin; i < End; i++)
+		{
+			if (!Visit(Order[i]))
+			{
+				return;
+			}
+		}
+	}
+	else
+	{
+		for (int32 i = End - 1; i >= Begin; i--)
+		{
+			if (!Visit(Order[i]))
+			{
+				return;
+			}
+		}
+	}
+}
+
+TArray<FDeskillzTournament> FDeskillzTournamentStore::Query(const FDeskillzTournamentFilter& Filter, int32 MaxCount) const
+{
+	TArray<FDeskillzTournament> Result;
+	Query(Filter, [&Result, MaxCount](const FDeskillzTournament& Tournament)
+	{
+		Result.Add(Tournament);
+		return MaxCount <= 0 || Result.Num() < MaxCount;
+	});
+	return Result;
+}
+
+void FDeskillzTournamentStore::ForEachStartingBetween(const FDateTime& From, const FDateTime& To, FVisitor Visitor) const
+{
+	const TArray<int32>& Order = Sorted[ByStartTime];
+	const int64 FromTicks = From.GetTicks();
+	const int64 ToTicks = To.GetTicks();
+
+	int32 Low = 0;
+	int32 High = Order.Num();
+	while (Low < High)
+	{
+		const int32 Mid = Low + (High - Low) / 2;
+		if (Slots[Order[Mid]].StartTicks < FromTicks)
+		{
+			Low = Mid + 1;
+		}
+		else
+		{
+			High = Mid;
+		}
+	}
+
+	for (int32 i = Low; i < Order.Num() && Slots[Order[i]].StartTicks < ToTicks; i++)
+	{
+		if (!Visitor(Slots[Order[i]].Tournament))
+		{
+			return;
+		}
+	}
+}
+
+TArray<FDeskillzTournament> FDeskillzTournamentStore::ToArray() const
+{
+	TArray<FDeskillzTournament> Result;
+	Result.Reserve(Sorted[ByStartTime].Num());
+	for (int32 SlotIndex : Sorted[ByStartTime])
+	{
+		Result.Add(Slots[SlotIndex].Tournament);
+	}
+	return Result;
+}
@@ -4,6 +4,7 @@
 #include "Network/DeskillzHttpClient.h"
 #include "Network/DeskillzApiEndpoints.h"
 #include "Deskillz.h"
+#include "Core/DeskillzStats.h"
 #include "Serialization/JsonSerializer.h"
 #include "Dom/JsonObject.h"
 
@@ -667,6 +668,8 @@ void UDeskillzApiService::GetGameConfig(const FString& GameId,
 
 FDeskillzPlayerInfo UDeskillzApiService::ParseUser(const TSharedPtr<FJsonObject>& Json)
 {
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzApiParse, DeskillzNetworkChannel);
+	
 	FDeskillzPlayerInfo User;
 	
 	if (Json.IsValid())
@@ -685,6 +688,8 @@ FDeskillzPlayerInfo UDeskillzApiService::ParseUser(const TSharedPtr<FJsonObject>
 
 FDeskillzTournament UDeskillzApiService::ParseTournament(const TSharedPtr<FJsonObject>& Json)
 {
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzApiParse, DeskillzNetworkChannel);
+	
 	FDeskillzTournament Tournament;
 	
 	if (Json.IsValid())
@@ -714,6 +719,8 @@ FDeskillzTournament UDeskillzApiService::ParseTournament(const TSharedPtr<FJsonO
 
 FDeskillzMatch UDeskillzApiService::ParseMatch(const TSharedPtr<FJsonObject>& Json)
 {
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzApiParse, DeskillzNetworkChannel);
+	
 	FDeskillzMatch Match;
 	
 	if (Json.IsValid())
@@ -751,6 +758,8 @@ FDeskillzMatch UDeskillzApiService::ParseMatch(const TSharedPtr<FJsonObject>& Js
 
 FDeskillzMatchResult UDeskillzApiService::ParseMatchResult(const TSharedPtr<FJsonObject>& Json)
 {
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzApiParse, DeskillzNetworkChannel);
+	
 	FDeskillzMatchResult Result;
 	
 	if (Json.IsValid())
@@ -777,6 +786,8 @@ FDeskillzMatchResult UDeskillzApiService::ParseMatchResult(const TSharedPtr<FJso
 
 FDeskillzLeaderboardEntry UDeskillzApiService::ParseLeaderboardEntry(const TSharedPtr<FJsonObject>& Json)
 {
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzApiParse, DeskillzNetworkChannel);
+	
 	FDeskillzLeaderboardEntry Entry;
 	
 	if (Json.IsValid())
@@ -795,6 +806,8 @@ FDeskillzLeaderboardEntry UDeskillzApiService::ParseLeaderboardEntry(const TShar
 
 TMap<FString, double> UDeskillzApiService::ParseBalances(const TSharedPtr<FJsonObject>& Json)
 {
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzApiParse, DeskillzNetworkChannel);
+	
 	TMap<FString, double> Balances;
 	
 	if (Json.IsValid())
@@ -0,0 +1,432 @@
+// Copyright Deskillz Games. All Rights Reserved.
+
+#include "Network/DeskillzClockSync.h"
+#include "Network/DeskillzWebSocket.h"
+#include "Platform/DeskillzAppLifecycle.h"
+#include "Deskillz.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonReader.h"
+#include "Dom/JsonObject.h"
+#include "TimerManager.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+
+namespace
+{
+	/** Samples kept for the fit */
+	constexpr int32 SampleWindow = 32;
+
+	/** Seconds between burst samples */
+	constexpr float BurstSpacingSeconds = 0.25f;
+
+	/** Replies older than this are dropped (ms) */
+	constexpr double MaxReplyAgeMs = 10000.0;
+
+	/** Trusted samples must span this long before skew is fitted (seconds) */
+	constexpr double MinSkewSpanSeconds = 30.0;
+
+	/** Largest plausible crystal skew */
+	constexpr double MaxSkew = 500e-6;
+
+	const TCHAR* SyncEvent = TEXT("time:sync");
+}
+
+// Static singleton
+static UDeskillzClockSync* GClockSync = nullptr;
+
+UDeskillzClockSync::UDeskillzClockSync()
+{
+	Samples.SetCapacity(SampleWindow);
+
+	// Until the server answers, the wall clock is the best guess
+	const double LocalSeconds = GetLocalSeconds();
+
+	FitOffsetMs = GetWallMs() - LocalSeconds * 1000.0;
+	FitLocalSeconds = LocalSeconds;
+	AppliedOffsetMs = FitOffsetMs;
+	AppliedAtSeconds = LocalSeconds;
+}
+
+UDeskillzClockSync* UDeskillzClockSync::Get()
+{
+	if (!GClockSync)
+	{
+		GClockSync = NewObject<UDeskillzClockSync>();
+		GClockSync->AddToRoot();
+	}
+	return GClockSync;
+}
+
+// ============================================================================
+// Server Time
+// ============================================================================
+
+double UDeskillzClockSync::GetLocalSeconds()
+{
+	return FPlatformTime::Seconds();
+}
+
+double UDeskillzClockSync::GetWallMs()
+{
+	const FDateTime Now = FDateTime::UtcNow();
+	return static_cast<double>(Now.ToUnixTimestamp() * 1000 + Now.GetMillisecond());
+}
+
+int64 UDeskillzClockSync::GetServerTimeMs() const
+{
+	const double LocalSeconds = GetLocalSeconds();
+	AdvanceAppliedOffset(LocalSeconds);
+
+	const int64 Now = FMath::FloorToInt64(LocalSeconds * 1000.0 + AppliedOffsetMs);
+	LastServerTimeMs = FMath::Max(LastServerTimeMs, Now);
+	return LastServerTimeMs;
+}
+
+double UDeskillzClockSync::GetSecondsUntil(int64 ServerTimeMs) const
+{
+	return static_cast<double>(ServerTimeMs - GetServerTimeMs()) / 1000.0;
+}
+
+double UDeskillzClockSync::GetFittedOffsetMs(double LocalSeconds) const
+{
+	return FitOffsetMs + Skew * (LocalSeconds - FitLocalSeconds) * 1000.0;
+}
+
+void UDeskillzClockSync::AdvanceAppliedOffset(double LocalSeconds) const
+{
+	const double TargetMs = GetFittedOffsetMs(LocalSeconds);
+	const double ElapsedMs = FMath::Max(LocalSeconds - AppliedAtSeconds, 0.0) * 1000.0;
+	AppliedAtSeconds = LocalSeconds;
+
+	if (TargetMs >= AppliedOffsetMs)
+	{
+		// Jumping forward cannot make time run backwards
+		AppliedOffsetMs = TargetMs;
+	}
+	else
+	{
+		// Slow down instead of stepping back
+		AppliedOffsetMs = FMath::Max(TargetMs, AppliedOffsetMs - ElapsedMs * MaxSlewRate);
+	}
+}
+
+// ============================================================================
+// Estimate
+// ============================================================================
+
+void UDeskillzClockSync::AddCoarseSample(int64 ServerTimeMs)
+{
+	if (bHasRoundTrip || ServerTimeMs <= 0)
+	{
+		return;
+	}
+
+	const double LocalSeconds = GetLocalSeconds();
+	AdvanceAppliedOffset(LocalSeconds);
+
+	FitOffsetMs = static_cast<double>(ServerTimeMs) - LocalSeconds * 1000.0;
+	FitLocalSeconds = LocalSeconds;
+
+	if (!bHasEstimate)
+	{
+		// Nothing has been measured against the server yet; take it as is
+		AppliedOffsetMs = FitOffsetMs;
+		LastServerTimeMs = 0;
+		bHasEstimate = true;
+		StepEpoch++;
+	}
+
+	UE_LOG(LogDeskillz, Verbose, TEXT("Clock coarse sample, offset: %.0f ms"), FitOffsetMs);
+}
+
+void UDeskillzClockSync::UpdateEstimate()
+{
+	if (Samples.IsEmpty())
+	{
+		return;
+	}
+
+	// Queueing only ever adds delay, so the fastest round trips are the
+	// most accurate; trust the best third of the window
+	TArray<FClockSample, TInlineAllocator<SampleWindow>> Trusted;
+	Samples.ForEach([&Trusted](const FClockSample& Sample)
+	{
+		Trusted.Add(Sample);
+	});
+
+	Trusted.Sort([](const FClockSample& A, const FClockSample& B)
+	{
+		return A.RoundTripMs < B.RoundTripMs;
+	});
+
+	BestRoundTripMs = FMath::RoundToInt(Trusted[0].RoundTripMs);
+	Trusted.SetNum(FMath::Max(Trusted.Num() / 3, 1));
+
+	double MinSeconds = Trusted[0].LocalSeconds;
+	double MaxSeconds = MinSeconds;
+	for (const FClockSample& Sample : Trusted)
+	{
+		MinSeconds = FMath::Min(MinSeconds, Sample.LocalSeconds);
+		MaxSeconds = FMath::Max(MaxSeconds, Sample.LocalSeconds);
+	}
+
+	if (Trusted.Num() >= 3 && MaxSeconds - MinSeconds >= MinSkewSpanSeconds)
+	{
+		// Least-squares line of offset over local time
+		double MeanX = 0.0;
+		double MeanY = 0.0;
+		for (const FClockSample& Sample : Trusted)
+		{
+			MeanX += Sample.LocalSeconds;
+			MeanY += Sample.OffsetMs;
+		}
+		MeanX /= Trusted.Num();
+		MeanY /= Trusted.Num();
+
+		double Covariance = 0.0;
+		double Variance = 0.0;
+		for (const FClockSample& Sample : Trusted)
+		{
+			const double DX = Sample.LocalSeconds - MeanX;
+			Covariance += DX * (Sample.OffsetMs - MeanY);
+			Variance += DX * DX;
+		}
+
+		// Slope is ms per local second; skew is ms per local ms
+		Skew = FMath::Clamp(Covariance / Variance / 1000.0, -MaxSkew, MaxSkew);
+		FitOffsetMs = MeanY;
+		FitLocalSeconds = MeanX;
+	}
+	else
+	{
+		// Too little history for a slope; anchor on the best sample
+		FitOffsetMs = Trusted[0].OffsetMs;
+		FitLocalSeconds = Trusted[0].LocalSeconds;
+	}
+}
+
+// ============================================================================
+// Sync
+// ============================================================================
+
+void UDeskillzClockSync::StartSync()
+{
+	if (bSyncing)
+	{
+		return;
+	}
+
+	UDeskillzWebSocket* Socket = UDeskillzWebSocket::Get();
+	if (!Socket)
+	{
+		return;
+	}
+
+	bSyncing = true;
+
+	Socket->SubscribeToEvent(SyncEvent,
+		FOnDeskillzWSMessageNative::CreateUObject(this, &UDeskillzClockSync::HandleSyncResponse));
+	Socket->OnConnected.AddUniqueDynamic(this, &UDeskillzClockSync::HandleSocketConnected);
+
+	UDeskillzAppLifecycle* Lifecycle = UDeskillzAppLifecycle::Get();
+	Lifecycle->Initialize();
+	Lifecycle->OnAppWillEnterBackground.AddUniqueDynamic(this, &UDeskillzClockSync::HandleAppWillEnterBackground);
+	Lifecycle->OnAppDidEnterForeground.AddUniqueDynamic(this, &UDeskillzClockSync::HandleAppDidEnterForeground);
+
+	if (Socket->IsConnected())
+	{
+		HandleSocketConnected();
+	}
+
+	UE_LOG(LogDeskillz, Log, TEXT("Clock sync started"));
+}
+
+void UDeskillzClockSync::StopSync()
+{
+	if (!bSyncing)
+	{
+		return;
+	}
+
+	bSyncing = false;
+	BurstRemaining = 0;
+
+	if (UDeskillzWebSocket* Socket = UDeskillzWebSocket::Get())
+	{
+		Socket->UnsubscribeFromEvent(SyncEvent);
+		Socket->OnConnected.RemoveDynamic(this, &UDeskillzClockSync::HandleSocketConnected);
+	}
+
+	UDeskillzAppLifecycle* Lifecycle = UDeskillzAppLifecycle::Get();
+	Lifecycle->OnAppWillEnterBackground.RemoveDynamic(this, &UDeskillzClockSync::HandleAppWillEnterBackground);
+	Lifecycle->OnAppDidEnterForeground.RemoveDynamic(this, &UDeskillzClockSync::HandleAppDidEnterForeground);
+
+	if (UWorld* World = GEngine ? GEngine->GetCurrentPlayWorld() : nullptr)
+	{
+		World->GetTimerManager().ClearTimer(SyncTimerHandle);
+	}
+
+	UE_LOG(LogDeskillz, Log, TEXT("Clock sync stopped"));
+}
+
+void UDeskillzClockSync::RequestSample()
+{
+	UDeskillzWebSocket* Socket = UDeskillzWebSocket::Get();
+	if (!Socket || !Socket->IsConnected())
+	{
+		return;
+	}
+
+	TSharedPtr<FJsonObject> Data = MakeShareable(new FJsonObject());
+	Data->SetNumberField(TEXT("t0"), GetLocalSeconds() * 1000.0);
+
+	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject());
+	JsonObject->SetStringField(TEXT("event"), SyncEvent);
+	JsonObject->SetObjectField(TEXT("data"), Data);
+
+	Socket->SendJsonObject(JsonObject);
+}
+
+void UDeskillzClockSync::HandleSocketConnected()
+{
+	// Network path may have changed; measure it again
+	BurstRemaining = FMath::Max(BurstSampleCount, 1);
+	SendScheduledSample();
+}
+
+void UDeskillzClockSync::HandleAppWillEnterBackground()
+{
+	BackgroundWallMs = GetWallMs();
+	BackgroundLocalSeconds = GetLocalSeconds();
+}
+
+void UDeskillzClockSync::HandleAppDidEnterForeground()
+{
+	// Activation and resume both report the foreground; bridge once
+	if (BackgroundWallMs <= 0.0)
+	{
+		return;
+	}
+
+	const double LocalSeconds = GetLocalSeconds();
+	AdvanceAppliedOffset(LocalSeconds);
+
+	// The local clock stood still while the device slept; the wall clock did not
+	const double SleptMs = (GetWallMs() - BackgroundWallMs) - (LocalSeconds - BackgroundLocalSeconds) * 1000.0;
+	BackgroundWallMs = 0.0;
+
+	if (SleptMs > 0.0)
+	{
+		FitOffsetMs += SleptMs;
+		AppliedOffsetMs += SleptMs;
+	}
+
+	// Samples from before sleep are against the old local timeline. The bridge
+	// trusts the device clock, so it stays provisional until a round trip; the
+	// epoch is left alone so pace checks see a device clock changed meanwhile.
+	Samples.Reset();
+	bStepOnNextSample = bHasRoundTrip;
+
+	UE_LOG(LogDeskillz, Log, TEXT("Clock resumed from background, bridged %.0f ms asleep"), FMath::Max(SleptMs, 0.0));
+
+	if (bSyncing)
+	{
+		HandleSocketConnected();
+	}
+}
+
+void UDeskillzClockSync::SendScheduledSample()
+{
+	if (!bSyncing)
+	{
+		return;
+	}
+
+	if (BurstRemaining > 0)
+	{
+		BurstRemaining--;
+	}
+
+	RequestSample();
+	ScheduleNextSample();
+}
+
+void UDeskillzClockSync::ScheduleNextSample()
+{
+	if (UWorld* World = GEngine ? GEngine->GetCurrentPlayWorld() : nullptr)
+	{
+		World->GetTimerManager().SetTimer(
+			SyncTimerHandle,
+			this,
+			&UDeskillzClockSync::SendScheduledSample,
+			BurstRemaining > 0 ? BurstSpacingSeconds : SyncIntervalSeconds,
+			false
+		);
+	}
+}
+
+void UDeskillzClockSync::HandleSyncResponse(const FDeskillzWebSocketMessage& Message)
+{
+	const double T3 = GetLocalSeconds() * 1000.0;
+
+	TSharedPtr<FJsonObject> Json;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Message.Data);
+	if (!FJsonSerializer::Deserialize(Reader, Json) || !Json.IsValid())
+	{
+		return;
+	}
+
+	const TSharedPtr<FJsonObject>* DataObject = nullptr;
+	if (!Json->TryGetObjectField(TEXT("data"), DataObject))
+	{
+		return;
+	}
+
+	double T0 = 0.0;
+	double T1 = 0.0;
+	double T2 = 0.0;
+	if (!(*DataObject)->TryGetNumberField(TEXT("t0"), T0) ||
+		!(*DataObject)->TryGetNumberField(TEXT("t1"), T1) ||
+		!(*DataObject)->TryGetNumberField(TEXT("t2"), T2))
+	{
+		return;
+	}
+
+	// t0 is our own clock echoed back; anything else is not our request
+	if (T0 > T3 || T3 - T0 > MaxReplyAgeMs)
+	{
+		return;
+	}
+
+	FClockSample Sample;
+	Sample.LocalSeconds = T3 / 1000.0;
+	Sample.OffsetMs = ((T1 - T0) + (T2 - T3)) / 2.0;
+	Sample.RoundTripMs = FMath::Max((T3 - T0) - (T2 - T1), 0.0);
+	Samples.Push(Sample);
+
+	// Bring the applied offset up to now before the fit moves under it
+	AdvanceAppliedOffset(Sample.LocalSeconds);
+	UpdateEstimate();
+
+	if (!bHasRoundTrip || bStepOnNextSample)
+	{
+		// First real measurement replaces the wall-clock guess or sleep bridge
+		// outright, even backwards. Only the guess is a new reference: the
+		// bridge was a continuation of a measured timeline.
+		if (!bHasRoundTrip)
+		{
+			StepEpoch++;
+		}
+		AppliedOffsetMs = GetFittedOffsetMs(Sample.LocalSeconds);
+		LastServerTimeMs = 0;
+		bHasRoundTrip = true;
+		bHasEstimate = true;
+		bStepOnNextSample = false;
+
+		UE_LOG(LogDeskillz, Log, TEXT("Clock synced, offset: %.0f ms, RTT: %.0f ms"),
+			Sample.OffsetMs, Sample.RoundTripMs);
+	}
+
+	UE_LOG(LogDeskillz, Verbose, TEXT("Clock sample: offset %.1f ms, RTT %.1f ms, best RTT %d ms, skew %.1f ppm"),
+		Sample.OffsetMs, Sample.RoundTripMs, BestRoundTripMs, GetSkewPpm());
+}
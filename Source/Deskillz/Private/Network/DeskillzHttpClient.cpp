@@ -2,6 +2,8 @@
 
 #include "Network/DeskillzHttpClient.h"
 #include "Deskillz.h"
+#include "Core/DeskillzStats.h"
+#include "Analytics/DeskillzTelemetry.h"
 #include "HttpModule.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
@@ -259,11 +261,47 @@ int32 UDeskillzHttpClient::GetPendingRequestCount() const
 void UDeskillzHttpClient::ClearCache()
 {
 	ResponseCache.Empty();
+	ResponseCacheBytes = 0;
 	UE_LOG(LogDeskillz, Log, TEXT("HTTP response cache cleared"));
 }
 
+void UDeskillzHttpClient::TrimCache(int64 MaxBytes)
+{
+	if (ResponseCacheBytes <= MaxBytes)
+	{
+		return;
+	}
+	
+	// Order by expiry so expired and soon-to-expire entries are evicted first
+	TArray<TPair<double, FString>> ByExpiry;
+	ByExpiry.Reserve(ResponseCache.Num());
+	for (const auto& Pair : ResponseCache)
+	{
+		ByExpiry.Add(TPair<double, FString>(Pair.Value.Value, Pair.Key));
+	}
+	ByExpiry.Sort([](const TPair<double, FString>& A, const TPair<double, FString>& B)
+	{
+		return A.Key < B.Key;
+	});
+	
+	const int64 StartBytes = ResponseCacheBytes;
+	for (const TPair<double, FString>& Entry : ByExpiry)
+	{
+		if (ResponseCacheBytes <= MaxBytes)
+		{
+			break;
+		}
+		RemoveCachedResponse(Entry.Value);
+	}
+	
+	UE_LOG(LogDeskillz, Log, TEXT("HTTP cache trimmed %lld -> %lld bytes"), StartBytes, ResponseCacheBytes);
+}
+
 bool UDeskillzHttpClient::ParseJsonResponse(const FDeskillzHttpResponse& Response, TSharedPtr<FJsonObject>& OutJson)
 {
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzJsonParse, DeskillzNetworkChannel);
+	DESKILLZ_SCOPED_ACTIVITY(JsonParse);
+	
 	if (!Response.IsOk() || Response.Body.IsEmpty())
 	{
 		return false;
@@ -276,6 +314,9 @@ bool UDeskillzHttpClient::ParseJsonResponse(const FDeskillzHttpResponse& Respons
 bool UDeskillzHttpClient::ParseJsonArrayResponse(const FDeskillzHttpResponse& Response, 
 	TArray<TSharedPtr<FJsonValue>>& OutArray)
 {
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzJsonParse, DeskillzNetworkChannel);
+	DESKILLZ_SCOPED_ACTIVITY(JsonParse);
+	
 	if (!Response.IsOk() || Response.Body.IsEmpty())
 	{
 		return false;
@@ -385,6 +426,10 @@ TSharedRef<IHttpRequest, ESPMode::ThreadSafe> UDeskillzHttpClient::CreateHttpReq
 void UDeskillzHttpClient::HandleHttpResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, 
 	bool bSuccess, FString RequestId)
 {
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzHttpResponse, DeskillzNetworkChannel);
+	DESKILLZ_SCOPED_ACTIVITY(HttpCompletion);
+	LLM_SCOPE_BYTAG(Deskillz_Network);
+	
 	// Build response struct
 	FDeskillzHttpResponse DeskillzResponse;
 	DeskillzResponse.RequestId = RequestId;
@@ -442,7 +487,7 @@ bool UDeskillzHttpClient::GetCachedResponse(const FString& CacheKey, FDeskillzHt
 		else
 		{
 			// Expired
-			ResponseCache.Remove(CacheKey);
+			RemoveCachedResponse(CacheKey);
 		}
 	}
 	
@@ -451,8 +496,36 @@ bool UDeskillzHttpClient::GetCachedResponse(const FString& CacheKey, FDeskillzHt
 
 void UDeskillzHttpClient::CacheResponse(const FString& CacheKey, const FDeskillzHttpResponse& Response, float TTL)
 {
+	LLM_SCOPE_BYTAG(Deskillz_Network);
+	
+	RemoveCachedResponse(CacheKey);
+	
 	double ExpireTime = FPlatformTime::Seconds() + TTL;
 	ResponseCache.Add(CacheKey, TPair<FDeskillzHttpResponse, double>(Response, ExpireTime));
+	ResponseCacheBytes += GetCacheEntryBytes(CacheKey, Response);
+}
+
+int64 UDeskillzHttpClient::GetCacheEntryBytes(const FString& CacheKey, const FDeskillzHttpResponse& Response)
+{
+	int64 Bytes = sizeof(TPair<FDeskillzHttpResponse, double>) + CacheKey.GetAllocatedSize()
+		+ Response.Body.GetAllocatedSize() + Response.ErrorMessage.GetAllocatedSize()
+		+ Response.RequestId.GetAllocatedSize() + Response.Headers.GetAllocatedSize();
+	
+	for (const auto& Header : Response.Headers)
+	{
+		Bytes += Header.Key.GetAllocatedSize() + Header.Value.GetAllocatedSize();
+	}
+	
+	return Bytes;
+}
+
+void UDeskillzHttpClient::RemoveCachedResponse(const FString& CacheKey)
+{
+	if (const TPair<FDeskillzHttpResponse, double>* Cached = ResponseCache.Find(CacheKey))
+	{
+		ResponseCacheBytes -= GetCacheEntryBytes(CacheKey, Cached->Key);
+		ResponseCache.Remove(CacheKey);
+	}
 }
 
 FString UDeskillzHttpClient::GenerateCacheKey(const FDeskillzHttpRequest& Request) const
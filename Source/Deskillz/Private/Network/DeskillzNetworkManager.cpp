@@ -3,6 +3,7 @@
 #include "Network/DeskillzNetworkManager.h"
 #include "Network/DeskillzHttpClient.h"
 #include "Network/DeskillzWebSocket.h"
+#include "Network/DeskillzClockSync.h"
 #include "Network/DeskillzApiEndpoints.h"
 #include "Deskillz.h"
 #include "TimerManager.h"
@@ -56,6 +57,9 @@ void UDeskillzNetworkManager::Initialize(const FDeskillzNetworkConfig& InConfig)
 	WebSocketClient->OnConnected.AddDynamic(this, &UDeskillzNetworkManager::OnWebSocketConnected);
 	WebSocketClient->OnDisconnected.AddDynamic(this, &UDeskillzNetworkManager::OnWebSocketDisconnected);
 	
+	// Sample the server clock on every connect
+	UDeskillzClockSync::Get()->StartSync();
+	
 	bIsInitialized = true;
 	SetNetworkState(EDeskillzNetworkState::Offline);
 	
@@ -75,6 +79,7 @@ void UDeskillzNetworkManager::InitializeDefault()
 void UDeskillzNetworkManager::Shutdown()
 {
 	StopNetworkMonitoring();
+	UDeskillzClockSync::Get()->StopSync();
 	
 	if (UWorld* World = GEngine ? GEngine->GetCurrentPlayWorld() : nullptr)
 	{
@@ -2,6 +2,10 @@
 
 #include "Network/DeskillzWebSocket.h"
 #include "Deskillz.h"
+#include "Core/DeskillzStats.h"
+#include "Core/DeskillzConfig.h"
+#include "Network/DeskillzClockSync.h"
+#include "Analytics/DeskillzTelemetry.h"
 #include "WebSocketsModule.h"
 #include "IWebSocket.h"
 #include "Serialization/JsonSerializer.h"
@@ -30,6 +34,11 @@ UDeskillzWebSocket* UDeskillzWebSocket::Get()
 	{
 		GWebSocket = NewObject<UDeskillzWebSocket>();
 		GWebSocket->AddToRoot();
+		
+		if (const UDeskillzConfig* Config = UDeskillzConfig::Get())
+		{
+			GWebSocket->ReplayFilter.Configure(Config->ReplayFilterCapacity, Config->ReplayWindowSeconds);
+		}
 	}
 	return GWebSocket;
 }
@@ -315,13 +324,45 @@ void UDeskillzWebSocket::HandleError(const FString& Error)
 
 void UDeskillzWebSocket::HandleMessage(const FString& Message)
 {
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzWebSocketHandleMessage, DeskillzNetworkChannel);
+	
 	FDeskillzWebSocketMessage WSMessage;
 	WSMessage.Type = EDeskillzMessageType::Text;
 	WSMessage.Data = Message;
-	WSMessage.Timestamp = FDateTime::UtcNow().ToUnixTimestamp() * 1000;
 	
-	// Try to parse as JSON
+	// Try to parse as JSON (sets Timestamp only if the server sent one)
 	ParseMessageJson(Message, WSMessage);
+	const bool bHasServerTimestamp = WSMessage.Timestamp != 0;
+	if (!bHasServerTimestamp)
+	{
+		WSMessage.Timestamp = FDateTime::UtcNow().ToUnixTimestamp() * 1000;
+	}
+	
+	// Drop replayed server messages. The filter forgets nonces after its
+	// window or capacity, so the message's own timestamp must be in the window too
+	if (!WSMessage.Nonce.IsEmpty())
+	{
+		if (!bHasServerTimestamp)
+		{
+			UE_LOG(LogDeskillz, Warning, TEXT("WebSocket dropped message with a nonce but no timestamp (event: %s)"), *WSMessage.EventType);
+			return;
+		}
+		
+		const int64 WindowMs = static_cast<int64>(ReplayFilter.GetWindowSeconds() * 1000.0);
+		const int64 AgeMs = UDeskillzClockSync::Get()->GetServerTimeMs() - WSMessage.Timestamp;
+		if (AgeMs > WindowMs || AgeMs < -WindowMs)
+		{
+			UE_LOG(LogDeskillz, Warning, TEXT("WebSocket dropped message outside the replay window (event: %s, age %lld ms)"),
+				*WSMessage.EventType, AgeMs);
+			return;
+		}
+		
+		if (!ReplayFilter.CheckAndInsert(FDeskillzReplayFilter::HashNonce(WSMessage.Nonce), FPlatformTime::Seconds()))
+		{
+			UE_LOG(LogDeskillz, Warning, TEXT("WebSocket dropped replayed message (event: %s)"), *WSMessage.EventType);
+			return;
+		}
+	}
 	
 	// Handle ping/pong
 	if (WSMessage.EventType == TEXT("pong"))
@@ -351,6 +392,9 @@ void UDeskillzWebSocket::HandleBinaryMessage(const void* Data, SIZE_T Size, bool
 
 bool UDeskillzWebSocket::ParseMessageJson(const FString& Message, FDeskillzWebSocketMessage& OutMessage)
 {
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzJsonParse, DeskillzNetworkChannel);
+	DESKILLZ_SCOPED_ACTIVITY(JsonParse);
+	
 	TSharedPtr<FJsonObject> JsonObject;
 	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Message);
 	
@@ -369,6 +413,9 @@ bool UDeskillzWebSocket::ParseMessageJson(const FString& Message, FDeskillzWebSo
 		OutMessage.EventType = JsonObject->GetStringField(TEXT("type"));
 	}
 	
+	// Extract nonce
+	JsonObject->TryGetStringField(TEXT("nonce"), OutMessage.Nonce);
+	
 	// Extract timestamp
 	if (JsonObject->HasField(TEXT("timestamp")))
 	{
@@ -114,6 +114,10 @@ void UDeskillzAppLifecycle::RegisterPlatformDelegates()
 	TerminateHandle = FCoreDelegates::ApplicationWillTerminateDelegate.AddUObject(
 		this, &UDeskillzAppLifecycle::OnApplicationWillTerminate);
 	
+	// Low memory warning
+	LowMemoryHandle = FCoreDelegates::GetMemoryTrimDelegate().AddUObject(
+		this, &UDeskillzAppLifecycle::OnApplicationLowMemory);
+	
 	UE_LOG(LogDeskillz, Verbose, TEXT("Platform lifecycle delegates registered"));
 }
 
@@ -124,6 +128,7 @@ void UDeskillzAppLifecycle::UnregisterPlatformDelegates()
 	FCoreDelegates::ApplicationWillDeactivateDelegate.Remove(SuspendHandle);
 	FCoreDelegates::ApplicationHasReactivatedDelegate.Remove(ResumeHandle);
 	FCoreDelegates::ApplicationWillTerminateDelegate.Remove(TerminateHandle);
+	FCoreDelegates::GetMemoryTrimDelegate().Remove(LowMemoryHandle);
 	
 	UE_LOG(LogDeskillz, Verbose, TEXT("Platform lifecycle delegates unregistered"));
 }
@@ -251,6 +256,12 @@ void UDeskillzAppLifecycle::OnApplicationWillTerminate()
 	}
 }
 
+void UDeskillzAppLifecycle::OnApplicationLowMemory()
+{
+	UE_LOG(LogDeskillz, Warning, TEXT("Application low memory warning"));
+	OnAppLowMemory.Broadcast();
+}
+
 int64 UDeskillzAppLifecycle::GetCurrentTimestamp() const
 {
 	return FDateTime::UtcNow().ToUnixTimestamp() * 1000;
@@ -1,10 +1,12 @@
 // Copyright Deskillz Games. All Rights Reserved.
 
 #include "DeskillzRoomClient.h"
+#include "Core/DeskillzStats.h"
 #include "DeskillzSDK.h"
 #include "DeskillzConfig.h"
 #include "HttpModule.h"
 #include "Interfaces/IHttpResponse.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
 #include "WebSocketsModule.h"
 #include "IWebSocket.h"
 #include "Dom/JsonObject.h"
@@ -22,6 +24,28 @@ const int32 UDeskillzRoomClient::MaxReconnectAttempts = 5;
 const float UDeskillzRoomClient::ReconnectDelay = 2.0f;
 const FString UDeskillzRoomClient::RoomsEndpoint = TEXT("/api/v1/private-rooms");
 
+/** Map a server status string (e.g. IN_PROGRESS) to ERoomStatus */
+static bool ParseRoomStatus(const FString& Value, ERoomStatus& OutStatus)
+{
+	static const TMap<FString, ERoomStatus> StatusNames = {
+		{ TEXT("WAITING"), ERoomStatus::Waiting },
+		{ TEXT("READY_CHECK"), ERoomStatus::ReadyCheck },
+		{ TEXT("COUNTDOWN"), ERoomStatus::Countdown },
+		{ TEXT("LAUNCHING"), ERoomStatus::Launching },
+		{ TEXT("IN_PROGRESS"), ERoomStatus::InProgress },
+		{ TEXT("COMPLETED"), ERoomStatus::Completed },
+		{ TEXT("CANCELLED"), ERoomStatus::Cancelled },
+		{ TEXT("EXPIRED"), ERoomStatus::Expired }
+	};
+
+	if (const ERoomStatus* Status = StatusNames.Find(Value.ToUpper()))
+	{
+		OutStatus = *Status;
+		return true;
+	}
+	return false;
+}
+
 // =============================================================================
 // Constructor
 // =============================================================================
@@ -44,6 +68,9 @@ void UDeskillzRoomClient::Initialize()
 		return;
 	}
 
+	// Build the event table up front rather than on the first message
+	GetBuiltInEventHandlers();
+
 	bIsInitialized = true;
 	UE_LOG(LogTemp, Log, TEXT("[DeskillzRoomClient] Initialized"));
 }
@@ -249,6 +276,110 @@ void UDeskillzRoomClient::GetPublicRooms(
 	Request->ProcessRequest();
 }
 
+void UDeskillzRoomClient::GetPublicRoomsPage(
+	const FString& GameId,
+	const FRoomListQuery& Query,
+	FOnRoomPageSuccess OnSuccess,
+	FOnRoomError OnError)
+{
+	static const TCHAR* SortKeys[] = { TEXT("newest"), TEXT("entryFee"), TEXT("entryFee"), TEXT("players"), TEXT("players") };
+	static const TCHAR* SortOrders[] = { TEXT("desc"), TEXT("asc"), TEXT("desc"), TEXT("asc"), TEXT("desc") };
+	const int32 SortIndex = FMath::Clamp(static_cast<int32>(Query.Sort), 0, static_cast<int32>(UE_ARRAY_COUNT(SortKeys)) - 1);
+
+	FString Endpoint = FString::Printf(TEXT("%s?gameId=%s&limit=%d&sort=%s&order=%s"),
+		*RoomsEndpoint, *FGenericPlatformHttp::UrlEncode(GameId), FMath::Clamp(Query.Limit, 1, 100),
+		SortKeys[SortIndex], SortOrders[SortIndex]);
+
+	if (!Query.Search.IsEmpty())
+	{
+		Endpoint += TEXT("&search=") + FGenericPlatformHttp::UrlEncode(Query.Search);
+	}
+	if (!Query.Cursor.IsEmpty())
+	{
+		Endpoint += TEXT("&cursor=") + FGenericPlatformHttp::UrlEncode(Query.Cursor);
+	}
+	if (Query.SinceVersion > 0)
+	{
+		Endpoint += FString::Printf(TEXT("&sinceVersion=%lld"), Query.SinceVersion);
+	}
+
+	TSharedRef<IHttpRequest> Request = CreateRequest(TEXT("GET"), Endpoint);
+
+	Request->OnProcessRequestComplete().BindLambda([this, OnSuccess, OnError](FHttpRequestPtr Req, FHttpResponsePtr Res, bool bSuccess)
+	{
+		if (!bSuccess || !Res.IsValid())
+		{
+			OnError.ExecuteIfBound(FRoomError(FRoomError::NetworkError, TEXT("Network error")));
+			return;
+		}
+
+		if (Res->GetResponseCode() < 200 || Res->GetResponseCode() >= 300)
+		{
+			OnError.ExecuteIfBound(ParseError(Res));
+			return;
+		}
+
+		FRoomListPage Page;
+		if (!ParseRoomListPage(Res->GetContentAsString(), Page))
+		{
+			OnError.ExecuteIfBound(FRoomError(FRoomError::ServerError, TEXT("Invalid response format")));
+			return;
+		}
+
+		OnSuccess.ExecuteIfBound(Page);
+	});
+
+	Request->ProcessRequest();
+}
+
+bool UDeskillzRoomClient::ParseRoomListPage(const FString& Content, FRoomListPage& OutPage) const
+{
+	OutPage = FRoomListPage();
+	const TArray<TSharedPtr<FJsonValue>>* RoomsArray = nullptr;
+
+	// Paged servers answer with an object; older ones with the full room array
+	TSharedPtr<FJsonValue> JsonRoot;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Content);
+	if (!FJsonSerializer::Deserialize(Reader, JsonRoot) || !JsonRoot.IsValid())
+	{
+		return false;
+	}
+
+	if (JsonRoot->Type == EJson::Object)
+	{
+		const TSharedPtr<FJsonObject> PageObject = JsonRoot->AsObject();
+		PageObject->TryGetArrayField(TEXT("rooms"), RoomsArray);
+		PageObject->TryGetStringArrayField(TEXT("removed"), OutPage.RemovedRoomIds);
+		PageObject->TryGetStringField(TEXT("nextCursor"), OutPage.NextCursor);
+		PageObject->TryGetBoolField(TEXT("delta"), OutPage.bIsDelta);
+
+		double Version = 0.0;
+		if (PageObject->TryGetNumberField(TEXT("version"), Version))
+		{
+			OutPage.Version = static_cast<int64>(Version);
+		}
+		OutPage.bServerQueried = true;
+	}
+	else if (JsonRoot->Type == EJson::Array)
+	{
+		RoomsArray = &JsonRoot->AsArray();
+	}
+
+	if (RoomsArray)
+	{
+		OutPage.Rooms.Reserve(RoomsArray->Num());
+		for (const TSharedPtr<FJsonValue>& JsonValue : *RoomsArray)
+		{
+			if (JsonValue->Type == EJson::Object)
+			{
+				OutPage.Rooms.Add(ParseRoom(JsonValue->AsObject()));
+			}
+		}
+	}
+
+	return true;
+}
+
 void UDeskillzRoomClient::GetMyRooms(
 	FOnRoomListSuccess OnSuccess,
 	FOnRoomError OnError)
@@ -681,6 +812,18 @@ FPrivateRoom UDeskillzRoomClient::ParseRoom(const TSharedPtr<FJsonObject>& JsonO
 	Room.CurrentPlayers = JsonObject->GetIntegerField(TEXT("currentPlayers"));
 	Room.bInviteRequired = JsonObject->GetBoolField(TEXT("inviteRequired"));
 
+	FString Status;
+	if (JsonObject->TryGetStringField(TEXT("status"), Status))
+	{
+		ParseRoomStatus(Status, Room.Status);
+	}
+
+	double Version = 0.0;
+	if (JsonObject->TryGetNumberField(TEXT("version"), Version))
+	{
+		Room.Version = static_cast<int64>(Version);
+	}
+
 	// Parse host
 	const TSharedPtr<FJsonObject>* HostObj;
 	if (JsonObject->TryGetObjectField(TEXT("host"), HostObj))
@@ -711,6 +854,7 @@ FPrivateRoom UDeskillzRoomClient::ParseRoom(const TSharedPtr<FJsonObject>& JsonO
 			}
 		}
 	}
+	Room.RebuildPlayerIndex();
 
 	return Room;
 }
@@ -733,6 +877,91 @@ FRoomPlayer UDeskillzRoomClient::ParsePlayer(const TSharedPtr<FJsonObject>& Json
 	return Player;
 }
 
+FRoomStatePatch UDeskillzRoomClient::ParseRoomPatch(const TSharedPtr<FJsonObject>& JsonObject) const
+{
+	FRoomStatePatch Patch;
+
+	if (!JsonObject.IsValid())
+	{
+		return Patch;
+	}
+
+	JsonObject->TryGetStringField(TEXT("roomId"), Patch.RoomId);
+
+	double Number = 0.0;
+	if (JsonObject->TryGetNumberField(TEXT("version"), Number))
+	{
+		Patch.Version = static_cast<int64>(Number);
+	}
+	if (JsonObject->TryGetNumberField(TEXT("currentPlayers"), Number))
+	{
+		Patch.CurrentPlayers = static_cast<int32>(Number);
+	}
+	if (JsonObject->TryGetNumberField(TEXT("prizePool"), Number))
+	{
+		Patch.PrizePool = static_cast<float>(Number);
+	}
+
+	FString StatusString;
+	ERoomStatus Status;
+	if (JsonObject->TryGetStringField(TEXT("status"), StatusString) && ParseRoomStatus(StatusString, Status))
+	{
+		Patch.Status = Status;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* PlayersArray;
+	if (JsonObject->TryGetArrayField(TEXT("players"), PlayersArray))
+	{
+		Patch.Players.Reserve(PlayersArray->Num());
+		for (const TSharedPtr<FJsonValue>& PlayerValue : *PlayersArray)
+		{
+			if (PlayerValue->Type == EJson::Object)
+			{
+				Patch.Players.Add(ParsePlayerPatch(PlayerValue->AsObject()));
+			}
+		}
+	}
+
+	JsonObject->TryGetStringArrayField(TEXT("removedPlayers"), Patch.RemovedPlayerIds);
+	JsonObject->TryGetBoolField(TEXT("allReady"), Patch.bAllReady);
+
+	return Patch;
+}
+
+FRoomPlayerPatch UDeskillzRoomClient::ParsePlayerPatch(const TSharedPtr<FJsonObject>& JsonObject) const
+{
+	FRoomPlayerPatch Patch;
+
+	if (!JsonObject.IsValid())
+	{
+		return Patch;
+	}
+
+	Patch.Id = JsonObject->GetStringField(TEXT("id"));
+
+	FString String;
+	if (JsonObject->TryGetStringField(TEXT("username"), String))
+	{
+		Patch.Username = String;
+	}
+	if (JsonObject->TryGetStringField(TEXT("avatarUrl"), String))
+	{
+		Patch.AvatarUrl = String;
+	}
+
+	bool bValue = false;
+	if (JsonObject->TryGetBoolField(TEXT("isReady"), bValue))
+	{
+		Patch.bIsReady = bValue;
+	}
+	if (JsonObject->TryGetBoolField(TEXT("isAdmin"), bValue))
+	{
+		Patch.bIsAdmin = bValue;
+	}
+
+	return Patch;
+}
+
 // =============================================================================
 // WebSocket Helpers
 // =============================================================================
@@ -805,73 +1034,217 @@ void UDeskillzRoomClient::HandleWebSocketError(const FString& Error)
 
 void UDeskillzRoomClient::ProcessWebSocketEvent(const FString& EventType, const TSharedPtr<FJsonObject>& Data)
 {
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzRoomEvent, DeskillzRoomsChannel);
+	
 	UE_LOG(LogTemp, Verbose, TEXT("[DeskillzRoomClient] Event: %s"), *EventType);
 
-	if (EventType == TEXT("room:state"))
+	const TMap<FName, FBuiltInEventHandler>& BuiltInHandlers = GetBuiltInEventHandlers();
+
+	// Only look names up: an event nobody registered must not grow the name table
+	const FName EventName(*EventType, FNAME_Find);
+	if (EventName.IsNone())
 	{
-		OnStateUpdate.Broadcast(ParseRoom(Data));
+		return;
 	}
-	else if (EventType == TEXT("private-room:player-joined"))
+
+	if (const FBuiltInEventHandler* Handler = BuiltInHandlers.Find(EventName))
 	{
-		OnPlayerJoined.Broadcast(ParsePlayer(Data));
+		if (Data.IsValid())
+		{
+			(this->**Handler)(Data);
+		}
+		return;
 	}
-	else if (EventType == TEXT("private-room:player-left"))
+
+	if (const FRoomEventHandler* Handler = CustomEventHandlers.Find(EventName))
 	{
-		OnPlayerLeft.Broadcast(Data->GetStringField(TEXT("id")));
+		(*Handler)(Data);
 	}
-	else if (EventType == TEXT("private-room:player-kicked"))
+}
+
+const TMap<FName, UDeskillzRoomClient::FBuiltInEventHandler>& UDeskillzRoomClient::GetBuiltInEventHandlers()
+{
+	static const TMap<FName, FBuiltInEventHandler> Handlers = {
+		{ FName(TEXT("room:state")), &UDeskillzRoomClient::HandleStateEvent },
+		{ FName(TEXT("room:patch")), &UDeskillzRoomClient::HandlePatchEvent },
+		{ FName(TEXT("private-room:player-joined")), &UDeskillzRoomClient::HandlePlayerJoinedEvent },
+		{ FName(TEXT("private-room:player-left")), &UDeskillzRoomClient::HandlePlayerLeftEvent },
+		{ FName(TEXT("private-room:player-kicked")), &UDeskillzRoomClient::HandlePlayerKickedEvent },
+		{ FName(TEXT("private-room:player-ready")), &UDeskillzRoomClient::HandlePlayerReadyEvent },
+		{ FName(TEXT("private-room:all-ready")), &UDeskillzRoomClient::HandleAllReadyEvent },
+		{ FName(TEXT("private-room:countdown-started")), &UDeskillzRoomClient::HandleCountdownStartedEvent },
+		{ FName(TEXT("private-room:countdown-tick")), &UDeskillzRoomClient::HandleCountdownTickEvent },
+		{ FName(TEXT("private-room:launching")), &UDeskillzRoomClient::HandleLaunchingEvent },
+		{ FName(TEXT("private-room:cancelled")), &UDeskillzRoomClient::HandleCancelledEvent },
+		{ FName(TEXT("private-room:kicked")), &UDeskillzRoomClient::HandleKickedEvent },
+		{ FName(TEXT("private-room:chat")), &UDeskillzRoomClient::HandleChatEvent },
+		{ FName(TEXT("error")), &UDeskillzRoomClient::HandleErrorEvent }
+	};
+	return Handlers;
+}
+
+// =============================================================================
+// Custom Events
+// =============================================================================
+
+bool UDeskillzRoomClient::RegisterEventHandler(FName EventType, FRoomEventHandler Handler)
+{
+	if (EventType.IsNone() || !Handler)
 	{
-		OnPlayerKicked.Broadcast(Data->GetStringField(TEXT("id")));
+		return false;
 	}
-	else if (EventType == TEXT("private-room:player-ready"))
+
+	if (GetBuiltInEventHandlers().Contains(EventType))
 	{
-		OnPlayerReady.Broadcast(
-			Data->GetStringField(TEXT("id")),
-			Data->GetBoolField(TEXT("isReady")),
-			Data->GetBoolField(TEXT("allReady"))
-		);
+		UE_LOG(LogTemp, Warning, TEXT("[DeskillzRoomClient] Cannot override built-in room event %s"), *EventType.ToString());
+		return false;
 	}
-	else if (EventType == TEXT("private-room:all-ready"))
+
+	CustomEventHandlers.Add(EventType, MoveTemp(Handler));
+	return true;
+}
+
+void UDeskillzRoomClient::UnregisterEventHandler(FName EventType)
+{
+	CustomEventHandlers.Remove(EventType);
+}
+
+// =============================================================================
+// Built-in Event Handlers
+// =============================================================================
+
+void UDeskillzRoomClient::HandleStateEvent(const TSharedPtr<FJsonObject>& Data)
+{
+	OnStateUpdate.Broadcast(ParseRoom(Data));
+}
+
+void UDeskillzRoomClient::HandlePatchEvent(const TSharedPtr<FJsonObject>& Data)
+{
+	OnStatePatch.Broadcast(ParseRoomPatch(Data));
+}
+
+void UDeskillzRoomClient::HandlePlayerJoinedEvent(const TSharedPtr<FJsonObject>& Data)
+{
+	if (IsSequencedEvent(Data))
 	{
-		OnAllReady.Broadcast(Data->GetIntegerField(TEXT("playerCount")));
+		FRoomStatePatch Patch;
+		Patch.Players.Add(ParsePlayerPatch(Data));
+		BroadcastSequencedPatch(Data, Patch);
 	}
-	else if (EventType == TEXT("private-room:countdown-started"))
+	else
 	{
-		OnCountdownStarted.Broadcast(Data->GetIntegerField(TEXT("countdownSeconds")));
+		OnPlayerJoined.Broadcast(ParsePlayer(Data));
 	}
-	else if (EventType == TEXT("private-room:countdown-tick"))
+}
+
+void UDeskillzRoomClient::HandlePlayerLeftEvent(const TSharedPtr<FJsonObject>& Data)
+{
+	if (IsSequencedEvent(Data))
 	{
-		OnCountdownTick.Broadcast(Data->GetIntegerField(TEXT("seconds")));
+		FRoomStatePatch Patch;
+		Patch.RemovedPlayerIds.Add(Data->GetStringField(TEXT("id")));
+		BroadcastSequencedPatch(Data, Patch);
 	}
-	else if (EventType == TEXT("private-room:launching"))
+	else
+	{
+		OnPlayerLeft.Broadcast(Data->GetStringField(TEXT("id")));
+	}
+}
+
+void UDeskillzRoomClient::HandlePlayerKickedEvent(const TSharedPtr<FJsonObject>& Data)
+{
+	if (IsSequencedEvent(Data))
 	{
-		FMatchLaunchData LaunchData;
-		LaunchData.MatchId = Data->GetStringField(TEXT("matchId"));
-		LaunchData.DeepLink = Data->GetStringField(TEXT("deepLink"));
-		LaunchData.Token = Data->GetStringField(TEXT("token"));
-		LaunchData.GameSessionId = Data->GetStringField(TEXT("gameSessionId"));
-		OnLaunching.Broadcast(LaunchData);
+		FRoomStatePatch Patch;
+		Patch.RemovedPlayerIds.Add(Data->GetStringField(TEXT("id")));
+		BroadcastSequencedPatch(Data, Patch);
 	}
-	else if (EventType == TEXT("private-room:cancelled"))
+	else
 	{
-		OnCancelled.Broadcast(Data->GetStringField(TEXT("reason")));
+		OnPlayerKicked.Broadcast(Data->GetStringField(TEXT("id")));
 	}
-	else if (EventType == TEXT("private-room:kicked"))
+}
+
+void UDeskillzRoomClient::HandlePlayerReadyEvent(const TSharedPtr<FJsonObject>& Data)
+{
+	if (IsSequencedEvent(Data))
 	{
-		OnKicked.Broadcast(Data->GetStringField(TEXT("reason")));
+		FRoomStatePatch Patch;
+		FRoomPlayerPatch& Change = Patch.Players.AddDefaulted_GetRef();
+		Change.Id = Data->GetStringField(TEXT("id"));
+		Change.bIsReady = Data->GetBoolField(TEXT("isReady"));
+		Patch.bAllReady = Data->GetBoolField(TEXT("allReady"));
+		BroadcastSequencedPatch(Data, Patch);
 	}
-	else if (EventType == TEXT("private-room:chat"))
+	else
 	{
-		OnChat.Broadcast(
+		OnPlayerReady.Broadcast(
 			Data->GetStringField(TEXT("id")),
-			Data->GetStringField(TEXT("username")),
-			Data->GetStringField(TEXT("message"))
+			Data->GetBoolField(TEXT("isReady")),
+			Data->GetBoolField(TEXT("allReady"))
 		);
 	}
-	else if (EventType == TEXT("error"))
-	{
-		OnError.Broadcast(Data->GetStringField(TEXT("message")));
-	}
+}
+
+void UDeskillzRoomClient::HandleAllReadyEvent(const TSharedPtr<FJsonObject>& Data)
+{
+	OnAllReady.Broadcast(Data->GetIntegerField(TEXT("playerCount")));
+}
+
+void UDeskillzRoomClient::HandleCountdownStartedEvent(const TSharedPtr<FJsonObject>& Data)
+{
+	OnCountdownStarted.Broadcast(Data->GetIntegerField(TEXT("countdownSeconds")));
+}
+
+void UDeskillzRoomClient::HandleCountdownTickEvent(const TSharedPtr<FJsonObject>& Data)
+{
+	OnCountdownTick.Broadcast(Data->GetIntegerField(TEXT("seconds")));
+}
+
+void UDeskillzRoomClient::HandleLaunchingEvent(const TSharedPtr<FJsonObject>& Data)
+{
+	FMatchLaunchData LaunchData;
+	LaunchData.MatchId = Data->GetStringField(TEXT("matchId"));
+	LaunchData.DeepLink = Data->GetStringField(TEXT("deepLink"));
+	LaunchData.Token = Data->GetStringField(TEXT("token"));
+	LaunchData.GameSessionId = Data->GetStringField(TEXT("gameSessionId"));
+	OnLaunching.Broadcast(LaunchData);
+}
+
+void UDeskillzRoomClient::HandleCancelledEvent(const TSharedPtr<FJsonObject>& Data)
+{
+	OnCancelled.Broadcast(Data->GetStringField(TEXT("reason")));
+}
+
+void UDeskillzRoomClient::HandleKickedEvent(const TSharedPtr<FJsonObject>& Data)
+{
+	OnKicked.Broadcast(Data->GetStringField(TEXT("reason")));
+}
+
+void UDeskillzRoomClient::HandleChatEvent(const TSharedPtr<FJsonObject>& Data)
+{
+	OnChat.Broadcast(
+		Data->GetStringField(TEXT("id")),
+		Data->GetStringField(TEXT("username")),
+		Data->GetStringField(TEXT("message"))
+	);
+}
+
+void UDeskillzRoomClient::HandleErrorEvent(const TSharedPtr<FJsonObject>& Data)
+{
+	OnError.Broadcast(Data->GetStringField(TEXT("message")));
+}
+
+bool UDeskillzRoomClient::IsSequencedEvent(const TSharedPtr<FJsonObject>& Data) const
+{
+	return Data.IsValid() && Data->HasTypedField<EJson::Number>(TEXT("version"));
+}
+
+void UDeskillzRoomClient::BroadcastSequencedPatch(const TSharedPtr<FJsonObject>& Data, FRoomStatePatch& Patch)
+{
+	Patch.Version = static_cast<int64>(Data->GetNumberField(TEXT("version")));
+	Data->TryGetStringField(TEXT("roomId"), Patch.RoomId);
+	OnStatePatch.Broadcast(Patch);
 }
 
 void UDeskillzRoomClient::SubscribeToRoom()
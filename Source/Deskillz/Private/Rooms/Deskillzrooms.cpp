@@ -1,9 +1,11 @@
 // Copyright Deskillz Games. All Rights Reserved.
 
 #include "DeskillzRooms.h"
+#include "Core/DeskillzStats.h"
 #include "DeskillzRoomClient.h"
 #include "DeskillzSDK.h"
 #include "DeskillzConfig.h"
+#include "Core/DeskillzMemoryManager.h"
 #include "Engine/GameInstance.h"
 #include "Kismet/GameplayStatics.h"
 
@@ -62,16 +64,161 @@ int32 FPrivateRoom::GetReadyPlayerCount() const
 
 const FRoomPlayer* FPrivateRoom::FindPlayer(const FString& PlayerId) const
 {
-	for (const FRoomPlayer& Player : Players)
+	const int32* Index = PlayerIndex.Find(PlayerId);
+	if (Index && Players.IsValidIndex(*Index) && Players[*Index].Id == PlayerId)
+	{
+		return &Players[*Index];
+	}
+
+	// Index is stale (Players assigned directly); fall back to a scan
+	if (Index || PlayerIndex.Num() != Players.Num())
 	{
-		if (Player.Id == PlayerId)
+		for (const FRoomPlayer& Player : Players)
 		{
-			return &Player;
+			if (Player.Id == PlayerId)
+			{
+				return &Player;
+			}
 		}
 	}
 	return nullptr;
 }
 
+FRoomPlayer* FPrivateRoom::FindPlayer(const FString& PlayerId)
+{
+	return const_cast<FRoomPlayer*>(static_cast<const FPrivateRoom*>(this)->FindPlayer(PlayerId));
+}
+
+FRoomPlayer& FPrivateRoom::AddPlayer(const FRoomPlayer& Player)
+{
+	if (FRoomPlayer* Existing = FindPlayer(Player.Id))
+	{
+		*Existing = Player;
+		return *Existing;
+	}
+
+	const int32 Index = Players.Add(Player);
+	PlayerIndex.Add(Player.Id, Index);
+	return Players[Index];
+}
+
+bool FPrivateRoom::RemovePlayer(const FString& PlayerId)
+{
+	const FRoomPlayer* Player = FindPlayer(PlayerId);
+	if (!Player)
+	{
+		return false;
+	}
+
+	// Keep roster order; only entries after the removed one shift
+	const int32 Index = static_cast<int32>(Player - Players.GetData());
+	Players.RemoveAt(Index);
+	PlayerIndex.Remove(PlayerId);
+	for (int32 i = Index; i < Players.Num(); i++)
+	{
+		PlayerIndex.Add(Players[i].Id, i);
+	}
+	return true;
+}
+
+void FPrivateRoom::RebuildPlayerIndex()
+{
+	PlayerIndex.Reset();
+	PlayerIndex.Reserve(Players.Num());
+	for (int32 i = 0; i < Players.Num(); i++)
+	{
+		PlayerIndex.Add(Players[i].Id, i);
+	}
+}
+
+// =============================================================================
+// FRoomListPage Implementation
+// =============================================================================
+
+void FRoomListPage::ApplyTo(TArray<FPrivateRoom>& InOutRooms, bool bAppend) const
+{
+	if (bIsDelta)
+	{
+		if (RemovedRoomIds.Num() > 0)
+		{
+			TSet<FString> RemovedIds(RemovedRoomIds);
+			InOutRooms.RemoveAll([&RemovedIds](const FPrivateRoom& Room)
+			{
+				return RemovedIds.Contains(Room.Id);
+			});
+		}
+
+		TMap<FString, int32> IndexById;
+		IndexById.Reserve(InOutRooms.Num());
+		for (int32 i = 0; i < InOutRooms.Num(); i++)
+		{
+			IndexById.Add(InOutRooms[i].Id, i);
+		}
+
+		for (const FPrivateRoom& Room : Rooms)
+		{
+			if (const int32* Index = IndexById.Find(Room.Id))
+			{
+				InOutRooms[*Index] = Room;
+			}
+			else
+			{
+				IndexById.Add(Room.Id, InOutRooms.Add(Room));
+			}
+		}
+	}
+	else if (bAppend)
+	{
+		// Rooms can shift across a page boundary between requests
+		TSet<FString> LoadedIds;
+		LoadedIds.Reserve(InOutRooms.Num() + Rooms.Num());
+		for (const FPrivateRoom& Room : InOutRooms)
+		{
+			LoadedIds.Add(Room.Id);
+		}
+
+		for (const FPrivateRoom& Room : Rooms)
+		{
+			bool bAlreadyLoaded = false;
+			LoadedIds.Add(Room.Id, &bAlreadyLoaded);
+			if (!bAlreadyLoaded)
+			{
+				InOutRooms.Add(Room);
+			}
+		}
+	}
+	else
+	{
+		InOutRooms = Rooms;
+	}
+}
+
+// =============================================================================
+// FRoomPlayerPatch Implementation
+// =============================================================================
+
+void FRoomPlayerPatch::ApplyTo(FRoomPlayer& Player) const
+{
+	Player.Id = Id;
+
+	if (Username.IsSet())
+	{
+		Player.Username = Username.GetValue();
+	}
+	if (AvatarUrl.IsSet())
+	{
+		Player.AvatarUrl = AvatarUrl.GetValue();
+	}
+	if (bIsReady.IsSet())
+	{
+		Player.bIsReady = bIsReady.GetValue();
+	}
+	if (bIsAdmin.IsSet())
+	{
+		Player.bIsAdmin = bIsAdmin.GetValue();
+	}
+}
+
 // =============================================================================
 // UDeskillzRooms Implementation
 // =============================================================================
@@ -79,6 +226,8 @@ const FRoomPlayer* FPrivateRoom::FindPlayer(const FString& PlayerId) const
 UDeskillzRooms::UDeskillzRooms()
 	: RoomClient(nullptr)
 	, bIsInitialized(false)
+	, bAwaitingRoomSnapshot(false)
+	, LastRoomSnapshotRequestTime(0.0)
 {
 }
 
@@ -92,6 +241,7 @@ void UDeskillzRooms::Initialize(FSubsystemCollectionBase& Collection)
 
 	// Bind WebSocket events
 	RoomClient->OnStateUpdate.AddUObject(this, &UDeskillzRooms::HandleRoomStateUpdate);
+	RoomClient->OnStatePatch.AddUObject(this, &UDeskillzRooms::HandleRoomPatch);
 	RoomClient->OnPlayerJoined.AddUObject(this, &UDeskillzRooms::HandlePlayerJoined);
 	RoomClient->OnPlayerLeft.AddUObject(this, &UDeskillzRooms::HandlePlayerLeft);
 	RoomClient->OnPlayerKicked.AddUObject(this, &UDeskillzRooms::HandlePlayerKicked);
@@ -107,6 +257,8 @@ void UDeskillzRooms::Initialize(FSubsystemCollectionBase& Collection)
 
 	bIsInitialized = true;
 
+	UDeskillzMemoryManager::Get()->SetRoomsSubsystem(this);
+
 	UE_LOG(LogTemp, Log, TEXT("[DeskillzRooms] Initialized"));
 }
 
@@ -125,6 +277,8 @@ void UDeskillzRooms::Deinitialize()
 
 	bIsInitialized = false;
 
+	UDeskillzMemoryManager::Get()->SetRoomsSubsystem(nullptr);
+
 	UE_LOG(LogTemp, Log, TEXT("[DeskillzRooms] Deinitialized"));
 
 	Super::Deinitialize();
@@ -270,6 +424,33 @@ void UDeskillzRooms::GetPublicRooms(
 		}));
 }
 
+void UDeskillzRooms::GetPublicRoomsPage(
+	const FRoomListQuery& Query,
+	FOnRoomPageSuccess OnSuccess,
+	FOnRoomError OnError)
+{
+	UDeskillzSDK* SDK = UDeskillzSDK::Get(this);
+	if (!SDK)
+	{
+		OnError.ExecuteIfBound(FRoomError(FRoomError::ServerError, TEXT("SDK not initialized")));
+		return;
+	}
+
+	FString GameId = SDK->GetGameId();
+	if (GameId.IsEmpty())
+	{
+		OnError.ExecuteIfBound(FRoomError(FRoomError::ServerError, TEXT("Game ID not configured")));
+		return;
+	}
+
+	RoomClient->GetPublicRoomsPage(GameId, Query, OnSuccess,
+		FOnRoomError::CreateLambda([this, OnError](const FRoomError& Error)
+		{
+			OnError.ExecuteIfBound(Error);
+			OnRoomErrorOccurred.Broadcast(Error);
+		}));
+}
+
 void UDeskillzRooms::GetMyRooms(
 	FOnRoomListSuccess OnSuccess,
 	FOnRoomError OnError)
@@ -567,12 +748,62 @@ bool UDeskillzRooms::CanStartMatch() const
 	return IsHost() && CurrentRoom.AreAllPlayersReady() && CurrentRoom.CurrentPlayers >= CurrentRoom.MinPlayers;
 }
 
+bool UDeskillzRooms::RegisterRoomEventHandler(FName EventType, TFunction<void(const TSharedPtr<FJsonObject>&)> Handler)
+{
+	return RoomClient ? RoomClient->RegisterEventHandler(EventType, MoveTemp(Handler)) : false;
+}
+
+void UDeskillzRooms::UnregisterRoomEventHandler(FName EventType)
+{
+	if (RoomClient)
+	{
+		RoomClient->UnregisterEventHandler(EventType);
+	}
+}
+
+int64 UDeskillzRooms::GetRoomStateMemoryBytes() const
+{
+	const FPrivateRoom& Room = CurrentRoom;
+	int64 Bytes = sizeof(FPrivateRoom)
+		+ Room.Id.GetAllocatedSize() + Room.RoomCode.GetAllocatedSize()
+		+ Room.Name.GetAllocatedSize() + Room.Description.GetAllocatedSize()
+		+ Room.EntryCurrency.GetAllocatedSize()
+		+ Room.Host.Id.GetAllocatedSize() + Room.Host.Username.GetAllocatedSize() + Room.Host.AvatarUrl.GetAllocatedSize()
+		+ Room.Game.Id.GetAllocatedSize() + Room.Game.Name.GetAllocatedSize() + Room.Game.IconUrl.GetAllocatedSize()
+		+ Room.Players.GetAllocatedSize() + Room.PlayerIndex.GetAllocatedSize()
+		+ PendingRoomPatches.GetAllocatedSize();
+
+	for (const FRoomPlayer& Player : Room.Players)
+	{
+		Bytes += Player.Id.GetAllocatedSize() + Player.Username.GetAllocatedSize() + Player.AvatarUrl.GetAllocatedSize();
+	}
+
+	return Bytes;
+}
+
+void UDeskillzRooms::TrimRoomState()
+{
+	LLM_SCOPE_BYTAG(Deskillz_Rooms);
+
+	if (IsInRoom())
+	{
+		CurrentRoom.Players.Shrink();
+		CurrentRoom.PlayerIndex.Shrink();
+		return;
+	}
+
+	// Stale state from a room we already left
+	CurrentRoom = FPrivateRoom();
+}
+
 // =============================================================================
 // Internal
 // =============================================================================
 
 void UDeskillzRooms::ConnectToRoom(const FString& RoomId)
 {
+	ResetRoomSync();
+
 	if (RoomClient)
 	{
 		RoomClient->Connect(RoomId);
@@ -581,6 +812,8 @@ void UDeskillzRooms::ConnectToRoom(const FString& RoomId)
 
 void UDeskillzRooms::DisconnectFromRoom()
 {
+	ResetRoomSync();
+
 	if (RoomClient)
 	{
 		RoomClient->Disconnect();
@@ -607,25 +840,203 @@ bool UDeskillzRooms::ValidateAuthentication(FOnRoomError OnError)
 
 void UDeskillzRooms::HandleRoomStateUpdate(const FPrivateRoom& Room)
 {
-	CurrentRoom = Room;
-	OnRoomUpdated.Broadcast(Room);
+	LLM_SCOPE_BYTAG(Deskillz_Rooms);
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzRoomStateUpdate, DeskillzRoomsChannel);
+	
+	// Older than what patches already moved us to
+	const bool bStale = Room.Id == CurrentRoom.Id && Room.Version > 0 && Room.Version <= CurrentRoom.Version;
+	if (bStale && !bAwaitingRoomSnapshot)
+	{
+		return;
+	}
+
+	if (!bStale)
+	{
+		CurrentRoom = Room;
+	}
+	bAwaitingRoomSnapshot = false;
+
+	// Replay patches that arrived while the snapshot was in flight
+	TArray<FRoomStatePatch> Pending = MoveTemp(PendingRoomPatches);
+	PendingRoomPatches.Reset();
+	Pending.Sort([](const FRoomStatePatch& A, const FRoomStatePatch& B) { return A.Version < B.Version; });
+
+	bool bApplied = false;
+	for (const FRoomStatePatch& Patch : Pending)
+	{
+		// An unversioned snapshot takes the first held patch as its base
+		if (CurrentRoom.Version == 0 || Patch.Version == CurrentRoom.Version + 1)
+		{
+			ApplyRoomPatch(Patch);
+			bApplied = true;
+		}
+	}
+
+	// ApplyRoomPatch already broadcast the final state
+	if (!bApplied)
+	{
+		OnRoomUpdated.Broadcast(CurrentRoom);
+	}
 }
 
-void UDeskillzRooms::HandlePlayerJoined(const FRoomPlayer& Player)
+void UDeskillzRooms::HandleRoomPatch(const FRoomStatePatch& Patch)
 {
-	bool bFound = false;
-	for (const FRoomPlayer& Existing : CurrentRoom.Players)
+	LLM_SCOPE_BYTAG(Deskillz_Rooms);
+
+	if (!IsInRoom() || (!Patch.RoomId.IsEmpty() && Patch.RoomId != CurrentRoom.Id))
+	{
+		return;
+	}
+
+	if (bAwaitingRoomSnapshot)
+	{
+		HoldRoomPatch(Patch);
+		return;
+	}
+
+	// Duplicate, or already covered by a newer snapshot
+	if (Patch.Version <= CurrentRoom.Version)
+	{
+		return;
+	}
+
+	// Unversioned copy (HTTP join, or a server that doesn't version snapshots):
+	// there is nothing to detect a gap against, so this patch becomes the base.
+	// Resyncing here would fetch another unversioned copy and loop.
+	if (CurrentRoom.Version == 0)
+	{
+		ApplyRoomPatch(Patch);
+		return;
+	}
+
+	// Missed an update: resync
+	if (Patch.Version != CurrentRoom.Version + 1)
+	{
+		UE_LOG(LogTemp, Log, TEXT("[DeskillzRooms] Room state gap (have v%lld, got v%lld), requesting snapshot"),
+			CurrentRoom.Version, Patch.Version);
+		HoldRoomPatch(Patch);
+		RequestRoomSnapshot();
+		return;
+	}
+
+	ApplyRoomPatch(Patch);
+}
+
+void UDeskillzRooms::ApplyRoomPatch(const FRoomStatePatch& Patch)
+{
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzRoomPatch, DeskillzRoomsChannel);
+
+	const int32 PlayersBefore = CurrentRoom.Players.Num();
+
+	for (const FString& PlayerId : Patch.RemovedPlayerIds)
+	{
+		if (CurrentRoom.RemovePlayer(PlayerId))
+		{
+			OnPlayerLeft.Broadcast(PlayerId);
+		}
+	}
+
+	for (const FRoomPlayerPatch& Change : Patch.Players)
 	{
-		if (Existing.Id == Player.Id)
+		FRoomPlayer* Player = CurrentRoom.FindPlayer(Change.Id);
+		if (!Player)
+		{
+			FRoomPlayer Added;
+			Change.ApplyTo(Added);
+			OnPlayerJoined.Broadcast(CurrentRoom.AddPlayer(Added));
+			continue;
+		}
+
+		const bool bWasReady = Player->bIsReady;
+		Change.ApplyTo(*Player);
+		if (Player->bIsReady != bWasReady)
 		{
-			bFound = true;
-			break;
+			OnPlayerReadyChanged.Broadcast(Player->Id, Player->bIsReady);
 		}
+		if (Change.Username.IsSet() || Change.AvatarUrl.IsSet() || Change.bIsAdmin.IsSet())
+		{
+			OnPlayerUpdated.Broadcast(*Player);
+		}
+	}
+
+	if (Patch.Status.IsSet())
+	{
+		CurrentRoom.Status = Patch.Status.GetValue();
+	}
+	if (Patch.PrizePool.IsSet())
+	{
+		CurrentRoom.PrizePool = Patch.PrizePool.GetValue();
+	}
+	CurrentRoom.CurrentPlayers = Patch.CurrentPlayers.IsSet()
+		? Patch.CurrentPlayers.GetValue()
+		: FMath::Max(0, CurrentRoom.CurrentPlayers + CurrentRoom.Players.Num() - PlayersBefore);
+
+	CurrentRoom.Version = Patch.Version;
+	OnRoomUpdated.Broadcast(CurrentRoom);
+
+	if (Patch.bAllReady)
+	{
+		OnAllPlayersReady.Broadcast();
+	}
+}
+
+void UDeskillzRooms::HoldRoomPatch(const FRoomStatePatch& Patch)
+{
+	if (PendingRoomPatches.Num() >= MaxPendingRoomPatches)
+	{
+		PendingRoomPatches.RemoveAt(0);
+	}
+	PendingRoomPatches.Add(Patch);
+}
+
+void UDeskillzRooms::RequestRoomSnapshot()
+{
+	if (bAwaitingRoomSnapshot || !RoomClient)
+	{
+		return;
 	}
 
-	if (!bFound)
+	// Held patches wait; the next gap after the interval retries
+	const double Now = FPlatformTime::Seconds();
+	if (LastRoomSnapshotRequestTime > 0.0 && Now - LastRoomSnapshotRequestTime < MinRoomSnapshotInterval)
 	{
-		CurrentRoom.Players.Add(Player);
+		return;
+	}
+
+	LastRoomSnapshotRequestTime = Now;
+	bAwaitingRoomSnapshot = true;
+	const FString RoomId = CurrentRoom.Id;
+
+	RoomClient->GetRoomById(RoomId,
+		FOnRoomSuccess::CreateLambda([this, RoomId](const FPrivateRoom& Room)
+		{
+			if (CurrentRoom.Id == RoomId)
+			{
+				HandleRoomStateUpdate(Room);
+			}
+		}),
+		FOnRoomError::CreateLambda([this, RoomId](const FRoomError& Error)
+		{
+			if (CurrentRoom.Id == RoomId)
+			{
+				// Next patch retries
+				UE_LOG(LogTemp, Warning, TEXT("[DeskillzRooms] Room snapshot failed: %s"), *Error.Message);
+				ResetRoomSync();
+			}
+		}));
+}
+
+void UDeskillzRooms::ResetRoomSync()
+{
+	bAwaitingRoomSnapshot = false;
+	PendingRoomPatches.Reset();
+}
+
+void UDeskillzRooms::HandlePlayerJoined(const FRoomPlayer& Player)
+{
+	if (!CurrentRoom.FindPlayer(Player.Id))
+	{
+		CurrentRoom.AddPlayer(Player);
 		CurrentRoom.CurrentPlayers++;
 	}
 
@@ -635,8 +1046,10 @@ void UDeskillzRooms::HandlePlayerJoined(const FRoomPlayer& Player)
 
 void UDeskillzRooms::HandlePlayerLeft(const FString& PlayerId)
 {
-	CurrentRoom.Players.RemoveAll([PlayerId](const FRoomPlayer& P) { return P.Id == PlayerId; });
-	CurrentRoom.CurrentPlayers = FMath::Max(0, CurrentRoom.CurrentPlayers - 1);
+	if (CurrentRoom.RemovePlayer(PlayerId))
+	{
+		CurrentRoom.CurrentPlayers = FMath::Max(0, CurrentRoom.CurrentPlayers - 1);
+	}
 
 	OnPlayerLeft.Broadcast(PlayerId);
 	OnRoomUpdated.Broadcast(CurrentRoom);
@@ -644,22 +1057,14 @@ void UDeskillzRooms::HandlePlayerLeft(const FString& PlayerId)
 
 void UDeskillzRooms::HandlePlayerKicked(const FString& PlayerId)
 {
-	CurrentRoom.Players.RemoveAll([PlayerId](const FRoomPlayer& P) { return P.Id == PlayerId; });
-	CurrentRoom.CurrentPlayers = FMath::Max(0, CurrentRoom.CurrentPlayers - 1);
-
-	OnPlayerLeft.Broadcast(PlayerId);
-	OnRoomUpdated.Broadcast(CurrentRoom);
+	HandlePlayerLeft(PlayerId);
 }
 
 void UDeskillzRooms::HandlePlayerReady(const FString& PlayerId, bool bIsReady, bool bAllReady)
 {
-	for (FRoomPlayer& Player : CurrentRoom.Players)
+	if (FRoomPlayer* Player = CurrentRoom.FindPlayer(PlayerId))
 	{
-		if (Player.Id == PlayerId)
-		{
-			Player.bIsReady = bIsReady;
-			break;
-		}
+		Player->bIsReady = bIsReady;
 	}
 
 	OnPlayerReadyChanged.Broadcast(PlayerId, bIsReady);
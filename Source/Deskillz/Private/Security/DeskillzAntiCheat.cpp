@@ -1,12 +1,17 @@
 // Copyright Deskillz Games. All Rights Reserved.
 
 #include "Security/DeskillzAntiCheat.h"
+#include "Security/DeskillzScoreRules.h"
+#include "Network/DeskillzClockSync.h"
 #include "Deskillz.h"
+#include "Core/DeskillzStats.h"
 #include "HAL/PlatformMisc.h"
 #include "Misc/DateTime.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
 #include "Dom/JsonObject.h"
+#include "Async/Async.h"
+#include "Misc/Paths.h"
 
 #if PLATFORM_WINDOWS
 #include "Windows/AllowWindowsPlatformTypes.h"
@@ -22,9 +27,61 @@
 // Static singleton
 static UDeskillzAntiCheat* GAntiCheat = nullptr;
 
+// Sliding window sizes
+static constexpr int32 MaxInputHistory = 1000;
+static constexpr int32 MaxFrameTimeSamples = 60;
+
+// Input pattern detection
+static constexpr float InputClusterRadius = 40.0f;       // inputs closer than this target the same spot (pixels)
+static constexpr float MinIntervalEntropyBits = 0.75f;   // below this, timing is effectively fixed
+static constexpr float MinInputJitterStdDev = 0.25f;     // below this, offsets are synthetic (pixels)
+static constexpr int32 MinJitterSamples = 20;
+static constexpr int32 MinPatternSamples = 100;          // intervals needed before entropy/jitter are judged
+static constexpr float MinPatternFrameMultiple = 4.0f;   // per-frame input (one bucket at ~16ms) is normal; judge slower streams only
+
+/** Quarter-octave histogram bucket for an interval */
+static int32 GetIntervalBucket(float IntervalMs, int32 NumBuckets)
+{
+	return FMath::Clamp(FMath::FloorToInt(4.0f * FMath::Log2(FMath::Max(IntervalMs, 0.0f) + 1.0f)), 0, NumBuckets - 1);
+}
+
+/** c * log2(c), with 0 log 0 = 0 */
+static double XLog2X(int32 Count)
+{
+	return Count > 0 ? Count * FMath::Log2(static_cast<double>(Count)) : 0.0;
+}
+
+/**
+ * Root/emulator status for this process
+ * Can't change while the app runs, so it is probed once and shared by all
+ * instances. Only touched on the game thread.
+ */
+struct FDeskillzDeviceIntegrityCache
+{
+	bool bReady = false;
+	bool bRooted = false;
+	bool bEmulator = false;
+};
+static FDeskillzDeviceIntegrityCache GDeviceIntegrityCache;
+
 UDeskillzAntiCheat::UDeskillzAntiCheat()
 {
 	ProtectedScore.Set(0);
+	
+	InputHistory.SetCapacity(MaxInputHistory);
+	InputIntervals.SetCapacity(MaxInputHistory - 1);
+	InputRepeatFlags.SetCapacity(MaxInputHistory - 1);
+	InputJitter.SetCapacity(MaxInputHistory - 1);
+	FrameTimeSamples.SetCapacity(MaxFrameTimeSamples);
+	
+	// Check, cost class, cadence (seconds, 0 = once per match)
+	ScheduledChecks = {
+		{ EDeskillzIntegrityCheck::Memory, EDeskillzCheckCost::Cheap, 0.5f, 0.0 },
+		{ EDeskillzIntegrityCheck::SpeedHack, EDeskillzCheckCost::Cheap, 1.0f, 0.0 },
+		{ EDeskillzIntegrityCheck::TimeTamper, EDeskillzCheckCost::Cheap, 1.0f, 0.0 },
+		{ EDeskillzIntegrityCheck::Debugger, EDeskillzCheckCost::Moderate, 5.0f, 0.0 },
+		{ EDeskillzIntegrityCheck::DeviceIntegrity, EDeskillzCheckCost::Background, 0.0f, 0.0 }
+	};
 }
 
 UDeskillzAntiCheat* UDeskillzAntiCheat::Get(const UObject* WorldContextObject)
@@ -47,13 +104,24 @@ void UDeskillzAntiCheat::Initialize(const FString& MatchId)
 	LastScoreUpdateTime = FPlatformTime::Seconds();
 	LastTimeCheck = FPlatformTime::Seconds();
 	DetectedViolations.Empty();
-	InputHistory.Empty();
-	FrameTimeSamples.Empty();
+	ResetInputStats();
+	FrameTimeSamples.Reset();
+	LastFrameSampleTime = 0;
+	LastTamperTimestamp = 0;
+	bDeviceViolationsReported = false;
 	
-	// Run initial integrity check
-	if (!RunIntegrityCheck())
+	// Every check is due on the first frames; the scheduler spreads them out
+	for (FScheduledCheck& Scheduled : ScheduledChecks)
 	{
-		UE_LOG(LogDeskillz, Warning, TEXT("Anti-cheat: Initial integrity check found issues"));
+		Scheduled.NextRunTime = 0.0;
+	}
+	NextCheckIndex = 0;
+	bSchedulerActive = true;
+	
+	// Get the filesystem probes going before the scheduler needs them
+	if (bEnableDeviceIntegrity)
+	{
+		StartDeviceIntegrityProbe();
 	}
 	
 	UE_LOG(LogDeskillz, Log, TEXT("Anti-cheat initialized for match: %s"), *MatchId);
@@ -65,51 +133,165 @@ void UDeskillzAntiCheat::Reset()
 	ProtectedScore.Set(0);
 	LastScore = 0;
 	DetectedViolations.Empty();
-	InputHistory.Empty();
-	FrameTimeSamples.Empty();
+	ResetInputStats();
+	FrameTimeSamples.Reset();
+	bSchedulerActive = false;
 	
 	UE_LOG(LogDeskillz, Log, TEXT("Anti-cheat reset"));
 }
 
 bool UDeskillzAntiCheat::RunIntegrityCheck()
 {
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzIntegrityCheck, DeskillzSecurityChannel);
+	
 	bool bAllPassed = true;
 	
-	// Memory integrity
-	if (bEnableMemoryProtection && !CheckMemoryIntegrity())
+	for (const FScheduledCheck& Scheduled : ScheduledChecks)
 	{
-		ReportViolation(EDeskillzViolationType::MemoryTamper, EDeskillzViolationSeverity::High, TEXT("Memory integrity check failed"));
-		bAllPassed = false;
+		if (!RunCheck(Scheduled.Check))
+		{
+			bAllPassed = false;
+		}
 	}
 	
-	// Speed hack check
-	if (!CheckSpeedHack())
+	return bAllPassed;
+}
+
+// ============================================================================
+// Scheduler
+// ============================================================================
+
+void UDeskillzAntiCheat::Tick(float DeltaTime)
+{
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzIntegrityCheck, DeskillzSecurityChannel);
+	
+	// Frame pacing has to be sampled every frame; evaluating it is scheduled
+	SampleFrameTime();
+	
+	RunScheduledChecks(IntegrityBudgetMicroseconds / 1000000.0);
+}
+
+void UDeskillzAntiCheat::RunScheduledChecks(double BudgetSeconds)
+{
+	const int32 NumChecks = ScheduledChecks.Num();
+	if (NumChecks == 0)
 	{
-		ReportViolation(EDeskillzViolationType::SpeedHack, EDeskillzViolationSeverity::High, TEXT("Speed manipulation detected"));
-		bAllPassed = false;
+		return;
 	}
 	
-	// Time tamper check
-	if (bEnableTimeValidation && !CheckTimeTamper())
+	const double Now = FPlatformTime::Seconds();
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	
+	// Round-robin so a check that keeps landing at the end of the budget isn't starved
+	for (int32 Visited = 0; Visited < NumChecks; Visited++)
 	{
-		ReportViolation(EDeskillzViolationType::TimeTamper, EDeskillzViolationSeverity::Medium, TEXT("Time manipulation suspected"));
-		bAllPassed = false;
+		const int32 Index = (NextCheckIndex + Visited) % NumChecks;
+		FScheduledCheck& Scheduled = ScheduledChecks[Index];
+		
+		if (Scheduled.NextRunTime < 0.0 || Now < Scheduled.NextRunTime)
+		{
+			continue;
+		}
+		
+		// Always run at least one due check per frame so coverage can't stall
+		if (Visited > 0 && FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles) >= BudgetSeconds)
+		{
+			NextCheckIndex = Index;
+			return;
+		}
+		
+		// Background checks only cost a dispatch (or a cache read) here
+		RunCheck(Scheduled.Check);
+		
+		// Once-per-match checks are retired after they've produced a result
+		if (Scheduled.Interval > 0.0f)
+		{
+			Scheduled.NextRunTime = Now + Scheduled.Interval;
+		}
+		else if (Scheduled.Cost != EDeskillzCheckCost::Background || GDeviceIntegrityCache.bReady)
+		{
+			Scheduled.NextRunTime = -1.0;
+		}
 	}
 	
-	// Debugger check
-	if (bEnableDebuggerDetection && IsDebuggerPresent())
+	NextCheckIndex = (NextCheckIndex + 1) % NumChecks;
+}
+
+bool UDeskillzAntiCheat::RunCheck(EDeskillzIntegrityCheck Check)
+{
+	switch (Check)
 	{
-		ReportViolation(EDeskillzViolationType::DebuggerDetected, EDeskillzViolationSeverity::Medium, TEXT("Debugger detected"));
-		bAllPassed = false;
+		case EDeskillzIntegrityCheck::Memory:
+			if (bEnableMemoryProtection && !CheckMemoryIntegrity())
+			{
+				ReportViolation(EDeskillzViolationType::MemoryTamper, EDeskillzViolationSeverity::High, TEXT("Memory integrity check failed"));
+				return false;
+			}
+			break;
+			
+		case EDeskillzIntegrityCheck::SpeedHack:
+			if (!CheckSpeedHack())
+			{
+				ReportViolation(EDeskillzViolationType::SpeedHack, EDeskillzViolationSeverity::High, TEXT("Speed manipulation detected"));
+				return false;
+			}
+			break;
+			
+		case EDeskillzIntegrityCheck::TimeTamper:
+			if (bEnableTimeValidation && !CheckTimeTamper())
+			{
+				ReportViolation(EDeskillzViolationType::TimeTamper, EDeskillzViolationSeverity::Medium, TEXT("Time manipulation suspected"));
+				return false;
+			}
+			break;
+			
+		case EDeskillzIntegrityCheck::Debugger:
+			if (bEnableDebuggerDetection && IsDebuggerPresent())
+			{
+				ReportViolation(EDeskillzViolationType::DebuggerDetected, EDeskillzViolationSeverity::Medium, TEXT("Debugger detected"));
+				return false;
+			}
+			break;
+			
+		case EDeskillzIntegrityCheck::DeviceIntegrity:
+			if (bEnableDeviceIntegrity && !CheckDeviceIntegrity())
+			{
+				return false;
+			}
+			break;
 	}
 	
-	// Device integrity
-	if (bEnableDeviceIntegrity && !CheckDeviceIntegrity())
+	return true;
+}
+
+void UDeskillzAntiCheat::StartDeviceIntegrityProbe()
+{
+	if (GDeviceIntegrityCache.bReady || bDeviceProbeInFlight)
 	{
-		bAllPassed = false;
+		return;
 	}
 	
-	return bAllPassed;
+	bDeviceProbeInFlight = true;
+	TWeakObjectPtr<UDeskillzAntiCheat> WeakThis(this);
+	
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis]()
+	{
+		const bool bRooted = ProbeDeviceRooted();
+		const bool bEmulator = ProbeEmulator();
+		
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, bRooted, bEmulator]()
+		{
+			// A synchronous query may have filled the cache meanwhile; results are identical
+			GDeviceIntegrityCache.bRooted = bRooted;
+			GDeviceIntegrityCache.bEmulator = bEmulator;
+			GDeviceIntegrityCache.bReady = true;
+			
+			if (UDeskillzAntiCheat* This = WeakThis.Get())
+			{
+				This->bDeviceProbeInFlight = false;
+			}
+		});
+	});
 }
 
 // ============================================================================
@@ -146,35 +328,29 @@ bool UDeskillzAntiCheat::ValidateScoreUpdate(int64 NewScore, float DeltaTime)
 		return true;
 	}
 	
-	// Check for score decrease (usually invalid)
-	if (NewScore < LastScore)
+	const EDeskillzScoreRule Broken = FDeskillzScoreValidator::GetActive().CheckUpdate(LastScore, NewScore, DeltaTime);
+	
+	// Decreases are reported but allowed (games with penalties)
+	if (EnumHasAnyFlags(Broken, EDeskillzScoreRule::Decrease))
 	{
-		// Allow small decreases for games with penalties
-		int64 Decrease = LastScore - NewScore;
-		if (Decrease > 1000)
-		{
-			ReportViolation(
-				EDeskillzViolationType::ScoreAnomaly, 
-				EDeskillzViolationSeverity::Medium,
-				FString::Printf(TEXT("Suspicious score decrease: %lld -> %lld"), LastScore, NewScore)
-			);
-		}
+		ReportViolation(
+			EDeskillzViolationType::ScoreAnomaly, 
+			EDeskillzViolationSeverity::Medium,
+			FString::Printf(TEXT("Suspicious score decrease: %lld -> %lld"), LastScore, NewScore)
+		);
 	}
 	
-	// Check score rate
-	if (DeltaTime > 0)
+	// Out of range, impossible jumps and impossible rates reject the update
+	const EDeskillzScoreRule Rejected = Broken & ~EDeskillzScoreRule::Decrease;
+	if (Rejected != EDeskillzScoreRule::None)
 	{
-		float ScoreRate = (float)(NewScore - LastScore) / DeltaTime;
-		
-		if (ScoreRate > MaxScorePerSecond)
-		{
-			ReportViolation(
-				EDeskillzViolationType::ScoreAnomaly,
-				EDeskillzViolationSeverity::High,
-				FString::Printf(TEXT("Score rate too high: %.2f/sec (max: %.2f)"), ScoreRate, MaxScorePerSecond)
-			);
-			return false;
-		}
+		ReportViolation(
+			EDeskillzViolationType::ScoreAnomaly,
+			EDeskillzViolationSeverity::High,
+			FString::Printf(TEXT("Score update %lld -> %lld in %.2fs breaks score rules (%s)"),
+				LastScore, NewScore, DeltaTime, *FDeskillzScoreValidator::Describe(Rejected))
+		);
+		return false;
 	}
 	
 	// Verify previous score wasn't tampered
@@ -198,16 +374,17 @@ bool UDeskillzAntiCheat::ValidateScoreUpdate(int64 NewScore, float DeltaTime)
 
 void UDeskillzAntiCheat::SyncServerTime(int64 ServerTimestamp)
 {
-	int64 LocalTimestamp = GetTimestamp();
-	ServerTimeOffset = ServerTimestamp - LocalTimestamp;
+	UDeskillzClockSync* Clock = UDeskillzClockSync::Get();
+	Clock->AddCoarseSample(ServerTimestamp);
+	
 	LastTimeCheck = FPlatformTime::Seconds();
 	
-	UE_LOG(LogDeskillz, Log, TEXT("Server time synced, offset: %lld ms"), ServerTimeOffset);
+	UE_LOG(LogDeskillz, Log, TEXT("Server time synced, device clock offset: %lld ms"), Clock->GetServerTimeMs() - GetTimestamp());
 }
 
 int64 UDeskillzAntiCheat::GetValidatedTimestamp() const
 {
-	return GetTimestamp() + ServerTimeOffset;
+	return UDeskillzClockSync::Get()->GetServerTimeMs();
 }
 
 bool UDeskillzAntiCheat::IsTimeValid() const
@@ -217,17 +394,27 @@ bool UDeskillzAntiCheat::IsTimeValid() const
 		return true;
 	}
 	
-	// Check if time is moving forward at expected rate
-	double CurrentTime = FPlatformTime::Seconds();
-	double TimeDelta = CurrentTime - LastTimeCheck;
-	
-	// Time shouldn't jump forward or backward significantly
-	if (FMath::Abs(TimeDelta) > TimeDriftTolerance)
+	// Read the clock afresh against the last check's baseline, without moving it
+	const UDeskillzClockSync* Clock = UDeskillzClockSync::Get();
+	return IsClockPaceValid(GetTimestamp(), Clock->GetServerTimeMs(), Clock->GetStepEpoch());
+}
+
+bool UDeskillzAntiCheat::IsClockPaceValid(int64 Timestamp, int64 ServerTimestamp, int32 ClockEpoch) const
+{
+	// A new server clock reference (first sync) makes the interval
+	// meaningless; only compare across checks on the same footing
+	if (LastTamperTimestamp <= 0 || ClockEpoch != LastTamperClockEpoch)
 	{
-		return false;
+		return true;
 	}
 	
-	return true;
+	// The device clock should advance with the server clock. Frame hitches
+	// move both equally; a changed device clock moves only one. Sleep is
+	// bridged from the device clock, so a change made while backgrounded
+	// shows up once the next round trip has confirmed the bridge.
+	const int64 WallDelta = Timestamp - LastTamperTimestamp;
+	const int64 ServerDelta = ServerTimestamp - LastTamperServerTimestamp;
+	return FMath::Abs(WallDelta - ServerDelta) <= static_cast<int64>(TimeDriftTolerance * 1000.0f);
 }
 
 // ============================================================================
@@ -271,6 +458,31 @@ bool UDeskillzAntiCheat::IsDebuggerPresent() const
 }
 
 bool UDeskillzAntiCheat::IsEmulatorDetected() const
+{
+	if (!GDeviceIntegrityCache.bReady)
+	{
+		// Queried before the background probe finished; pay for it once here
+		GDeviceIntegrityCache.bRooted = ProbeDeviceRooted();
+		GDeviceIntegrityCache.bEmulator = ProbeEmulator();
+		GDeviceIntegrityCache.bReady = true;
+	}
+	
+	return GDeviceIntegrityCache.bEmulator;
+}
+
+bool UDeskillzAntiCheat::IsDeviceRooted() const
+{
+	if (!GDeviceIntegrityCache.bReady)
+	{
+		GDeviceIntegrityCache.bRooted = ProbeDeviceRooted();
+		GDeviceIntegrityCache.bEmulator = ProbeEmulator();
+		GDeviceIntegrityCache.bReady = true;
+	}
+	
+	return GDeviceIntegrityCache.bRooted;
+}
+
+bool UDeskillzAntiCheat::ProbeEmulator()
 {
 #if PLATFORM_ANDROID
 	// Android emulator detection
@@ -302,7 +514,7 @@ bool UDeskillzAntiCheat::IsEmulatorDetected() const
 	return false;
 }
 
-bool UDeskillzAntiCheat::IsDeviceRooted() const
+bool UDeskillzAntiCheat::ProbeDeviceRooted()
 {
 #if PLATFORM_ANDROID
 	// Check for root indicators on Android
@@ -487,13 +699,58 @@ FString UDeskillzAntiCheat::GetAntiCheatReport() const
 
 void UDeskillzAntiCheat::RecordInput(const FString& InputType, FVector2D Position)
 {
-	InputHistory.Add(TPair<int64, FVector2D>(GetTimestamp(), Position));
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzRecordInput, DeskillzSecurityChannel);
+	
+	const int64 Timestamp = GetTimestamp();
+	const float X = static_cast<float>(Position.X);
+	const float Y = static_cast<float>(Position.Y);
 	
-	// Keep only recent inputs (last 1000)
-	if (InputHistory.Num() > 1000)
+	// Update running interval/position stats against the previous input
+	if (!InputHistory.IsEmpty())
 	{
-		InputHistory.RemoveAt(0, InputHistory.Num() - 1000);
+		const int32 Last = InputHistory.Num() - 1;
+		const float Interval = static_cast<float>(Timestamp - InputHistory.Get<0>(Last));
+		
+		// Keep the entropy histogram in step with the interval window
+		if (InputIntervals.IsFull())
+		{
+			UpdateIntervalBucket(InputIntervals.GetValues().First(), -1);
+		}
+		InputIntervals.Add(Interval);
+		UpdateIntervalBucket(Interval, 1);
+		
+		const float DX = X - InputHistory.Get<1>(Last);
+		const float DY = Y - InputHistory.Get<2>(Last);
+		const bool bSamePosition = FMath::Abs(DX) <= 0.5f && FMath::Abs(DY) <= 0.5f;
+		InputRepeatFlags.Add(bSamePosition ? 1.0f : 0.0f);
+		
+		// Jitter around a repeatedly hit target (exact repeats are counted above)
+		const float Offset = FMath::Sqrt(DX * DX + DY * DY);
+		if (!bSamePosition && Offset <= InputClusterRadius)
+		{
+			InputJitter.Add(Offset);
+		}
 	}
+	
+	// Keep only recent inputs (oldest is overwritten once full)
+	InputHistory.Push(Timestamp, X, Y);
+}
+
+float UDeskillzAntiCheat::GetInputIntervalEntropy() const
+{
+	const int32 Total = InputIntervals.Num();
+	if (Total == 0)
+	{
+		return 0.0f;
+	}
+	
+	// H = log2(N) - (1/N) * sum(c * log2(c))
+	return FMath::Max(0.0f, static_cast<float>(FMath::Log2(static_cast<double>(Total)) - IntervalBucketCLogC / Total));
+}
+
+float UDeskillzAntiCheat::GetInputJitterStdDev() const
+{
+	return static_cast<float>(InputJitter.GetStdDev());
 }
 
 bool UDeskillzAntiCheat::ValidateInputPatterns() const
@@ -515,75 +772,76 @@ bool UDeskillzAntiCheat::CheckMemoryIntegrity()
 	return VerifyScoreIntegrity();
 }
 
-bool UDeskillzAntiCheat::CheckSpeedHack()
+void UDeskillzAntiCheat::SampleFrameTime()
 {
-	// Sample frame time
-	static double LastFrameTime = 0;
 	double CurrentTime = FPlatformTime::Seconds();
 	
-	if (LastFrameTime > 0)
+	if (LastFrameSampleTime > 0)
 	{
-		float FrameTime = (float)(CurrentTime - LastFrameTime);
-		FrameTimeSamples.Add(FrameTime);
-		
 		// Keep last 60 samples
-		if (FrameTimeSamples.Num() > 60)
-		{
-			FrameTimeSamples.RemoveAt(0);
-		}
-		
-		// Check for speed manipulation
-		if (FrameTimeSamples.Num() >= 30)
-		{
-			// Calculate average frame time
-			float TotalTime = 0;
-			for (float FT : FrameTimeSamples)
-			{
-				TotalTime += FT;
-			}
-			float AvgFrameTime = TotalTime / FrameTimeSamples.Num();
-			
-			// If average frame time is much lower than expected (game running too fast)
-			if (AvgFrameTime < ExpectedFrameTime * 0.5f)
-			{
-				return false; // Possible speed hack
-			}
-		}
+		FrameTimeSamples.Add((float)(CurrentTime - LastFrameSampleTime));
 	}
 	
-	LastFrameTime = CurrentTime;
-	return true;
+	LastFrameSampleTime = CurrentTime;
 }
 
-bool UDeskillzAntiCheat::CheckTimeTamper()
+bool UDeskillzAntiCheat::CheckSpeedHack()
 {
-	static int64 LastTimestamp = 0;
-	int64 CurrentTimestamp = GetTimestamp();
+	// Outside a match nothing ticks the sampler; sample on demand instead
+	if (!bSchedulerActive)
+	{
+		SampleFrameTime();
+	}
 	
-	if (LastTimestamp > 0)
+	// Check for speed manipulation
+	if (FrameTimeSamples.Num() >= 30)
 	{
-		// Time shouldn't go backward
-		if (CurrentTimestamp < LastTimestamp)
-		{
-			return false;
-		}
+		float AvgFrameTime = (float)FrameTimeSamples.GetMean();
 		
-		// Time shouldn't jump forward too much
-		int64 TimeDelta = CurrentTimestamp - LastTimestamp;
-		if (TimeDelta > 5000) // More than 5 seconds jump
+		// If average frame time is much lower than expected (game running too fast)
+		if (AvgFrameTime < ExpectedFrameTime * 0.5f)
 		{
-			return false;
+			return false; // Possible speed hack
 		}
 	}
 	
-	LastTimestamp = CurrentTimestamp;
 	return true;
 }
 
+bool UDeskillzAntiCheat::CheckTimeTamper()
+{
+	const UDeskillzClockSync* Clock = UDeskillzClockSync::Get();
+	const int64 CurrentTimestamp = GetTimestamp();
+	const int64 CurrentServerTimestamp = Clock->GetServerTimeMs();
+	const int32 ClockEpoch = Clock->GetStepEpoch();
+	
+	const bool bValid = IsClockPaceValid(CurrentTimestamp, CurrentServerTimestamp, ClockEpoch);
+	
+	LastTamperTimestamp = CurrentTimestamp;
+	LastTamperServerTimestamp = CurrentServerTimestamp;
+	LastTamperClockEpoch = ClockEpoch;
+	
+	return bValid;
+}
+
 bool UDeskillzAntiCheat::CheckDeviceIntegrity()
 {
 	bool bPassed = true;
 	
+	// Never probe the filesystem on the game thread from here
+	if (!GDeviceIntegrityCache.bReady)
+	{
+		StartDeviceIntegrityProbe();
+		return bPassed;
+	}
+	
+	// Status can't change within the session; report it once per match
+	if (bDeviceViolationsReported)
+	{
+		return bPassed;
+	}
+	bDeviceViolationsReported = true;
+	
 	if (IsEmulatorDetected())
 	{
 		ReportViolation(EDeskillzViolationType::EmulatorDetected, EDeskillzViolationSeverity::Low, TEXT("Running in emulator"));
@@ -607,27 +865,8 @@ bool UDeskillzAntiCheat::DetectInputAutomation() const
 	}
 	
 	// Check for perfectly timed inputs (humans have variance)
-	TArray<int64> InputDeltas;
-	for (int32 i = 1; i < InputHistory.Num(); i++)
-	{
-		InputDeltas.Add(InputHistory[i].Key - InputHistory[i-1].Key);
-	}
-	
-	// Calculate standard deviation
-	float Mean = 0;
-	for (int64 Delta : InputDeltas)
-	{
-		Mean += Delta;
-	}
-	Mean /= InputDeltas.Num();
-	
-	float Variance = 0;
-	for (int64 Delta : InputDeltas)
-	{
-		Variance += FMath::Square((float)Delta - Mean);
-	}
-	Variance /= InputDeltas.Num();
-	float StdDev = FMath::Sqrt(Variance);
+	float Mean = (float)InputIntervals.GetMean();
+	float StdDev = (float)InputIntervals.GetStdDev();
 	
 	// If standard deviation is very low, inputs are suspiciously regular
 	if (StdDev < 5.0f && Mean < 100.0f) // Less than 5ms variance at 100ms average
@@ -636,14 +875,7 @@ bool UDeskillzAntiCheat::DetectInputAutomation() const
 	}
 	
 	// Check for identical positions (humans have position variance)
-	int32 IdenticalPositions = 0;
-	for (int32 i = 1; i < InputHistory.Num(); i++)
-	{
-		if (InputHistory[i].Value.Equals(InputHistory[i-1].Value, 0.5f))
-		{
-			IdenticalPositions++;
-		}
-	}
+	int32 IdenticalPositions = FMath::RoundToInt((float)InputRepeatFlags.GetSum());
 	
 	// If more than 80% of positions are identical, suspicious
 	if ((float)IdenticalPositions / InputHistory.Num() > 0.8f)
@@ -651,7 +883,39 @@ bool UDeskillzAntiCheat::DetectInputAutomation() const
 		return true;
 	}
 	
-	return false;
+	// Input sampled every frame or held steady (drags, rhythmic tapping) lands in one
+	// timing bucket naturally; only judge deliberate, well-spaced input with enough history
+	const float FrameTimeMs = ExpectedFrameTime * 1000.0f;
+	if (InputIntervals.Num() < MinPatternSamples || InputJitter.Num() < MinJitterSamples ||
+		Mean < FrameTimeMs * MinPatternFrameMultiple)
+	{
+		return false;
+	}
+	
+	// Timing collapsed into one or two buckets (scripted delays, even with random noise added)
+	// and offsets around a target that barely vary: either alone is within human range
+	const bool bFixedTiming = GetInputIntervalEntropy() < MinIntervalEntropyBits;
+	const bool bSyntheticAim = InputJitter.GetStdDev() < MinInputJitterStdDev;
+	return bFixedTiming && bSyntheticAim;
+}
+
+void UDeskillzAntiCheat::UpdateIntervalBucket(float IntervalMs, int32 Delta)
+{
+	int32& Count = IntervalBucketCounts[GetIntervalBucket(IntervalMs, NumIntervalBuckets)];
+	IntervalBucketCLogC -= XLog2X(Count);
+	Count += Delta;
+	IntervalBucketCLogC += XLog2X(Count);
+}
+
+void UDeskillzAntiCheat::ResetInputStats()
+{
+	InputHistory.Reset();
+	InputIntervals.Reset();
+	InputRepeatFlags.Reset();
+	InputJitter.Reset();
+	
+	FMemory::Memzero(IntervalBucketCounts, sizeof(IntervalBucketCounts));
+	IntervalBucketCLogC = 0.0;
 }
 
 int64 UDeskillzAntiCheat::GetTimestamp()
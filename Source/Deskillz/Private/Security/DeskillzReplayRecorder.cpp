@@ -0,0 +1,255 @@
+// Copyright Deskillz Games. All Rights Reserved.
+
+#include "Security/DeskillzReplayRecorder.h"
+#include "Deskillz.h"
+#include "Core/DeskillzVarInt.h"
+#include "Misc/Compression.h"
+
+// Stream format
+static const uint8 ReplayMagic[4] = { 'D', 'Z', 'R', 'P' };
+static constexpr uint8 ReplayFormatVersion = 1;
+
+// Event tags
+static constexpr uint8 ReplayTagEnd = 0;
+static constexpr uint8 ReplayTagInput = 1;
+static constexpr uint8 ReplayTagScore = 2;
+static constexpr uint8 ReplayTagNewInputType = 0x80;
+
+// Buffering
+static constexpr int32 ReplayChunkSize = 16 * 1024;
+static constexpr int32 MaxInputTypeBytes = 64;
+
+// Worst-case encoded sizes (tag + delta + payload)
+static constexpr int32 MaxInputEventBytes = 1 + 10 + (5 + MaxInputTypeBytes) + 5 + 5 + 5;
+static constexpr int32 MaxScoreEventBytes = 1 + 10 + 10;
+static constexpr int32 MaxTrailerBytes = 1 + 1 + 5;
+
+/** Longest prefix of at most MaxBytes that does not split a UTF-8 character */
+static int32 TruncateUtf8(const ANSICHAR* Utf8, int32 Length, int32 MaxBytes)
+{
+	if (Length <= MaxBytes)
+	{
+		return Length;
+	}
+
+	// Back off continuation bytes (10xxxxxx) to the start of the split character
+	int32 Bytes = MaxBytes;
+	while (Bytes > 0 && (static_cast<uint8>(Utf8[Bytes]) & 0xC0) == 0x80)
+	{
+		Bytes--;
+	}
+	return Bytes;
+}
+
+UDeskillzReplayRecorder::UDeskillzReplayRecorder()
+{
+}
+
+// ============================================================================
+// Recording
+// ============================================================================
+
+void UDeskillzReplayRecorder::BeginRecording(const FString& MatchId, int64 RandomSeed, int32 MaxBytes)
+{
+	Reset();
+
+	MaxRecordedBytes = FMath::Max(MaxBytes, 1024);
+	StartTime = FPlatformTime::Seconds();
+	bIsRecording = true;
+
+	// Header
+	FTCHARToUTF8 MatchIdUtf8(*MatchId);
+	const int32 MatchIdBytes = TruncateUtf8(MatchIdUtf8.Get(), MatchIdUtf8.Length(), 128);
+
+	uint8 Header[4 + 1 + 10 + 10 + 5 + 128];
+	uint8* Cursor = Header;
+	FMemory::Memcpy(Cursor, ReplayMagic, sizeof(ReplayMagic));
+	Cursor += sizeof(ReplayMagic);
+	*Cursor++ = ReplayFormatVersion;
+	Cursor = DeskillzVarInt::WriteInt(Cursor, RandomSeed);
+
+	const FDateTime Now = FDateTime::UtcNow();
+	Cursor = DeskillzVarInt::WriteUInt(Cursor, static_cast<uint64>(Now.ToUnixTimestamp() * 1000 + Now.GetMillisecond()));
+
+	Cursor = DeskillzVarInt::WriteUInt(Cursor, MatchIdBytes);
+	FMemory::Memcpy(Cursor, MatchIdUtf8.Get(), MatchIdBytes);
+	Cursor += MatchIdBytes;
+
+	Append(Header, Cursor - Header);
+
+	UE_LOG(LogDeskillz, Log, TEXT("Replay recording started for match: %s (cap %d KB)"), *MatchId, MaxRecordedBytes / 1024);
+}
+
+void UDeskillzReplayRecorder::RecordInput(const FString& InputType, FVector2D Position)
+{
+	if (!bIsRecording || !ReserveEvent(MaxInputEventBytes))
+	{
+		return;
+	}
+
+	uint8 Event[MaxInputEventBytes];
+	uint8* Cursor = Event;
+
+	// New input types are defined inline on first use
+	const int32* ExistingId = InputTypeIds.Find(InputType);
+	const int32 TypeId = ExistingId ? *ExistingId : InputTypeIds.Num();
+
+	*Cursor++ = ExistingId ? ReplayTagInput : (ReplayTagInput | ReplayTagNewInputType);
+	Cursor = DeskillzVarInt::WriteUInt(Cursor, ConsumeDeltaMs());
+
+	if (!ExistingId)
+	{
+		FTCHARToUTF8 TypeUtf8(*InputType);
+		const int32 TypeBytes = TruncateUtf8(TypeUtf8.Get(), TypeUtf8.Length(), MaxInputTypeBytes);
+		Cursor = DeskillzVarInt::WriteUInt(Cursor, TypeBytes);
+		FMemory::Memcpy(Cursor, TypeUtf8.Get(), TypeBytes);
+		Cursor += TypeBytes;
+
+		InputTypeIds.Add(InputType, TypeId);
+	}
+	Cursor = DeskillzVarInt::WriteUInt(Cursor, TypeId);
+
+	// Whole pixels; consecutive inputs are usually close so deltas stay 1-2 bytes
+	const int32 X = FMath::RoundToInt(Position.X);
+	const int32 Y = FMath::RoundToInt(Position.Y);
+	Cursor = DeskillzVarInt::WriteInt(Cursor, static_cast<int64>(X) - LastX);
+	Cursor = DeskillzVarInt::WriteInt(Cursor, static_cast<int64>(Y) - LastY);
+	LastX = X;
+	LastY = Y;
+
+	Append(Event, Cursor - Event);
+	EventCount++;
+}
+
+void UDeskillzReplayRecorder::RecordScore(int64 Score)
+{
+	if (!bIsRecording || Score == LastScore || !ReserveEvent(MaxScoreEventBytes))
+	{
+		return;
+	}
+
+	uint8 Event[MaxScoreEventBytes];
+	uint8* Cursor = Event;
+
+	*Cursor++ = ReplayTagScore;
+	Cursor = DeskillzVarInt::WriteUInt(Cursor, ConsumeDeltaMs());
+	Cursor = DeskillzVarInt::WriteInt(Cursor, DeskillzVarInt::Delta(Score, LastScore));
+	LastScore = Score;
+
+	Append(Event, Cursor - Event);
+	EventCount++;
+}
+
+TArray<uint8> UDeskillzReplayRecorder::FinishRecording()
+{
+	TArray<uint8> Result;
+
+	if (!bIsRecording)
+	{
+		return Result;
+	}
+
+	// Trailer (space for it is always held back by ReserveEvent)
+	uint8 Trailer[MaxTrailerBytes];
+	uint8* Cursor = Trailer;
+	*Cursor++ = ReplayTagEnd;
+	*Cursor++ = bTruncated ? 1 : 0;
+	Cursor = DeskillzVarInt::WriteUInt(Cursor, EventCount);
+	Append(Trailer, Cursor - Trailer);
+
+	// Flatten chunks
+	TArray<uint8> Stream;
+	Stream.Reserve(RecordedBytes);
+	for (const TArray<uint8>& Chunk : Chunks)
+	{
+		Stream.Append(Chunk);
+	}
+
+	// Compress
+	int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, Stream.Num());
+	Result.SetNumUninitialized(sizeof(uint32) + CompressedSize);
+
+	const uint32 UncompressedSize = static_cast<uint32>(Stream.Num());
+	for (int32 i = 0; i < 4; i++)
+	{
+		Result[i] = static_cast<uint8>(UncompressedSize >> (i * 8));
+	}
+
+	if (!FCompression::CompressMemory(NAME_Zlib, Result.GetData() + sizeof(uint32), CompressedSize, Stream.GetData(), Stream.Num()))
+	{
+		UE_LOG(LogDeskillz, Error, TEXT("Replay compression failed"));
+		Result.Empty();
+	}
+	else
+	{
+		Result.SetNum(sizeof(uint32) + CompressedSize);
+
+		UE_LOG(LogDeskillz, Log, TEXT("Replay recorded: %d events, %d bytes (%d compressed)%s"),
+			EventCount, Stream.Num(), Result.Num(), bTruncated ? TEXT(", truncated") : TEXT(""));
+	}
+
+	Reset();
+	return Result;
+}
+
+void UDeskillzReplayRecorder::Reset()
+{
+	Chunks.Empty();
+	InputTypeIds.Empty();
+	RecordedBytes = 0;
+	EventCount = 0;
+	LastEventMs = 0;
+	LastX = 0;
+	LastY = 0;
+	LastScore = 0;
+	bIsRecording = false;
+	bTruncated = false;
+}
+
+// ============================================================================
+// Internal Methods
+// ============================================================================
+
+void UDeskillzReplayRecorder::Append(const uint8* Data, int32 Num)
+{
+	while (Num > 0)
+	{
+		if (Chunks.Num() == 0 || Chunks.Last().Num() == ReplayChunkSize)
+		{
+			Chunks.AddDefaulted_GetRef().Reserve(ReplayChunkSize);
+		}
+
+		TArray<uint8>& Chunk = Chunks.Last();
+		const int32 Copy = FMath::Min(Num, ReplayChunkSize - Chunk.Num());
+		Chunk.Append(Data, Copy);
+
+		Data += Copy;
+		Num -= Copy;
+		RecordedBytes += Copy;
+	}
+}
+
+bool UDeskillzReplayRecorder::ReserveEvent(int32 MaxEventBytes)
+{
+	if (bTruncated)
+	{
+		return false;
+	}
+
+	if (RecordedBytes + MaxEventBytes + MaxTrailerBytes > MaxRecordedBytes)
+	{
+		UE_LOG(LogDeskillz, Warning, TEXT("Replay memory cap reached (%d bytes), recording truncated"), MaxRecordedBytes);
+		bTruncated = true;
+		return false;
+	}
+
+	return true;
+}
+
+uint64 UDeskillzReplayRecorder::ConsumeDeltaMs()
+{
+	const int64 NowMs = static_cast<int64>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+	const int64 DeltaMs = FMath::Max<int64>(NowMs - LastEventMs, 0);
+	LastEventMs = FMath::Max(NowMs, LastEventMs);
+	return static_cast<uint64>(DeltaMs);
+}
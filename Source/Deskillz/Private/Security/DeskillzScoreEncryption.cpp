@@ -2,6 +2,7 @@
 
 #include "Security/DeskillzScoreEncryption.h"
 #include "Deskillz.h"
+#include "Core/DeskillzStats.h"
 #include "Misc/Base64.h"
 #include "Misc/SecureHash.h"
 #include "Misc/Guid.h"
@@ -9,6 +10,7 @@
 #include "Serialization/JsonWriter.h"
 #include "Dom/JsonObject.h"
 #include "GenericPlatform/GenericPlatformMisc.h"
+#include "Async/Async.h"
 
 #if PLATFORM_WINDOWS
 #include "Windows/WindowsPlatformMisc.h"
@@ -26,15 +28,356 @@
 #include <openssl/aes.h>
 #include <openssl/rand.h>
 #include <openssl/hmac.h>
+#include <openssl/sha.h>
 #endif
 
+// ============================================================================
+// Hashing Helpers
+// ============================================================================
+
+/** Streaming SHA-256 (SHA-1 padded to 32 bytes without OpenSSL, as HashSHA256) */
+class FDeskillzSha256Stream
+{
+public:
+	FDeskillzSha256Stream()
+	{
+#if WITH_SSL
+		SHA256_Init(&Context);
+#endif
+	}
+	
+	void Update(const void* Data, int32 Size)
+	{
+#if WITH_SSL
+		SHA256_Update(&Context, Data, Size);
+#else
+		Sha1.Update(static_cast<const uint8*>(Data), Size);
+#endif
+	}
+	
+	void Final(uint8 (&OutHash)[32])
+	{
+#if WITH_SSL
+		SHA256_Final(OutHash, &Context);
+#else
+		Sha1.Final();
+		Sha1.GetHash(OutHash);
+		FMemory::Memset(OutHash + 20, 0, 12);
+#endif
+	}
+	
+private:
+#if WITH_SSL
+	SHA256_CTX Context;
+#else
+	FSHA1 Sha1;
+#endif
+};
+
+/** Write a little-endian integer into a record buffer */
+template<typename IntType>
+static uint8* WriteRecordInt(uint8* Dest, IntType Value)
+{
+	for (int32 i = 0; i < (int32)sizeof(IntType); i++)
+	{
+		Dest[i] = static_cast<uint8>(static_cast<uint64>(Value) >> (i * 8));
+	}
+	return Dest + sizeof(IntType);
+}
+
+/** Lowercase hex encoding */
+static FString BytesToLowerHex(const uint8* Bytes, int32 Num)
+{
+	static const TCHAR Digits[] = TEXT("0123456789abcdef");
+	
+	FString HexString;
+	TArray<TCHAR, FString::AllocatorType>& Chars = HexString.GetCharArray();
+	Chars.SetNumUninitialized(Num * 2 + 1);
+	
+	for (int32 i = 0; i < Num; i++)
+	{
+		Chars[i * 2] = Digits[Bytes[i] >> 4];
+		Chars[i * 2 + 1] = Digits[Bytes[i] & 0x0f];
+	}
+	Chars[Num * 2] = TEXT('\0');
+	
+	return HexString;
+}
+
+// Score trail record types
+static constexpr uint8 ScoreRecordType = 1;
+static constexpr uint8 InputRecordType = 2;
+
+// Binary score plaintext layout version (see BuildPlaintext)
+static constexpr uint8 ScorePlaintextVersion = 3;
+static constexpr int32 ScorePlaintextSize = 1 + 8 + 8 + 8 + 4 + 4 + 8 + 4 + 32 + 32 + 32;
+
+// ============================================================================
+// FDeskillzScoreCipher
+// ============================================================================
+
+/**
+ * AES-256-GCM context and keys for one match
+ * 
+ * Created in Initialize and shared with background encrypt tasks, so the
+ * cipher context is allocated once rather than per score.
+ */
+class FDeskillzScoreCipher
+{
+public:
+	FDeskillzScoreCipher(TArray<uint8>&& InEncryptionKey, TArray<uint8>&& InSigningKey)
+		: EncryptionKey(MoveTemp(InEncryptionKey))
+		, SigningKey(MoveTemp(InSigningKey))
+	{
+#if WITH_SSL
+		Context = EVP_CIPHER_CTX_new();
+#endif
+	}
+	
+	~FDeskillzScoreCipher()
+	{
+#if WITH_SSL
+		if (Context)
+		{
+			EVP_CIPHER_CTX_free(Context);
+		}
+#endif
+		FMemory::Memzero(EncryptionKey.GetData(), EncryptionKey.Num());
+		FMemory::Memzero(SigningKey.GetData(), SigningKey.Num());
+	}
+	
+	int32 GetEncryptionKeySize() const { return EncryptionKey.Num(); }
+	bool HasSigningKey() const { return SigningKey.Num() > 0; }
+	
+	/** AES-256-GCM encryption (serialized; the context is shared) */
+	bool Encrypt(const TArray<uint8>& Plaintext, const TArray<uint8>& IV, const TArray<uint8>& AAD,
+		TArray<uint8>& Ciphertext, TArray<uint8>& AuthTag) const
+	{
+#if WITH_SSL
+		FScopeLock ScopeLock(&Lock);
+		
+		if (!Context)
+		{
+			return false;
+		}
+		
+		int32 len;
+		int32 ciphertext_len;
+		
+		// Initialize encryption (re-initializing reuses the context's allocations)
+		if (EVP_EncryptInit_ex(Context, EVP_aes_256_gcm(), NULL, NULL, NULL) != 1)
+		{
+			return false;
+		}
+		
+		// Set IV length (12 bytes for GCM)
+		if (EVP_CIPHER_CTX_ctrl(Context, EVP_CTRL_GCM_SET_IVLEN, IV.Num(), NULL) != 1)
+		{
+			return false;
+		}
+		
+		// Set key and IV
+		if (EVP_EncryptInit_ex(Context, NULL, NULL, EncryptionKey.GetData(), IV.GetData()) != 1)
+		{
+			return false;
+		}
+		
+		// Set AAD
+		if (AAD.Num() > 0)
+		{
+			if (EVP_EncryptUpdate(Context, NULL, &len, AAD.GetData(), AAD.Num()) != 1)
+			{
+				return false;
+			}
+		}
+		
+		// Encrypt
+		Ciphertext.SetNumUninitialized(Plaintext.Num() + 16); // Extra space for padding
+		if (EVP_EncryptUpdate(Context, Ciphertext.GetData(), &len, Plaintext.GetData(), Plaintext.Num()) != 1)
+		{
+			return false;
+		}
+		ciphertext_len = len;
+		
+		// Finalize
+		if (EVP_EncryptFinal_ex(Context, Ciphertext.GetData() + len, &len) != 1)
+		{
+			return false;
+		}
+		ciphertext_len += len;
+		Ciphertext.SetNum(ciphertext_len);
+		
+		// Get auth tag (16 bytes)
+		AuthTag.SetNumUninitialized(16);
+		if (EVP_CIPHER_CTX_ctrl(Context, EVP_CTRL_GCM_GET_TAG, 16, AuthTag.GetData()) != 1)
+		{
+			return false;
+		}
+		
+		return true;
+#else
+		// Software fallback (XOR-based, less secure)
+		// This is a simplified implementation for platforms without OpenSSL
+		
+		UE_LOG(LogDeskillz, Warning, TEXT("Using software encryption fallback (OpenSSL not available)"));
+		
+		Ciphertext.SetNum(Plaintext.Num());
+		AuthTag.SetNumUninitialized(16);
+		
+		// Simple XOR encryption (NOT cryptographically secure, just a placeholder)
+		for (int32 i = 0; i < Plaintext.Num(); i++)
+		{
+			Ciphertext[i] = Plaintext[i] ^ EncryptionKey[i % EncryptionKey.Num()] ^ IV[i % IV.Num()];
+		}
+		
+		// Generate a simple auth tag
+		uint32 Hash = 0;
+		for (int32 i = 0; i < Ciphertext.Num(); i++)
+		{
+			Hash = Hash * 31 + Ciphertext[i];
+		}
+		FMemory::Memcpy(AuthTag.GetData(), &Hash, sizeof(Hash));
+		
+		return true;
+#endif
+	}
+
+	/** AES-256-GCM decryption; false if the auth tag doesn't match */
+	bool Decrypt(const uint8* Ciphertext, int32 CiphertextSize, const TArray<uint8>& IV, const TArray<uint8>& AAD,
+		const uint8* AuthTag, TArray<uint8>& Plaintext) const
+	{
+#if WITH_SSL
+		FScopeLock ScopeLock(&Lock);
+
+		if (!Context)
+		{
+			return false;
+		}
+
+		int32 len;
+		int32 plaintext_len;
+
+		if (EVP_DecryptInit_ex(Context, EVP_aes_256_gcm(), NULL, NULL, NULL) != 1)
+		{
+			return false;
+		}
+
+		if (EVP_CIPHER_CTX_ctrl(Context, EVP_CTRL_GCM_SET_IVLEN, IV.Num(), NULL) != 1)
+		{
+			return false;
+		}
+
+		if (EVP_DecryptInit_ex(Context, NULL, NULL, EncryptionKey.GetData(), IV.GetData()) != 1)
+		{
+			return false;
+		}
+
+		if (AAD.Num() > 0)
+		{
+			if (EVP_DecryptUpdate(Context, NULL, &len, AAD.GetData(), AAD.Num()) != 1)
+			{
+				return false;
+			}
+		}
+
+		Plaintext.SetNumUninitialized(CiphertextSize + 16);
+		if (EVP_DecryptUpdate(Context, Plaintext.GetData(), &len, Ciphertext, CiphertextSize) != 1)
+		{
+			return false;
+		}
+		plaintext_len = len;
+
+		// Expected tag must be set before finalizing
+		if (EVP_CIPHER_CTX_ctrl(Context, EVP_CTRL_GCM_SET_TAG, 16, const_cast<uint8*>(AuthTag)) != 1)
+		{
+			return false;
+		}
+
+		if (EVP_DecryptFinal_ex(Context, Plaintext.GetData() + len, &len) != 1)
+		{
+			Plaintext.Empty();
+			return false;
+		}
+		plaintext_len += len;
+		Plaintext.SetNum(plaintext_len);
+
+		return true;
+#else
+		// Software fallback (mirrors Encrypt)
+		uint32 Hash = 0;
+		for (int32 i = 0; i < CiphertextSize; i++)
+		{
+			Hash = Hash * 31 + Ciphertext[i];
+		}
+		if (FMemory::Memcmp(AuthTag, &Hash, sizeof(Hash)) != 0)
+		{
+			return false;
+		}
+
+		Plaintext.SetNum(CiphertextSize);
+		for (int32 i = 0; i < CiphertextSize; i++)
+		{
+			Plaintext[i] = Ciphertext[i] ^ EncryptionKey[i % EncryptionKey.Num()] ^ IV[i % IV.Num()];
+		}
+
+		return true;
+#endif
+	}
+
+	/** HMAC-SHA256 signature */
+	TArray<uint8> Sign(const FString& Payload) const
+	{
+		FTCHARToUTF8 Data(*Payload);
+		
+		TArray<uint8> Result;
+		Result.SetNumUninitialized(32);
+		
+#if WITH_SSL
+		unsigned int len = 32;
+		HMAC(EVP_sha256(), SigningKey.GetData(), SigningKey.Num(), (const uint8*)Data.Get(), Data.Length(), Result.GetData(), &len);
+#else
+		// Software fallback
+		// Simple keyed hash (NOT cryptographically secure)
+		uint64 Hash[4] = { 0 };
+		
+		for (int32 i = 0; i < Data.Length(); i++)
+		{
+			Hash[i % 4] = Hash[i % 4] * 31 + (uint8)Data.Get()[i] + SigningKey[i % SigningKey.Num()];
+		}
+		
+		FMemory::Memcpy(Result.GetData(), Hash, 32);
+#endif
+		
+		return Result;
+	}
+	
+private:
+	TArray<uint8> EncryptionKey;
+	TArray<uint8> SigningKey;
+	
+#if WITH_SSL
+	EVP_CIPHER_CTX* Context = nullptr;
+#endif
+	
+	mutable FCriticalSection Lock;
+};
+
 // ============================================================================
 // FDeskillzEncryptedScore Implementation
 // ============================================================================
 
 FString FDeskillzEncryptedScore::ToJson() const
 {
-	TSharedPtr<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+	FString OutputString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+	FJsonSerializer::Serialize(ToJsonObject(), Writer);
+	
+	return OutputString;
+}
+
+TSharedRef<FJsonObject> FDeskillzEncryptedScore::ToJsonObject() const
+{
+	TSharedRef<FJsonObject> JsonObject = MakeShared<FJsonObject>();
 	
 	JsonObject->SetStringField(TEXT("encryptedData"), EncryptedData);
 	JsonObject->SetStringField(TEXT("iv"), IV);
@@ -46,11 +389,12 @@ FString FDeskillzEncryptedScore::ToJson() const
 	JsonObject->SetStringField(TEXT("deviceFingerprint"), DeviceFingerprint);
 	JsonObject->SetNumberField(TEXT("version"), Version);
 	
-	FString OutputString;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-	FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
+	if (!Replay.IsEmpty())
+	{
+		JsonObject->SetStringField(TEXT("replay"), Replay);
+	}
 	
-	return OutputString;
+	return JsonObject;
 }
 
 FDeskillzEncryptedScore FDeskillzEncryptedScore::FromJson(const FString& JsonString)
@@ -70,6 +414,7 @@ FDeskillzEncryptedScore FDeskillzEncryptedScore::FromJson(const FString& JsonStr
 		JsonObject->TryGetStringField(TEXT("nonce"), Result.Nonce);
 		JsonObject->TryGetStringField(TEXT("matchId"), Result.MatchId);
 		JsonObject->TryGetStringField(TEXT("deviceFingerprint"), Result.DeviceFingerprint);
+		JsonObject->TryGetStringField(TEXT("replay"), Result.Replay);
 		
 		int32 VersionInt;
 		if (JsonObject->TryGetNumberField(TEXT("version"), VersionInt))
@@ -93,26 +438,35 @@ UDeskillzScoreEncryption::UDeskillzScoreEncryption()
 void UDeskillzScoreEncryption::Initialize(const FString& InEncryptionKey, const FString& InSigningKey, const FString& MatchId)
 {
 	// Decode keys from Base64
-	EncryptionKey = FromBase64(InEncryptionKey);
-	SigningKey = FromBase64(InSigningKey);
+	TSharedPtr<FDeskillzScoreCipher, ESPMode::ThreadSafe> NewCipher =
+		MakeShared<FDeskillzScoreCipher, ESPMode::ThreadSafe>(FromBase64(InEncryptionKey), FromBase64(InSigningKey));
 	CurrentMatchId = MatchId;
 	
 	// Validate key lengths
-	if (EncryptionKey.Num() != 32) // AES-256 requires 32 bytes
+	if (NewCipher->GetEncryptionKeySize() != 32) // AES-256 requires 32 bytes
 	{
-		UE_LOG(LogDeskillz, Error, TEXT("Invalid encryption key length: %d (expected 32)"), EncryptionKey.Num());
+		UE_LOG(LogDeskillz, Error, TEXT("Invalid encryption key length: %d (expected 32)"), NewCipher->GetEncryptionKeySize());
+		Cipher.Reset();
 		bIsInitialized = false;
 		return;
 	}
 	
+	Cipher = NewCipher;
+	
+	// Fingerprint doesn't change during the process; compute it now rather than at submission
+	if (CachedDeviceFingerprint.IsEmpty())
+	{
+		CachedDeviceFingerprint = ComputeDeviceFingerprint();
+	}
+	
 	// Reset state
 	ScoreTrail.Empty();
-	RunningScoreHash = TEXT("");
+	ResetScoreChain();
 	InputEventCount = 0;
 	SessionStartTime = GetTimestampMs();
 	FrameCount = 0;
 	FPSSamples.Empty();
-	UsedNonces.Empty();
+	UsedNonces.Reset();
 	
 	bIsInitialized = true;
 	
@@ -121,13 +475,13 @@ void UDeskillzScoreEncryption::Initialize(const FString& InEncryptionKey, const
 
 void UDeskillzScoreEncryption::Reset()
 {
-	EncryptionKey.Empty();
-	SigningKey.Empty();
+	// In-flight encrypt tasks keep their own reference; keys are wiped when the last one finishes
+	Cipher.Reset();
 	CurrentMatchId.Empty();
 	ScoreTrail.Empty();
-	RunningScoreHash.Empty();
+	ResetScoreChain();
 	InputEventCount = 0;
-	UsedNonces.Empty();
+	UsedNonces.Reset();
 	bIsInitialized = false;
 	
 	UE_LOG(LogDeskillz, Log, TEXT("Score encryption reset"));
@@ -135,99 +489,84 @@ void UDeskillzScoreEncryption::Reset()
 
 FDeskillzEncryptedScore UDeskillzScoreEncryption::EncryptScore(int64 Score, const FDeskillzScoreIntegrity& Integrity)
 {
-	FDeskillzEncryptedScore Result;
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzEncryptScore, DeskillzSecurityChannel);
 	
-	if (!bIsInitialized)
+	FPendingScore Pending;
+	if (!PrepareScore(Score, Integrity, Pending))
 	{
-		UE_LOG(LogDeskillz, Error, TEXT("Cannot encrypt score: encryption not initialized"));
-		return Result;
+		return FDeskillzEncryptedScore();
 	}
 	
-	// Build payload JSON
-	TSharedPtr<FJsonObject> PayloadJson = MakeShared<FJsonObject>();
-	PayloadJson->SetNumberField(TEXT("score"), Score);
-	PayloadJson->SetNumberField(TEXT("randomSeed"), Integrity.RandomSeed);
-	PayloadJson->SetNumberField(TEXT("sessionDurationMs"), Integrity.SessionDurationMs);
-	PayloadJson->SetNumberField(TEXT("scoreUpdateCount"), Integrity.ScoreUpdateCount);
-	PayloadJson->SetStringField(TEXT("gameStateHash"), Integrity.GameStateHash);
-	PayloadJson->SetNumberField(TEXT("inputEventCount"), Integrity.InputEventCount);
-	PayloadJson->SetNumberField(TEXT("frameCount"), Integrity.FrameCount);
-	PayloadJson->SetNumberField(TEXT("averageFPS"), Integrity.AverageFPS);
-	PayloadJson->SetStringField(TEXT("scoreTrailHash"), Integrity.ScoreTrailHash);
-	
-	FString PayloadString;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&PayloadString);
-	FJsonSerializer::Serialize(PayloadJson.ToSharedRef(), Writer);
-	
-	// Convert to bytes
-	TArray<uint8> PlaintextBytes;
-	FTCHARToUTF8 Converter(*PayloadString);
-	PlaintextBytes.Append((uint8*)Converter.Get(), Converter.Length());
-	
-	// Generate IV (12 bytes for GCM)
-	TArray<uint8> IV = GenerateIV();
-	
-	// Generate nonce
-	FString Nonce = GenerateNonce();
-	
-	// Prevent nonce reuse
-	if (UsedNonces.Contains(Nonce))
+	FDeskillzEncryptedScore Result = EncryptPendingScore(*Cipher, Pending);
+	if (Result.IsValid())
 	{
-		UE_LOG(LogDeskillz, Warning, TEXT("Nonce collision detected, regenerating"));
-		Nonce = GenerateNonce();
+		UE_LOG(LogDeskillz, Log, TEXT("Score %lld encrypted successfully"), Score);
 	}
-	UsedNonces.Add(Nonce);
-	
-	// Additional authenticated data (AAD)
-	FString AADString = FString::Printf(TEXT("%s|%s|%lld"), *CurrentMatchId, *Nonce, GetTimestampMs());
-	TArray<uint8> AADBytes;
-	FTCHARToUTF8 AADConverter(*AADString);
-	AADBytes.Append((uint8*)AADConverter.Get(), AADConverter.Length());
 	
-	// Encrypt with AES-256-GCM
-	TArray<uint8> Ciphertext;
-	TArray<uint8> AuthTag;
+	return Result;
+}
+
+FDeskillzEncryptedScore UDeskillzScoreEncryption::EncryptScoreSimple(int64 Score)
+{
+	// EncryptScore owns the stat; counting here too would double every call
+	FDeskillzScoreIntegrity Integrity = CollectIntegrityData(Score);
+	return EncryptScore(Score, Integrity);
+}
+
+void UDeskillzScoreEncryption::EncryptScoreAsync(int64 Score, const FDeskillzScoreIntegrity& Integrity, FOnScoreEncrypted OnComplete)
+{
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzEncryptScore, DeskillzSecurityChannel);
 	
-	if (!AES256GCMEncrypt(PlaintextBytes, EncryptionKey, IV, AADBytes, Ciphertext, AuthTag))
+	FPendingScore Pending;
+	if (!PrepareScore(Score, Integrity, Pending))
 	{
-		UE_LOG(LogDeskillz, Error, TEXT("AES-256-GCM encryption failed"));
-		return Result;
+		OnComplete.ExecuteIfBound(FDeskillzEncryptedScore());
+		return;
 	}
 	
-	// Build result
-	Result.EncryptedData = ToBase64(Ciphertext);
-	Result.IV = ToBase64(IV);
-	Result.AuthTag = ToBase64(AuthTag);
-	Result.Timestamp = GetTimestampMs();
-	Result.Nonce = Nonce;
-	Result.MatchId = CurrentMatchId;
-	Result.DeviceFingerprint = GetDeviceFingerprint();
-	Result.Version = 1;
+	TSharedPtr<FDeskillzScoreCipher, ESPMode::ThreadSafe> TaskCipher = Cipher;
 	
-	// Sign the payload
-	FString SigningPayload = BuildSigningPayload(Result.EncryptedData, Result.IV, Result.Timestamp, Result.Nonce);
-	
-	TArray<uint8> SigningPayloadBytes;
-	FTCHARToUTF8 SigningConverter(*SigningPayload);
-	SigningPayloadBytes.Append((uint8*)SigningConverter.Get(), SigningConverter.Length());
-	
-	TArray<uint8> SignatureBytes = HMACSHA256(SigningPayloadBytes, SigningKey);
-	Result.Signature = ToBase64(SignatureBytes);
-	
-	UE_LOG(LogDeskillz, Log, TEXT("Score %lld encrypted successfully"), Score);
-	
-	return Result;
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask,
+		[TaskCipher, Pending = MoveTemp(Pending), OnComplete = MoveTemp(OnComplete), Score]() mutable
+	{
+		FDeskillzEncryptedScore Result = EncryptPendingScore(*TaskCipher, Pending);
+		
+		AsyncTask(ENamedThreads::GameThread, [Result = MoveTemp(Result), OnComplete = MoveTemp(OnComplete), Score]()
+		{
+			if (Result.IsValid())
+			{
+				UE_LOG(LogDeskillz, Log, TEXT("Score %lld encrypted successfully"), Score);
+			}
+			OnComplete.ExecuteIfBound(Result);
+		});
+	});
 }
 
-FDeskillzEncryptedScore UDeskillzScoreEncryption::EncryptScoreSimple(int64 Score)
+void UDeskillzScoreEncryption::EncryptScoreSimpleAsync(int64 Score, FOnScoreEncrypted OnComplete, const FString& ReplayHash)
 {
 	FDeskillzScoreIntegrity Integrity = CollectIntegrityData(Score);
-	return EncryptScore(Score, Integrity);
+	Integrity.ReplayHash = ReplayHash;
+	EncryptScoreAsync(Score, Integrity, MoveTemp(OnComplete));
+}
+
+bool UDeskillzScoreEncryption::HasSigningKey() const
+{
+	return bIsInitialized && Cipher.IsValid() && Cipher->HasSigningKey();
+}
+
+FString UDeskillzScoreEncryption::SignPayload(const FString& Payload) const
+{
+	if (!HasSigningKey())
+	{
+		return FString();
+	}
+	
+	return ToBase64(Cipher->Sign(Payload));
 }
 
 bool UDeskillzScoreEncryption::VerifySignature(const FDeskillzEncryptedScore& EncryptedScore) const
 {
-	if (!bIsInitialized || SigningKey.Num() == 0)
+	if (!bIsInitialized || !Cipher.IsValid() || !Cipher->HasSigningKey())
 	{
 		return false;
 	}
@@ -237,15 +576,12 @@ bool UDeskillzScoreEncryption::VerifySignature(const FDeskillzEncryptedScore& En
 		EncryptedScore.EncryptedData, 
 		EncryptedScore.IV, 
 		EncryptedScore.Timestamp, 
-		EncryptedScore.Nonce
+		EncryptedScore.Nonce,
+		CurrentMatchId
 	);
 	
-	TArray<uint8> SigningPayloadBytes;
-	FTCHARToUTF8 Converter(*SigningPayload);
-	SigningPayloadBytes.Append((uint8*)Converter.Get(), Converter.Length());
-	
 	// Compute expected signature
-	TArray<uint8> ExpectedSignature = HMACSHA256(SigningPayloadBytes, SigningKey);
+	TArray<uint8> ExpectedSignature = Cipher->Sign(SigningPayload);
 	FString ExpectedSignatureBase64 = ToBase64(ExpectedSignature);
 	
 	// Compare (constant-time comparison for security)
@@ -275,19 +611,40 @@ void UDeskillzScoreEncryption::RecordScoreUpdate(int64 NewScore)
 
 void UDeskillzScoreEncryption::RecordInputEvent(const FString& InputType, const FString& InputData)
 {
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzScoreHash, DeskillzSecurityChannel);
+	
 	InputEventCount++;
 	
-	// Include in score hash for verification
-	FString InputHash = FString::Printf(TEXT("%s|%s|%lld"), *InputType, *InputData, GetTimestampMs());
-	RunningScoreHash = HashSHA256(RunningScoreHash + InputHash);
+	// Include in score hash for verification: type and timestamp, then length-prefixed strings
+	uint8 Record[1 + sizeof(int64)];
+	uint8* Cursor = Record;
+	*Cursor++ = InputRecordType;
+	WriteRecordInt<int64>(Cursor, GetTimestampMs());
+	
+	ChainScoreRecord(Record, sizeof(Record), &InputType, &InputData);
 }
 
 FString UDeskillzScoreEncryption::GetScoreTrailHash() const
 {
-	return RunningScoreHash;
+	if (!bHasScoreChain)
+	{
+		return FString();
+	}
+	
+	return BytesToLowerHex(ScoreChainState, sizeof(ScoreChainState));
 }
 
 FString UDeskillzScoreEncryption::GetDeviceFingerprint() const
+{
+	if (CachedDeviceFingerprint.IsEmpty())
+	{
+		CachedDeviceFingerprint = ComputeDeviceFingerprint();
+	}
+	
+	return CachedDeviceFingerprint;
+}
+
+FString UDeskillzScoreEncryption::ComputeDeviceFingerprint()
 {
 	// Build fingerprint from device characteristics
 	FString Fingerprint;
@@ -357,8 +714,8 @@ FString UDeskillzScoreEncryption::GenerateNonce()
 
 int64 UDeskillzScoreEncryption::GetTimestampMs()
 {
-	return FDateTime::UtcNow().ToUnixTimestamp() * 1000 + 
-		   (FDateTime::UtcNow().GetMillisecond());
+	const FDateTime Now = FDateTime::UtcNow();
+	return Now.ToUnixTimestamp() * 1000 + Now.GetMillisecond();
 }
 
 FString UDeskillzScoreEncryption::HashSHA256(const FString& Data)
@@ -384,14 +741,18 @@ FString UDeskillzScoreEncryption::HashSHA256(const FString& Data)
 	FMemory::Memset(HashBytes + 20, 0, 12); // Pad to 32 bytes
 #endif
 	
-	// Convert to hex string
-	FString HexString;
-	for (int32 i = 0; i < 32; i++)
-	{
-		HexString += FString::Printf(TEXT("%02x"), HashBytes[i]);
-	}
+	return BytesToLowerHex(HashBytes, 32);
+}
+
+FString UDeskillzScoreEncryption::HashBytesSHA256(const TArray<uint8>& Bytes)
+{
+	uint8 HashBytes[32];
 	
-	return HexString;
+	FDeskillzSha256Stream Hasher;
+	Hasher.Update(Bytes.GetData(), Bytes.Num());
+	Hasher.Final(HashBytes);
+	
+	return BytesToLowerHex(HashBytes, 32);
 }
 
 FString UDeskillzScoreEncryption::ToBase64(const TArray<uint8>& Bytes)
@@ -407,173 +768,262 @@ TArray<uint8> UDeskillzScoreEncryption::FromBase64(const FString& Base64String)
 }
 
 // ============================================================================
-// Internal Methods
+// Local Storage
 // ============================================================================
 
-bool UDeskillzScoreEncryption::AES256GCMEncrypt(
-	const TArray<uint8>& Plaintext,
-	const TArray<uint8>& Key,
-	const TArray<uint8>& IV,
-	const TArray<uint8>& AAD,
-	TArray<uint8>& Ciphertext,
-	TArray<uint8>& AuthTag)
+static constexpr uint8 LocalDataVersion = 1;
+static constexpr int32 LocalDataIVSize = 12;
+static constexpr int32 LocalDataTagSize = 16;
+static constexpr int32 LocalDataHeaderSize = 1 + LocalDataIVSize + LocalDataTagSize;
+
+/** Cipher keyed from the device ID, built on first use */
+static const FDeskillzScoreCipher& GetLocalDataCipher()
 {
-#if WITH_SSL
-	EVP_CIPHER_CTX* ctx = EVP_CIPHER_CTX_new();
-	if (!ctx)
+	static const TSharedRef<FDeskillzScoreCipher, ESPMode::ThreadSafe> LocalCipher = []()
 	{
-		return false;
-	}
-	
-	bool bSuccess = false;
-	int32 len;
-	int32 ciphertext_len;
-	
-	// Initialize encryption
-	if (EVP_EncryptInit_ex(ctx, EVP_aes_256_gcm(), NULL, NULL, NULL) != 1)
+		static const char KeyContext[] = "Deskillz.LocalStore.v1";
+		FTCHARToUTF8 DeviceId(*UDeskillzScoreEncryption::GetDeviceId());
+
+		FDeskillzSha256Stream Hasher;
+		Hasher.Update(KeyContext, sizeof(KeyContext) - 1);
+		Hasher.Update(DeviceId.Get(), DeviceId.Length());
+
+		uint8 KeyBytes[32];
+		Hasher.Final(KeyBytes);
+		TArray<uint8> Key(KeyBytes, UE_ARRAY_COUNT(KeyBytes));
+		FMemory::Memzero(KeyBytes, sizeof(KeyBytes));
+
+		return MakeShared<FDeskillzScoreCipher, ESPMode::ThreadSafe>(MoveTemp(Key), TArray<uint8>());
+	}();
+
+	return *LocalCipher;
+}
+
+TArray<uint8> UDeskillzScoreEncryption::SealLocalData(const TArray<uint8>& Plaintext)
+{
+	const TArray<uint8> IV = GenerateIV();
+	const TArray<uint8> AAD = { LocalDataVersion };
+
+	TArray<uint8> Ciphertext;
+	TArray<uint8> AuthTag;
+	if (!GetLocalDataCipher().Encrypt(Plaintext, IV, AAD, Ciphertext, AuthTag))
 	{
-		goto cleanup;
+		return TArray<uint8>();
 	}
-	
-	// Set IV length (12 bytes for GCM)
-	if (EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_SET_IVLEN, IV.Num(), NULL) != 1)
+
+	TArray<uint8> Sealed;
+	Sealed.Reserve(LocalDataHeaderSize + Ciphertext.Num());
+	Sealed.Add(LocalDataVersion);
+	Sealed.Append(IV);
+	Sealed.Append(AuthTag);
+	Sealed.Append(Ciphertext);
+	return Sealed;
+}
+
+bool UDeskillzScoreEncryption::OpenLocalData(const TArray<uint8>& Sealed, TArray<uint8>& OutPlaintext)
+{
+	if (Sealed.Num() < LocalDataHeaderSize || Sealed[0] != LocalDataVersion)
 	{
-		goto cleanup;
+		return false;
 	}
+
+	const TArray<uint8> IV(Sealed.GetData() + 1, LocalDataIVSize);
+	const TArray<uint8> AAD = { LocalDataVersion };
+
+	return GetLocalDataCipher().Decrypt(
+		Sealed.GetData() + LocalDataHeaderSize, Sealed.Num() - LocalDataHeaderSize,
+		IV, AAD, Sealed.GetData() + 1 + LocalDataIVSize, OutPlaintext);
+}
+
+// ============================================================================
+// Internal Methods
+// ============================================================================
+
+TArray<uint8> UDeskillzScoreEncryption::GenerateIV()
+{
+	TArray<uint8> IV;
+	IV.SetNumUninitialized(12); // GCM standard IV size
 	
-	// Set key and IV
-	if (EVP_EncryptInit_ex(ctx, NULL, NULL, Key.GetData(), IV.GetData()) != 1)
-	{
-		goto cleanup;
-	}
+#if WITH_SSL
+	RAND_bytes(IV.GetData(), 12);
+#else
+	// Fallback: use time-based random
+	FGuid Guid = FGuid::NewGuid();
+	FMemory::Memcpy(IV.GetData(), &Guid, 12);
+#endif
 	
-	// Set AAD
-	if (AAD.Num() > 0)
+	return IV;
+}
+
+FString UDeskillzScoreEncryption::BuildSigningPayload(const FString& EncryptedData, const FString& IVStr, int64 Timestamp, const FString& Nonce, const FString& MatchId)
+{
+	return FString::Printf(TEXT("%s|%s|%lld|%s|%s"), 
+		*EncryptedData, 
+		*IVStr, 
+		Timestamp, 
+		*Nonce,
+		*MatchId);
+}
+
+TArray<uint8> UDeskillzScoreEncryption::BuildPlaintext(int64 Score, const FDeskillzScoreIntegrity& Integrity)
+{
+	// Little-endian, fixed offsets:
+	// version u8 | score i64 | randomSeed i64 | sessionDurationMs i64 | scoreUpdateCount i32 |
+	// inputEventCount i32 | frameCount i64 | averageFPS f32 | gameStateHash [32] | scoreTrailHash [32] |
+	// replayHash [32]
+	// The replay travels outside the ciphertext; the server must match SHA-256 of its
+	// decoded bytes against replayHash (all zero = no replay) before using it.
+	TArray<uint8> Plaintext;
+	Plaintext.SetNumZeroed(ScorePlaintextSize);
+	
+	uint8* Cursor = Plaintext.GetData();
+	*Cursor++ = ScorePlaintextVersion;
+	Cursor = WriteRecordInt<int64>(Cursor, Score);
+	Cursor = WriteRecordInt<int64>(Cursor, Integrity.RandomSeed);
+	Cursor = WriteRecordInt<int64>(Cursor, Integrity.SessionDurationMs);
+	Cursor = WriteRecordInt<int32>(Cursor, Integrity.ScoreUpdateCount);
+	Cursor = WriteRecordInt<int32>(Cursor, Integrity.InputEventCount);
+	Cursor = WriteRecordInt<int64>(Cursor, Integrity.FrameCount);
+	
+	uint32 FPSBits;
+	FMemory::Memcpy(&FPSBits, &Integrity.AverageFPS, sizeof(FPSBits));
+	Cursor = WriteRecordInt<uint32>(Cursor, FPSBits);
+	
+	// Hashes are 64 hex chars; anything else (e.g. no trail yet) stays zeroed
+	if (Integrity.GameStateHash.Len() == 64)
 	{
-		if (EVP_EncryptUpdate(ctx, NULL, &len, AAD.GetData(), AAD.Num()) != 1)
-		{
-			goto cleanup;
-		}
+		HexToBytes(Integrity.GameStateHash, Cursor);
 	}
+	Cursor += 32;
 	
-	// Encrypt
-	Ciphertext.SetNumUninitialized(Plaintext.Num() + 16); // Extra space for padding
-	if (EVP_EncryptUpdate(ctx, Ciphertext.GetData(), &len, Plaintext.GetData(), Plaintext.Num()) != 1)
+	if (Integrity.ScoreTrailHash.Len() == 64)
 	{
-		goto cleanup;
+		HexToBytes(Integrity.ScoreTrailHash, Cursor);
 	}
-	ciphertext_len = len;
+	Cursor += 32;
 	
-	// Finalize
-	if (EVP_EncryptFinal_ex(ctx, Ciphertext.GetData() + len, &len) != 1)
+	if (Integrity.ReplayHash.Len() == 64)
 	{
-		goto cleanup;
+		HexToBytes(Integrity.ReplayHash, Cursor);
 	}
-	ciphertext_len += len;
-	Ciphertext.SetNum(ciphertext_len);
 	
-	// Get auth tag (16 bytes)
-	AuthTag.SetNumUninitialized(16);
-	if (EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_GET_TAG, 16, AuthTag.GetData()) != 1)
+	return Plaintext;
+}
+
+bool UDeskillzScoreEncryption::PrepareScore(int64 Score, const FDeskillzScoreIntegrity& Integrity, FPendingScore& OutPending)
+{
+	if (!bIsInitialized || !Cipher.IsValid())
 	{
-		goto cleanup;
+		UE_LOG(LogDeskillz, Error, TEXT("Cannot encrypt score: encryption not initialized"));
+		return false;
 	}
 	
-	bSuccess = true;
-	
-cleanup:
-	EVP_CIPHER_CTX_free(ctx);
-	return bSuccess;
+	OutPending.Plaintext = BuildPlaintext(Score, Integrity);
 	
-#else
-	// Software fallback (XOR-based, less secure)
-	// This is a simplified implementation for platforms without OpenSSL
-	
-	UE_LOG(LogDeskillz, Warning, TEXT("Using software encryption fallback (OpenSSL not available)"));
+	// Generate IV (12 bytes for GCM)
+	OutPending.IV = GenerateIV();
 	
-	Ciphertext.SetNum(Plaintext.Num());
-	AuthTag.SetNumUninitialized(16);
+	// Generate nonce
+	FString Nonce = GenerateNonce();
 	
-	// Simple XOR encryption (NOT cryptographically secure, just a placeholder)
-	for (int32 i = 0; i < Plaintext.Num(); i++)
+	// Prevent nonce reuse
+	const double Now = FPlatformTime::Seconds();
+	if (!UsedNonces.CheckAndInsert(FDeskillzReplayFilter::HashNonce(Nonce), Now))
 	{
-		Ciphertext[i] = Plaintext[i] ^ Key[i % Key.Num()] ^ IV[i % IV.Num()];
+		UE_LOG(LogDeskillz, Warning, TEXT("Nonce collision detected, regenerating"));
+		Nonce = GenerateNonce();
+		UsedNonces.CheckAndInsert(FDeskillzReplayFilter::HashNonce(Nonce), Now);
 	}
 	
-	// Generate a simple auth tag
-	uint32 Hash = 0;
-	for (int32 i = 0; i < Ciphertext.Num(); i++)
-	{
-		Hash = Hash * 31 + Ciphertext[i];
-	}
-	FMemory::Memcpy(AuthTag.GetData(), &Hash, sizeof(Hash));
+	OutPending.Nonce = Nonce;
+	OutPending.MatchId = CurrentMatchId;
+	OutPending.DeviceFingerprint = GetDeviceFingerprint();
+	OutPending.Timestamp = GetTimestampMs();
+	
+	// Additional authenticated data (AAD)
+	FString AADString = FString::Printf(TEXT("%s|%s|%lld"), *CurrentMatchId, *Nonce, OutPending.Timestamp);
+	FTCHARToUTF8 AADConverter(*AADString);
+	OutPending.AAD.Append((uint8*)AADConverter.Get(), AADConverter.Length());
 	
 	return true;
-#endif
 }
 
-TArray<uint8> UDeskillzScoreEncryption::HMACSHA256(const TArray<uint8>& Data, const TArray<uint8>& Key)
+FDeskillzEncryptedScore UDeskillzScoreEncryption::EncryptPendingScore(const FDeskillzScoreCipher& InCipher, const FPendingScore& Pending)
 {
-	TArray<uint8> Result;
-	Result.SetNumUninitialized(32);
+	FDeskillzEncryptedScore Result;
 	
-#if WITH_SSL
-	unsigned int len = 32;
-	HMAC(EVP_sha256(), Key.GetData(), Key.Num(), Data.GetData(), Data.Num(), Result.GetData(), &len);
-#else
-	// Software fallback
-	// Simple keyed hash (NOT cryptographically secure)
-	uint64 Hash[4] = { 0 };
+	// Encrypt with AES-256-GCM
+	TArray<uint8> Ciphertext;
+	TArray<uint8> AuthTag;
 	
-	for (int32 i = 0; i < Data.Num(); i++)
+	if (!InCipher.Encrypt(Pending.Plaintext, Pending.IV, Pending.AAD, Ciphertext, AuthTag))
 	{
-		Hash[i % 4] = Hash[i % 4] * 31 + Data[i] + Key[i % Key.Num()];
+		UE_LOG(LogDeskillz, Error, TEXT("AES-256-GCM encryption failed"));
+		return Result;
 	}
 	
-	FMemory::Memcpy(Result.GetData(), Hash, 32);
-#endif
+	// Build result
+	Result.EncryptedData = ToBase64(Ciphertext);
+	Result.IV = ToBase64(Pending.IV);
+	Result.AuthTag = ToBase64(AuthTag);
+	Result.Timestamp = Pending.Timestamp;
+	Result.Nonce = Pending.Nonce;
+	Result.MatchId = Pending.MatchId;
+	Result.DeviceFingerprint = Pending.DeviceFingerprint;
+	Result.Version = ScorePlaintextVersion;
+	
+	// Sign the payload
+	FString SigningPayload = BuildSigningPayload(Result.EncryptedData, Result.IV, Result.Timestamp, Result.Nonce, Result.MatchId);
+	Result.Signature = ToBase64(InCipher.Sign(SigningPayload));
 	
 	return Result;
 }
 
-TArray<uint8> UDeskillzScoreEncryption::GenerateIV()
+void UDeskillzScoreEncryption::UpdateScoreHash(int64 Score, int64 Timestamp)
 {
-	TArray<uint8> IV;
-	IV.SetNumUninitialized(12); // GCM standard IV size
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzScoreHash, DeskillzSecurityChannel);
 	
-#if WITH_SSL
-	RAND_bytes(IV.GetData(), 12);
-#else
-	// Fallback: use time-based random
-	FGuid Guid = FGuid::NewGuid();
-	FMemory::Memcpy(IV.GetData(), &Guid, 12);
-#endif
+	uint8 Record[1 + sizeof(int64) * 2];
+	uint8* Cursor = Record;
+	*Cursor++ = ScoreRecordType;
+	Cursor = WriteRecordInt<int64>(Cursor, Score);
+	WriteRecordInt<int64>(Cursor, Timestamp);
 	
-	return IV;
+	ChainScoreRecord(Record, sizeof(Record));
 }
 
-FString UDeskillzScoreEncryption::BuildSigningPayload(const FString& EncryptedData, const FString& IVStr, int64 Timestamp, const FString& Nonce)
+void UDeskillzScoreEncryption::ChainScoreRecord(const uint8* Record, int32 RecordSize, const FString* TextA, const FString* TextB)
 {
-	return FString::Printf(TEXT("%s|%s|%lld|%s|%s"), 
-		*EncryptedData, 
-		*IVStr, 
-		Timestamp, 
-		*Nonce,
-		*CurrentMatchId);
-}
-
-void UDeskillzScoreEncryption::UpdateScoreHash(int64 Score, int64 Timestamp)
-{
-	FString Update = FString::Printf(TEXT("%lld|%lld"), Score, Timestamp);
+	FDeskillzSha256Stream Hasher;
 	
-	if (RunningScoreHash.IsEmpty())
+	if (bHasScoreChain)
 	{
-		RunningScoreHash = HashSHA256(Update);
+		Hasher.Update(ScoreChainState, sizeof(ScoreChainState));
 	}
-	else
+	
+	Hasher.Update(Record, RecordSize);
+	
+	// Length-prefixed UTF-8 so ("ab", "c") and ("a", "bc") chain differently
+	for (const FString* Text : { TextA, TextB })
 	{
-		RunningScoreHash = HashSHA256(RunningScoreHash + TEXT("|") + Update);
+		if (Text)
+		{
+			FTCHARToUTF8 Utf8(**Text);
+			uint8 Length[sizeof(int32)];
+			WriteRecordInt<int32>(Length, Utf8.Length());
+			Hasher.Update(Length, sizeof(Length));
+			Hasher.Update(Utf8.Get(), Utf8.Length());
+		}
 	}
+	
+	Hasher.Final(ScoreChainState);
+	bHasScoreChain = true;
+}
+
+void UDeskillzScoreEncryption::ResetScoreChain()
+{
+	FMemory::Memzero(ScoreChainState, sizeof(ScoreChainState));
+	bHasScoreChain = false;
 }
 
 FDeskillzScoreIntegrity UDeskillzScoreEncryption::CollectIntegrityData(int64 FinalScore)
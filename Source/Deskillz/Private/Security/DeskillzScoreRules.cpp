@@ -0,0 +1,205 @@
+// Copyright Deskillz Games. All Rights Reserved.
+
+#include "Security/DeskillzScoreRules.h"
+#include "Core/DeskillzConfig.h"
+#include "Deskillz.h"
+#include "Dom/JsonObject.h"
+
+// ============================================================================
+// FDeskillzScoreRules
+// ============================================================================
+
+FDeskillzScoreRules FDeskillzScoreRules::FromConfig()
+{
+	FDeskillzScoreRules Rules;
+
+	if (const UDeskillzConfig* Config = UDeskillzConfig::Get())
+	{
+		// Games may allow negative scores; the configured floor is honoured as is
+		Rules.MinScore = Config->MinScore;
+		Rules.MaxScore = Config->MaxScore;
+	}
+
+	return Rules;
+}
+
+FDeskillzScoreRules FDeskillzScoreRules::FromJson(const TSharedPtr<FJsonObject>& Json, const FDeskillzScoreRules& Base)
+{
+	FDeskillzScoreRules Rules = Base;
+
+	if (!Json.IsValid())
+	{
+		return Rules;
+	}
+
+	double Number = 0.0;
+	if (Json->TryGetNumberField(TEXT("minScore"), Number))
+	{
+		Rules.MinScore = static_cast<int64>(Number);
+	}
+	if (Json->TryGetNumberField(TEXT("maxScore"), Number))
+	{
+		Rules.MaxScore = static_cast<int64>(Number);
+	}
+	if (Json->TryGetNumberField(TEXT("maxScorePerSecond"), Number))
+	{
+		Rules.MaxScorePerSecond = FMath::Max(static_cast<float>(Number), 0.0f);
+	}
+	if (Json->TryGetNumberField(TEXT("maxScoreJump"), Number))
+	{
+		Rules.MaxScoreJump = FMath::Max<int64>(static_cast<int64>(Number), 0);
+	}
+	if (Json->TryGetNumberField(TEXT("maxScoreDecrease"), Number))
+	{
+		Rules.MaxScoreDecrease = FMath::Max<int64>(static_cast<int64>(Number), 0);
+	}
+	if (Json->TryGetNumberField(TEXT("checkpointIntervalSeconds"), Number))
+	{
+		Rules.CheckpointIntervalSeconds = FMath::Max(static_cast<float>(Number), 0.0f);
+	}
+	Json->TryGetBoolField(TEXT("monotonic"), Rules.bMonotonic);
+
+	if (Rules.MaxScore < Rules.MinScore)
+	{
+		UE_LOG(LogDeskillz, Warning, TEXT("Invalid score range %lld..%lld in score rules, keeping %lld..%lld"),
+			Rules.MinScore, Rules.MaxScore, Base.MinScore, Base.MaxScore);
+		Rules.MinScore = Base.MinScore;
+		Rules.MaxScore = Base.MaxScore;
+	}
+
+	return Rules;
+}
+
+// ============================================================================
+// FDeskillzScoreValidator
+// ============================================================================
+
+FDeskillzScoreValidator::FDeskillzScoreValidator(const FDeskillzScoreRules& InRules)
+	: Rules(InRules)
+{
+	MinScore = Rules.MinScore;
+	MaxScore = Rules.MaxScore;
+
+	// Disabled limits compile to values no update can exceed
+	MaxDecrease = Rules.bMonotonic ? 0 : (Rules.MaxScoreDecrease > 0 ? Rules.MaxScoreDecrease : MAX_int64);
+	MaxJump = Rules.MaxScoreJump > 0 ? Rules.MaxScoreJump : MAX_int64;
+	MaxRate = Rules.MaxScorePerSecond > 0.0f ? Rules.MaxScorePerSecond : TNumericLimits<double>::Max();
+	CheckpointInterval = Rules.CheckpointIntervalSeconds > 0.0f ? Rules.CheckpointIntervalSeconds : TNumericLimits<double>::Max();
+}
+
+FString FDeskillzScoreValidator::Describe(EDeskillzScoreRule Broken)
+{
+	TArray<FString> Names;
+	if (EnumHasAnyFlags(Broken, EDeskillzScoreRule::BelowMinimum))
+	{
+		Names.Add(TEXT("below minimum"));
+	}
+	if (EnumHasAnyFlags(Broken, EDeskillzScoreRule::AboveMaximum))
+	{
+		Names.Add(TEXT("above maximum"));
+	}
+	if (EnumHasAnyFlags(Broken, EDeskillzScoreRule::Decrease))
+	{
+		Names.Add(TEXT("decrease"));
+	}
+	if (EnumHasAnyFlags(Broken, EDeskillzScoreRule::Jump))
+	{
+		Names.Add(TEXT("jump"));
+	}
+	if (EnumHasAnyFlags(Broken, EDeskillzScoreRule::Rate))
+	{
+		Names.Add(TEXT("rate"));
+	}
+	return FString::Join(Names, TEXT(", "));
+}
+
+// ============================================================================
+// Active Rules
+// ============================================================================
+
+namespace
+{
+	struct FDeskillzActiveScoreRules
+	{
+		bool bInitialized = false;
+		FDeskillzScoreRules GameRules;
+		TMap<FString, FDeskillzScoreRules> TournamentRules;
+		FString TournamentId;
+		FDeskillzScoreValidator Validator;
+
+		void EnsureInitialized()
+		{
+			if (!bInitialized)
+			{
+				bInitialized = true;
+				GameRules = FDeskillzScoreRules::FromConfig();
+				Validator = FDeskillzScoreValidator(GameRules);
+			}
+		}
+
+		void Compile()
+		{
+			const FDeskillzScoreRules* Rules = TournamentRules.Find(TournamentId);
+			Validator = FDeskillzScoreValidator(Rules ? *Rules : GameRules);
+		}
+	};
+
+	FDeskillzActiveScoreRules& GetActiveScoreRules()
+	{
+		static FDeskillzActiveScoreRules Active;
+		Active.EnsureInitialized();
+		return Active;
+	}
+}
+
+const FDeskillzScoreValidator& FDeskillzScoreValidator::GetActive()
+{
+	return GetActiveScoreRules().Validator;
+}
+
+void FDeskillzScoreValidator::ApplyGameConfig(const TSharedPtr<FJsonObject>& GameConfig)
+{
+	if (!GameConfig.IsValid())
+	{
+		return;
+	}
+
+	FDeskillzActiveScoreRules& Active = GetActiveScoreRules();
+
+	const TSharedPtr<FJsonObject>* RulesJson = nullptr;
+	GameConfig->TryGetObjectField(TEXT("scoreRules"), RulesJson);
+	Active.GameRules = FDeskillzScoreRules::FromJson(RulesJson ? *RulesJson : nullptr, FDeskillzScoreRules::FromConfig());
+
+	// Tournament rules are partial overrides of the game rules
+	Active.TournamentRules.Reset();
+	const TSharedPtr<FJsonObject>* TournamentsJson = nullptr;
+	if (GameConfig->TryGetObjectField(TEXT("tournamentScoreRules"), TournamentsJson))
+	{
+		for (const auto& Pair : (*TournamentsJson)->Values)
+		{
+			const TSharedPtr<FJsonObject>* OverrideJson = nullptr;
+			if (Pair.Value.IsValid() && Pair.Value->TryGetObject(OverrideJson))
+			{
+				Active.TournamentRules.Add(Pair.Key, FDeskillzScoreRules::FromJson(*OverrideJson, Active.GameRules));
+			}
+		}
+	}
+
+	Active.Compile();
+
+	UE_LOG(LogDeskillz, Log, TEXT("Score rules applied: range %lld..%lld, %.0f/sec, %d tournament override(s)"),
+		Active.GameRules.MinScore, Active.GameRules.MaxScore, Active.GameRules.MaxScorePerSecond,
+		Active.TournamentRules.Num());
+}
+
+void FDeskillzScoreValidator::SelectTournament(const FString& TournamentId)
+{
+	FDeskillzActiveScoreRules& Active = GetActiveScoreRules();
+	if (Active.TournamentId == TournamentId)
+	{
+		return;
+	}
+
+	Active.TournamentId = TournamentId;
+	Active.Compile();
+}
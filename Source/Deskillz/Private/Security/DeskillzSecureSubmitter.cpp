@@ -3,7 +3,9 @@
 #include "Security/DeskillzSecureSubmitter.h"
 #include "Core/DeskillzSDK.h"
 #include "Core/DeskillzConfig.h"
+#include "Security/DeskillzScoreRules.h"
 #include "Deskillz.h"
+#include "Core/DeskillzStats.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
 #include "Serialization/JsonSerializer.h"
@@ -11,6 +13,9 @@
 #include "HttpModule.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
 
 // Static singleton
 static UDeskillzSecureSubmitter* GSecureSubmitter = nullptr;
@@ -27,6 +32,10 @@ UDeskillzSecureSubmitter* UDeskillzSecureSubmitter::Get(const UObject* WorldCont
 	{
 		GSecureSubmitter = NewObject<UDeskillzSecureSubmitter>();
 		GSecureSubmitter->AddToRoot(); // Prevent garbage collection
+		
+		// Resend queued scores as soon as the network is back
+		UDeskillzNetworkManager::Get()->OnNetworkStateChanged.AddUniqueDynamic(
+			GSecureSubmitter, &UDeskillzSecureSubmitter::HandleNetworkStateChanged);
 	}
 	
 	// Ensure SDK reference is set
@@ -46,11 +55,15 @@ void UDeskillzSecureSubmitter::Initialize(UDeskillzSDK* InSDK)
 	bIsSubmitting = false;
 	CurrentStatus = EDeskillzSubmissionStatus::Pending;
 	CurrentRetryAttempt = 0;
-	SubmissionQueue.Empty();
+	
+	// Restore scores left over from a previous session
+	LoadQueue();
 }
 
 void UDeskillzSecureSubmitter::SubmitScore(int64 Score, bool bForceSubmit)
 {
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzSubmitScore, DeskillzSecurityChannel);
+	
 	// Validate score first
 	FString ValidationError;
 	if (!ValidateScore(Score, ValidationError))
@@ -71,20 +84,51 @@ void UDeskillzSecureSubmitter::SubmitScore(int64 Score, bool bForceSubmit)
 	{
 		UE_LOG(LogDeskillz, Warning, TEXT("Submission already in progress, queueing score: %lld"), Score);
 		
+		// The recorded replay belongs to this score whichever way it goes;
+		// never leave it pending for the next, unrelated submission
+		FString Replay = MoveTemp(PendingReplay);
+		FString ReplayHash = MoveTemp(PendingReplayHash);
+		PendingReplay.Reset();
+		PendingReplayHash.Reset();
+		
 		// Queue for later
 		if (bEnableOfflineQueue)
 		{
 			FDeskillzQueuedSubmission QueuedEntry;
+			QueuedEntry.Id = FGuid::NewGuid();
 			QueuedEntry.OriginalScore = Score;
 			QueuedEntry.QueuedAt = UDeskillzScoreEncryption::GetTimestampMs();
 			QueuedEntry.Status = EDeskillzSubmissionStatus::Pending;
 			
-			if (Encryption->IsInitialized())
+			// Capture the match now; the entry may be retried after it has ended
+			if (SDK)
 			{
-				QueuedEntry.EncryptedScore = Encryption->EncryptScoreSimple(Score);
+				QueuedEntry.MatchId = SDK->GetCurrentMatch().MatchId;
+			}
+			if (QueuedEntry.MatchId.IsEmpty())
+			{
+				UE_LOG(LogDeskillz, Warning, TEXT("No current match, not queueing score: %lld"), Score);
+				return;
 			}
 			
-			QueueSubmission(QueuedEntry);
+			if (Encryption->IsInitialized())
+			{
+				TWeakObjectPtr<UDeskillzSecureSubmitter> WeakThis(this);
+				Encryption->EncryptScoreSimpleAsync(Score,
+					FOnScoreEncrypted::CreateLambda([WeakThis, QueuedEntry, Replay = MoveTemp(Replay)](const FDeskillzEncryptedScore& EncryptedScore) mutable
+				{
+					if (WeakThis.IsValid())
+					{
+						QueuedEntry.EncryptedScore = EncryptedScore;
+						QueuedEntry.EncryptedScore.Replay = MoveTemp(Replay);
+						WeakThis->QueueSubmission(QueuedEntry);
+					}
+				}), ReplayHash);
+			}
+			else
+			{
+				QueueSubmission(QueuedEntry);
+			}
 		}
 		return;
 	}
@@ -103,10 +147,13 @@ void UDeskillzSecureSubmitter::SubmitScore(int64 Score, bool bForceSubmit)
 
 void UDeskillzSecureSubmitter::SubmitScoreWithIntegrity(int64 Score, const FDeskillzScoreIntegrity& Integrity)
 {
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzSubmitScore, DeskillzSecurityChannel);
+	
 	UE_LOG(LogDeskillz, Log, TEXT("Submitting score: %lld"), Score);
 	
 	// Create submission entry
 	FDeskillzQueuedSubmission Submission;
+	Submission.Id = FGuid::NewGuid();
 	Submission.OriginalScore = Score;
 	Submission.QueuedAt = UDeskillzScoreEncryption::GetTimestampMs();
 	Submission.Status = EDeskillzSubmissionStatus::Pending;
@@ -133,30 +180,64 @@ void UDeskillzSecureSubmitter::SubmitScoreWithIntegrity(int64 Score, const FDesk
 	FullIntegrity.ScoreUpdateCount = Encryption->GetScoreUpdateCount();
 	FullIntegrity.InputEventCount = Encryption->GetInputEventCount();
 	FullIntegrity.ScoreTrailHash = Encryption->GetScoreTrailHash();
+	FullIntegrity.ReplayHash = MoveTemp(PendingReplayHash);
+	PendingReplayHash.Reset();
 	
-	Submission.EncryptedScore = Encryption->EncryptScore(Score, FullIntegrity);
-	
-	// Check encryption success
-	if (!Submission.EncryptedScore.IsValid())
-	{
-		UE_LOG(LogDeskillz, Error, TEXT("Failed to encrypt score"));
-		
-		FDeskillzSubmissionResult FailResult;
-		FailResult.Status = EDeskillzSubmissionStatus::Failed;
-		FailResult.ErrorMessage = TEXT("Encryption failed");
-		FailResult.ErrorCode = -2;
-		
-		OnSubmissionComplete.Broadcast(FailResult, Score);
-		return;
-	}
-	
-	// Start submission
+	// Mark submitting now so scores arriving while the payload is encrypted get queued
 	bIsSubmitting = true;
 	CurrentStatus = EDeskillzSubmissionStatus::Submitting;
 	CurrentRetryAttempt = 0;
 	CurrentSubmission = Submission;
 	
-	SendSubmission(Submission);
+	const int32 Serial = ++EncryptionSerial;
+	TWeakObjectPtr<UDeskillzSecureSubmitter> WeakThis(this);
+	
+	Encryption->EncryptScoreAsync(Score, FullIntegrity,
+		FOnScoreEncrypted::CreateLambda([WeakThis, Serial, Submission, Score, Replay = MoveTemp(PendingReplay)](const FDeskillzEncryptedScore& EncryptedScore) mutable
+	{
+		UDeskillzSecureSubmitter* This = WeakThis.Get();
+		if (!This || This->EncryptionSerial != Serial)
+		{
+			// Submitter gone or submission cancelled while encrypting
+			return;
+		}
+		
+		Submission.EncryptedScore = EncryptedScore;
+		Submission.EncryptedScore.Replay = MoveTemp(Replay);
+		
+		// Check encryption success
+		if (!Submission.EncryptedScore.IsValid())
+		{
+			UE_LOG(LogDeskillz, Error, TEXT("Failed to encrypt score"));
+			
+			This->bIsSubmitting = false;
+			This->CurrentStatus = EDeskillzSubmissionStatus::Failed;
+			
+			FDeskillzSubmissionResult FailResult;
+			FailResult.Status = EDeskillzSubmissionStatus::Failed;
+			FailResult.ErrorMessage = TEXT("Encryption failed");
+			FailResult.ErrorCode = -2;
+			
+			This->OnSubmissionComplete.Broadcast(FailResult, Score);
+			return;
+		}
+		
+		// Store before sending so the score survives an app kill mid-request
+		if (This->bEnableOfflineQueue)
+		{
+			This->QueueSubmission(Submission);
+		}
+		
+		// Start submission
+		This->CurrentSubmission = Submission;
+		This->SendSubmission(Submission);
+	}));
+}
+
+void UDeskillzSecureSubmitter::AttachReplay(const TArray<uint8>& ReplayData)
+{
+	PendingReplay = UDeskillzScoreEncryption::ToBase64(ReplayData);
+	PendingReplayHash = UDeskillzScoreEncryption::HashBytesSHA256(ReplayData);
 }
 
 void UDeskillzSecureSubmitter::CancelSubmission()
@@ -175,6 +256,16 @@ void UDeskillzSecureSubmitter::CancelSubmission()
 		SDK->GetWorld()->GetTimerManager().ClearTimer(TimeoutTimerHandle);
 	}
 	
+	// Drop any encrypt still in flight
+	++EncryptionSerial;
+	
+	const int32 QueueIndex = FindQueuedSubmission(CurrentSubmission.Id);
+	if (QueueIndex != INDEX_NONE)
+	{
+		SubmissionQueue.RemoveAt(QueueIndex);
+		SaveQueue();
+	}
+	
 	bIsSubmitting = false;
 	CurrentStatus = EDeskillzSubmissionStatus::Pending;
 }
@@ -195,32 +286,24 @@ void UDeskillzSecureSubmitter::ClearQueue()
 {
 	UE_LOG(LogDeskillz, Log, TEXT("Clearing %d queued submissions"), SubmissionQueue.Num());
 	SubmissionQueue.Empty();
+	SaveQueue();
 }
 
 bool UDeskillzSecureSubmitter::ValidateScore(int64 Score, FString& OutError) const
 {
-	const UDeskillzConfig* Config = UDeskillzConfig::Get();
+	const FDeskillzScoreValidator& Validator = FDeskillzScoreValidator::GetActive();
+	const FDeskillzScoreRules& Rules = Validator.GetRules();
+	const EDeskillzScoreRule Broken = Validator.CheckRange(Score);
 	
-	// Check score range
-	if (Config)
+	if (EnumHasAnyFlags(Broken, EDeskillzScoreRule::BelowMinimum))
 	{
-		if (Score < Config->MinScore)
-		{
-			OutError = FString::Printf(TEXT("Score %lld is below minimum %lld"), Score, Config->MinScore);
-			return false;
-		}
-		
-		if (Score > Config->MaxScore)
-		{
-			OutError = FString::Printf(TEXT("Score %lld exceeds maximum %lld"), Score, Config->MaxScore);
-			return false;
-		}
+		OutError = FString::Printf(TEXT("Score %lld is below minimum %lld"), Score, Rules.MinScore);
+		return false;
 	}
 	
-	// Check for negative scores (if not allowed)
-	if (Score < 0)
+	if (EnumHasAnyFlags(Broken, EDeskillzScoreRule::AboveMaximum))
 	{
-		OutError = TEXT("Negative scores are not allowed");
+		OutError = FString::Printf(TEXT("Score %lld exceeds maximum %lld"), Score, Rules.MaxScore);
 		return false;
 	}
 	
@@ -229,170 +312,398 @@ bool UDeskillzSecureSubmitter::ValidateScore(int64 Score, FString& OutError) con
 
 bool UDeskillzSecureSubmitter::IsScoreInRange(int64 Score) const
 {
-	const UDeskillzConfig* Config = UDeskillzConfig::Get();
+	return FDeskillzScoreValidator::GetActive().CheckRange(Score) == EDeskillzScoreRule::None;
+}
+
+bool UDeskillzSecureSubmitter::IsScoreProgressionValid(int64 PreviousScore, int64 NewScore, float ElapsedTimeSeconds) const
+{
+	const EDeskillzScoreRule Broken = FDeskillzScoreValidator::GetActive().CheckUpdate(PreviousScore, NewScore, ElapsedTimeSeconds);
 	
-	if (!Config)
+	if (Broken != EDeskillzScoreRule::None)
 	{
-		return true; // No config, allow all
+		UE_LOG(LogDeskillz, Warning, TEXT("Suspicious score progression %lld -> %lld in %.2fs (%s)"),
+			PreviousScore, NewScore, ElapsedTimeSeconds, *FDeskillzScoreValidator::Describe(Broken));
+		return false;
 	}
 	
-	return Score >= Config->MinScore && Score <= Config->MaxScore;
+	return true;
 }
 
-bool UDeskillzSecureSubmitter::IsScoreProgressionValid(int64 PreviousScore, int64 NewScore, float ElapsedTimeSeconds) const
+// ============================================================================
+// Internal Methods
+// ============================================================================
+
+void UDeskillzSecureSubmitter::ProcessQueue()
 {
-	// Basic validation rules:
-	// 1. Score shouldn't decrease (in most games)
-	// 2. Score increase rate shouldn't be impossibly fast
+	if (bIsSubmitting || InFlightQueued.Num() > 0 || SubmissionQueue.Num() == 0)
+	{
+		return;
+	}
 	
-	int64 ScoreDelta = NewScore - PreviousScore;
+	// Entries are never dropped for age: a persisted score may be sent days later
+	// and the server decides whether it still counts. Only entries that can't be
+	// sent at all are removed, and the player is told.
+	const int64 Now = UDeskillzScoreEncryption::GetTimestampMs();
+	TArray<int64> UnsendableScores;
 	
-	// Allow small decreases (some games have penalties)
-	if (ScoreDelta < -1000)
+	SubmissionQueue.RemoveAll([&UnsendableScores](const FDeskillzQueuedSubmission& Entry)
 	{
-		UE_LOG(LogDeskillz, Warning, TEXT("Suspicious score decrease: %lld -> %lld"), PreviousScore, NewScore);
+		if (!Entry.EncryptedScore.IsValid())
+		{
+			UE_LOG(LogDeskillz, Warning, TEXT("Queued submission was never encrypted, removing"));
+			UnsendableScores.Add(Entry.OriginalScore);
+			return true;
+		}
+		
 		return false;
-	}
+	});
 	
-	// Check for impossibly fast gains
-	if (ElapsedTimeSeconds > 0)
+	if (UnsendableScores.Num() > 0)
 	{
-		float ScorePerSecond = (float)ScoreDelta / ElapsedTimeSeconds;
+		SaveQueue();
 		
-		// Threshold depends on game (this is just a baseline)
-		if (ScorePerSecond > 10000)
+		for (int64 Score : UnsendableScores)
 		{
-			UE_LOG(LogDeskillz, Warning, TEXT("Suspicious score rate: %.2f points/sec"), ScorePerSecond);
-			return false;
+			FDeskillzSubmissionResult FailResult;
+			FailResult.Status = EDeskillzSubmissionStatus::Failed;
+			FailResult.ErrorMessage = TEXT("Encryption failed");
+			FailResult.ErrorCode = -2;
+			
+			OnSubmissionComplete.Broadcast(FailResult, Score);
 		}
 	}
 	
-	return true;
+	// Every entry gets one attempt per drain
+	DrainStartedAt = Now;
+	bDrainHadFailures = false;
+	
+	ContinueDrain();
 }
 
-// ============================================================================
-// Internal Methods
-// ============================================================================
-
-void UDeskillzSecureSubmitter::ProcessQueue()
+void UDeskillzSecureSubmitter::ContinueDrain()
 {
-	if (bIsSubmitting || SubmissionQueue.Num() == 0)
+	TArray<FGuid> Candidates;
+	for (const FDeskillzQueuedSubmission& Entry : SubmissionQueue)
 	{
-		return;
+		if (IsDrainCandidate(Entry))
+		{
+			Candidates.Add(Entry.Id);
+		}
 	}
 	
-	// Get next submission
-	FDeskillzQueuedSubmission& NextSubmission = SubmissionQueue[0];
-	
-	// Check if too old (submissions expire after 1 hour)
-	int64 Age = UDeskillzScoreEncryption::GetTimestampMs() - NextSubmission.QueuedAt;
-	if (Age > 3600000) // 1 hour in ms
+	if (Candidates.Num() == 0)
 	{
-		UE_LOG(LogDeskillz, Warning, TEXT("Queued submission expired, removing"));
-		SubmissionQueue.RemoveAt(0);
-		ProcessQueue(); // Try next
+		// Drain finished with scores still unsent: try again later even if the
+		// network state never changes (e.g. server errors while online)
+		if (InFlightQueued.Num() == 0 && bDrainHadFailures && SDK && SDK->GetWorld())
+		{
+			SDK->GetWorld()->GetTimerManager().SetTimer(
+				DrainRetryTimerHandle,
+				this,
+				&UDeskillzSecureSubmitter::ProcessQueue,
+				RetryMaxDelay,
+				false
+			);
+		}
 		return;
 	}
 	
-	// Submit
-	bIsSubmitting = true;
-	CurrentStatus = EDeskillzSubmissionStatus::Submitting;
-	CurrentRetryAttempt = NextSubmission.Attempts;
-	CurrentSubmission = NextSubmission;
+	// One request for everything pending
+	// (the envelope is HMAC-signed, so this needs the signing key)
+	if (bEnableBatchSubmission && !bBatchUnsupported && Candidates.Num() > 1 && Encryption->HasSigningKey())
+	{
+		if (InFlightQueued.Num() == 0)
+		{
+			Candidates.SetNum(FMath::Min(Candidates.Num(), FMath::Max(MaxBatchSize, 2)));
+			SendBatch(Candidates);
+		}
+		return;
+	}
 	
-	SendSubmission(NextSubmission);
+	// Fallback: individual requests, a few at a time
+	const int32 MaxInFlight = FMath::Max(MaxParallelSubmissions, 1);
+	for (const FGuid& Id : Candidates)
+	{
+		if (InFlightQueued.Num() >= MaxInFlight)
+		{
+			break;
+		}
+		SendQueuedSubmission(Id);
+	}
 }
 
-void UDeskillzSecureSubmitter::SendSubmission(const FDeskillzQueuedSubmission& Submission)
+bool UDeskillzSecureSubmitter::IsDrainCandidate(const FDeskillzQueuedSubmission& Entry) const
 {
-	CurrentSubmission.Attempts++;
-	CurrentSubmission.LastAttemptAt = UDeskillzScoreEncryption::GetTimestampMs();
+	return Entry.EncryptedScore.IsValid()
+		&& Entry.LastAttemptAt < DrainStartedAt
+		&& !InFlightQueued.Contains(Entry.Id)
+		&& !(bIsSubmitting && Entry.Id == CurrentSubmission.Id);
+}
+
+void UDeskillzSecureSubmitter::SendBatch(const TArray<FGuid>& Ids)
+{
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzSubmitScore, DeskillzSecurityChannel);
 	
-	UE_LOG(LogDeskillz, Log, TEXT("Sending score submission (attempt %d/%d)"), 
-		CurrentSubmission.Attempts, MaxRetryAttempts);
+	const int64 Now = UDeskillzScoreEncryption::GetTimestampMs();
+	const FString Nonce = UDeskillzScoreEncryption::GenerateNonce();
 	
-	// Broadcast progress
-	OnSubmissionProgress.Broadcast(Submission.OriginalScore, CurrentSubmission.Attempts, MaxRetryAttempts);
+	// Each item keeps its own per-match signature; the envelope digest is an
+	// HMAC binding the item signatures to this request's nonce and timestamp
+	FString DigestPayload = FString::Printf(TEXT("%s|%lld"), *Nonce, Now);
 	
-	// Build API request
-	const UDeskillzConfig* Config = UDeskillzConfig::Get();
-	FDeskillzEndpoints Endpoints = FDeskillzEndpoints::ForEnvironment(
-		Config ? Config->Environment : EDeskillzEnvironment::Sandbox);
+	TArray<TSharedPtr<FJsonValue>> ItemsArray;
+	for (const FGuid& Id : Ids)
+	{
+		const int32 Index = FindQueuedSubmission(Id);
+		if (Index == INDEX_NONE)
+		{
+			continue;
+		}
+		
+		FDeskillzQueuedSubmission& Entry = SubmissionQueue[Index];
+		Entry.Attempts++;
+		Entry.LastAttemptAt = Now;
+		InFlightQueued.Add(Id);
+		
+		OnSubmissionProgress.Broadcast(Entry.OriginalScore, Entry.Attempts, MaxRetryAttempts);
+		
+		TSharedPtr<FJsonObject> ItemJson = MakeShared<FJsonObject>();
+		ItemJson->SetStringField(TEXT("id"), Id.ToString());
+		ItemJson->SetStringField(TEXT("matchId"), Entry.MatchId);
+		ItemJson->SetObjectField(TEXT("score"), Entry.EncryptedScore.ToJsonObject());
+		ItemsArray.Add(MakeShared<FJsonValueObject>(ItemJson));
+		
+		DigestPayload += TEXT("|");
+		DigestPayload += Entry.EncryptedScore.Signature;
+	}
 	
-	FString URL = Endpoints.BaseUrl + TEXT("/api/v1/matches/") + Submission.MatchId + TEXT("/score");
+	TSharedPtr<FJsonObject> EnvelopeJson = MakeShared<FJsonObject>();
+	EnvelopeJson->SetArrayField(TEXT("submissions"), ItemsArray);
+	EnvelopeJson->SetStringField(TEXT("nonce"), Nonce);
+	EnvelopeJson->SetNumberField(TEXT("timestamp"), Now);
+	EnvelopeJson->SetStringField(TEXT("digest"), Encryption->SignPayload(DigestPayload));
 	
-	// Create HTTP request
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(URL);
-	Request->SetVerb(TEXT("POST"));
-	Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+	FString Body;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Body);
+	FJsonSerializer::Serialize(EnvelopeJson.ToSharedRef(), Writer);
 	
-	// Add auth headers
-	if (SDK && !SDK->GetAuthToken().IsEmpty())
+	UE_LOG(LogDeskillz, Log, TEXT("Sending %d queued score submissions in one batch"), Ids.Num());
+	
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateScoreRequest(TEXT("/api/v1/scores/batch"));
+	Request->SetContentAsString(Body);
+	Request->SetTimeout(SubmissionTimeout);
+	
+	TWeakObjectPtr<UDeskillzSecureSubmitter> WeakThis(this);
+	Request->OnProcessRequestComplete().BindLambda([WeakThis, Ids](FHttpRequestPtr HttpRequest, FHttpResponsePtr Response, bool bSuccess)
 	{
-		Request->SetHeader(TEXT("Authorization"), TEXT("Bearer ") + SDK->GetAuthToken());
+		if (UDeskillzSecureSubmitter* This = WeakThis.Get())
+		{
+			const bool bHasResponse = bSuccess && Response.IsValid();
+			This->HandleBatchResponse(Ids, bHasResponse ? Response->GetResponseCode() : -1,
+				bHasResponse ? Response->GetContentAsString() : FString());
+		}
+	});
+	
+	Request->ProcessRequest();
+}
+
+void UDeskillzSecureSubmitter::HandleBatchResponse(const TArray<FGuid>& Ids, int32 HttpStatus, const FString& Response)
+{
+	for (const FGuid& Id : Ids)
+	{
+		InFlightQueued.Remove(Id);
 	}
 	
-	if (Config && !Config->APIKey.IsEmpty())
+	// Server without the batch endpoint: resend these individually
+	if (HttpStatus == 404 || HttpStatus == 405 || HttpStatus == 501)
 	{
-		Request->SetHeader(TEXT("X-API-Key"), Config->APIKey);
+		UE_LOG(LogDeskillz, Log, TEXT("Batch score endpoint unavailable (HTTP %d), using parallel submission"), HttpStatus);
+		bBatchUnsupported = true;
+		
+		for (const FGuid& Id : Ids)
+		{
+			const int32 Index = FindQueuedSubmission(Id);
+			if (Index != INDEX_NONE)
+			{
+				SubmissionQueue[Index].Attempts--;
+				SubmissionQueue[Index].LastAttemptAt = 0;
+			}
+		}
+		
+		ContinueDrain();
+		return;
 	}
 	
-	// Set body
-	Request->SetContentAsString(Submission.EncryptedScore.ToJson());
+	TSharedPtr<FJsonObject> JsonObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response);
+	const TArray<TSharedPtr<FJsonValue>>* ResultsArray = nullptr;
 	
-	// Set up response handler
-	Request->OnProcessRequestComplete().BindLambda([this](FHttpRequestPtr HttpRequest, FHttpResponsePtr Response, bool bSuccess)
+	TSet<FGuid> Answered;
+	if ((HttpStatus == 200 || HttpStatus == 207)
+		&& FJsonSerializer::Deserialize(Reader, JsonObject) && JsonObject.IsValid()
+		&& JsonObject->TryGetArrayField(TEXT("results"), ResultsArray))
 	{
-		if (!bSuccess || !Response.IsValid())
+		// Per-item results
+		for (const TSharedPtr<FJsonValue>& Value : *ResultsArray)
+		{
+			const TSharedPtr<FJsonObject> ItemJson = Value->AsObject();
+			FGuid Id;
+			int32 ItemStatus = 0;
+			
+			if (ItemJson.IsValid()
+				&& FGuid::Parse(ItemJson->GetStringField(TEXT("id")), Id)
+				&& Ids.Contains(Id) && !Answered.Contains(Id)
+				&& ItemJson->TryGetNumberField(TEXT("status"), ItemStatus))
+			{
+				Answered.Add(Id);
+				FinishQueuedSubmission(Id, ItemStatus, ItemJson);
+			}
+		}
+	}
+	
+	// Anything the server didn't answer (or a failed request) stays queued
+	for (const FGuid& Id : Ids)
+	{
+		if (Answered.Contains(Id))
+		{
+			continue;
+		}
+		
+		const int32 Index = FindQueuedSubmission(Id);
+		if (Index != INDEX_NONE)
+		{
+			FDeskillzSubmissionResult Result;
+			Result.Status = EDeskillzSubmissionStatus::Failed;
+			Result.ErrorCode = HttpStatus;
+			Result.ErrorMessage = FString::Printf(TEXT("Batch submission failed: HTTP %d"), HttpStatus);
+			CompleteQueuedSubmission(Index, Result);
+		}
+	}
+	
+	SaveQueue();
+	ContinueDrain();
+}
+
+void UDeskillzSecureSubmitter::SendQueuedSubmission(const FGuid& Id)
+{
+	const int32 Index = FindQueuedSubmission(Id);
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+	
+	FDeskillzQueuedSubmission& Entry = SubmissionQueue[Index];
+	Entry.Attempts++;
+	Entry.LastAttemptAt = UDeskillzScoreEncryption::GetTimestampMs();
+	InFlightQueued.Add(Id);
+	
+	UE_LOG(LogDeskillz, Log, TEXT("Sending queued score submission (%d in flight)"), InFlightQueued.Num());
+	
+	OnSubmissionProgress.Broadcast(Entry.OriginalScore, Entry.Attempts, MaxRetryAttempts);
+	
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateScoreRequest(TEXT("/api/v1/matches/") + Entry.MatchId + TEXT("/score"));
+	Request->SetContentAsString(Entry.EncryptedScore.ToJson());
+	Request->SetTimeout(SubmissionTimeout);
+	
+	TWeakObjectPtr<UDeskillzSecureSubmitter> WeakThis(this);
+	Request->OnProcessRequestComplete().BindLambda([WeakThis, Id](FHttpRequestPtr HttpRequest, FHttpResponsePtr Response, bool bSuccess)
+	{
+		UDeskillzSecureSubmitter* This = WeakThis.Get();
+		if (!This)
 		{
-			HandleSubmissionResponse(-1, TEXT(""));
 			return;
 		}
 		
-		HandleSubmissionResponse(Response->GetResponseCode(), Response->GetContentAsString());
+		This->InFlightQueued.Remove(Id);
+		
+		TSharedPtr<FJsonObject> JsonObject;
+		int32 HttpStatus = -1;
+		if (bSuccess && Response.IsValid())
+		{
+			HttpStatus = Response->GetResponseCode();
+			TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
+			FJsonSerializer::Deserialize(Reader, JsonObject);
+		}
+		
+		This->FinishQueuedSubmission(Id, HttpStatus, JsonObject);
+		This->SaveQueue();
+		This->ContinueDrain();
 	});
 	
-	// Start timeout timer
-	if (SDK && SDK->GetWorld())
+	Request->ProcessRequest();
+}
+
+void UDeskillzSecureSubmitter::FinishQueuedSubmission(const FGuid& Id, int32 HttpStatus, const TSharedPtr<FJsonObject>& JsonObject)
+{
+	const int32 Index = FindQueuedSubmission(Id);
+	if (Index == INDEX_NONE)
 	{
-		SDK->GetWorld()->GetTimerManager().SetTimer(
-			TimeoutTimerHandle,
-			this,
-			&UDeskillzSecureSubmitter::HandleSubmissionTimeout,
-			SubmissionTimeout,
-			false
-		);
+		// Cleared while in flight
+		return;
 	}
 	
-	// Send request
-	Request->ProcessRequest();
+	CompleteQueuedSubmission(Index, ParseSubmissionResult(HttpStatus, JsonObject, SubmissionQueue[Index].OriginalScore));
 }
 
-void UDeskillzSecureSubmitter::HandleSubmissionResponse(int32 HttpStatus, const FString& Response)
+void UDeskillzSecureSubmitter::CompleteQueuedSubmission(int32 Index, FDeskillzSubmissionResult Result)
 {
-	// Clear timeout timer
-	if (SDK && SDK->GetWorld())
+	FDeskillzQueuedSubmission& Entry = SubmissionQueue[Index];
+	const int64 OriginalScore = Entry.OriginalScore;
+	Result.RetryCount = Entry.Attempts;
+	
+	// Network failures stay queued; the server's answer is final
+	if (Result.Status == EDeskillzSubmissionStatus::Failed || Result.Status == EDeskillzSubmissionStatus::TimedOut)
 	{
-		SDK->GetWorld()->GetTimerManager().ClearTimer(TimeoutTimerHandle);
+		Entry.Status = Result.Status;
+		bDrainHadFailures = true;
+	}
+	else
+	{
+		SubmissionQueue.RemoveAt(Index);
+	}
+	
+	LastResult = Result;
+	OnSubmissionComplete.Broadcast(Result, OriginalScore);
+}
+
+TSharedRef<IHttpRequest, ESPMode::ThreadSafe> UDeskillzSecureSubmitter::CreateScoreRequest(const FString& Path) const
+{
+	const UDeskillzConfig* Config = UDeskillzConfig::Get();
+	FDeskillzEndpoints Endpoints = FDeskillzEndpoints::ForEnvironment(
+		Config ? Config->Environment : EDeskillzEnvironment::Sandbox);
+	
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
+	Request->SetURL(Endpoints.BaseUrl + Path);
+	Request->SetVerb(TEXT("POST"));
+	Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+	
+	// Add auth headers
+	if (SDK && !SDK->GetAuthToken().IsEmpty())
+	{
+		Request->SetHeader(TEXT("Authorization"), TEXT("Bearer ") + SDK->GetAuthToken());
 	}
 	
+	if (Config && !Config->APIKey.IsEmpty())
+	{
+		Request->SetHeader(TEXT("X-API-Key"), Config->APIKey);
+	}
+	
+	return Request;
+}
+
+FDeskillzSubmissionResult UDeskillzSecureSubmitter::ParseSubmissionResult(int32 HttpStatus, const TSharedPtr<FJsonObject>& JsonObject, int64 OriginalScore)
+{
 	FDeskillzSubmissionResult Result;
-	Result.RetryCount = CurrentSubmission.Attempts;
 	
-	// Parse response
 	if (HttpStatus == 200 || HttpStatus == 201)
 	{
 		// Success!
 		Result.Status = EDeskillzSubmissionStatus::Verified;
-		Result.VerifiedScore = CurrentSubmission.OriginalScore;
+		Result.VerifiedScore = OriginalScore;
 		Result.bIntegrityVerified = true;
 		
 		// Parse server response
-		TSharedPtr<FJsonObject> JsonObject;
-		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response);
-		
-		if (FJsonSerializer::Deserialize(Reader, JsonObject) && JsonObject.IsValid())
+		if (JsonObject.IsValid())
 		{
 			JsonObject->TryGetStringField(TEXT("submissionId"), Result.SubmissionId);
 			JsonObject->TryGetNumberField(TEXT("verifiedScore"), Result.VerifiedScore);
@@ -407,8 +718,6 @@ void UDeskillzSecureSubmitter::HandleSubmissionResponse(int32 HttpStatus, const
 		
 		UE_LOG(LogDeskillz, Log, TEXT("Score submission verified: %lld (ID: %s)"), 
 			Result.VerifiedScore, *Result.SubmissionId);
-		
-		CompleteSubmission(Result);
 	}
 	else if (HttpStatus == 422 || HttpStatus == 400)
 	{
@@ -417,10 +726,7 @@ void UDeskillzSecureSubmitter::HandleSubmissionResponse(int32 HttpStatus, const
 		Result.ErrorCode = HttpStatus;
 		
 		// Parse error message
-		TSharedPtr<FJsonObject> JsonObject;
-		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response);
-		
-		if (FJsonSerializer::Deserialize(Reader, JsonObject) && JsonObject.IsValid())
+		if (JsonObject.IsValid())
 		{
 			JsonObject->TryGetStringField(TEXT("error"), Result.ErrorMessage);
 			JsonObject->TryGetStringField(TEXT("message"), Result.ErrorMessage);
@@ -432,8 +738,6 @@ void UDeskillzSecureSubmitter::HandleSubmissionResponse(int32 HttpStatus, const
 		}
 		
 		UE_LOG(LogDeskillz, Warning, TEXT("Score submission rejected: %s"), *Result.ErrorMessage);
-		
-		CompleteSubmission(Result);
 	}
 	else if (HttpStatus == 409)
 	{
@@ -443,8 +747,6 @@ void UDeskillzSecureSubmitter::HandleSubmissionResponse(int32 HttpStatus, const
 		Result.ErrorCode = HttpStatus;
 		
 		UE_LOG(LogDeskillz, Warning, TEXT("Score flagged for anti-cheat review"));
-		
-		CompleteSubmission(Result);
 	}
 	else
 	{
@@ -452,21 +754,90 @@ void UDeskillzSecureSubmitter::HandleSubmissionResponse(int32 HttpStatus, const
 		Result.Status = EDeskillzSubmissionStatus::Failed;
 		Result.ErrorCode = HttpStatus;
 		Result.ErrorMessage = FString::Printf(TEXT("HTTP %d"), HttpStatus);
-		
-		UE_LOG(LogDeskillz, Warning, TEXT("Score submission failed: HTTP %d (attempt %d/%d)"), 
-			HttpStatus, CurrentSubmission.Attempts, MaxRetryAttempts);
-		
-		// Check if we should retry
-		if (CurrentSubmission.Attempts < MaxRetryAttempts)
-		{
-			ScheduleRetry();
-		}
-		else
+	}
+	
+	return Result;
+}
+
+void UDeskillzSecureSubmitter::SendSubmission(const FDeskillzQueuedSubmission& Submission)
+{
+	CurrentSubmission.Attempts++;
+	CurrentSubmission.LastAttemptAt = UDeskillzScoreEncryption::GetTimestampMs();
+	
+	UE_LOG(LogDeskillz, Log, TEXT("Sending score submission (attempt %d/%d)"), 
+		CurrentSubmission.Attempts, MaxRetryAttempts);
+	
+	// Broadcast progress
+	OnSubmissionProgress.Broadcast(Submission.OriginalScore, CurrentSubmission.Attempts, MaxRetryAttempts);
+	
+	// Create HTTP request
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = CreateScoreRequest(TEXT("/api/v1/matches/") + Submission.MatchId + TEXT("/score"));
+	
+	// Set body
+	Request->SetContentAsString(Submission.EncryptedScore.ToJson());
+	
+	// Set up response handler
+	Request->OnProcessRequestComplete().BindLambda([this](FHttpRequestPtr HttpRequest, FHttpResponsePtr Response, bool bSuccess)
+	{
+		if (!bSuccess || !Response.IsValid())
 		{
-			// Max retries exceeded
-			Result.ErrorMessage = TEXT("Max retry attempts exceeded");
-			CompleteSubmission(Result);
+			HandleSubmissionResponse(-1, TEXT(""));
+			return;
 		}
+		
+		HandleSubmissionResponse(Response->GetResponseCode(), Response->GetContentAsString());
+	});
+	
+	// Start timeout timer
+	if (SDK && SDK->GetWorld())
+	{
+		SDK->GetWorld()->GetTimerManager().SetTimer(
+			TimeoutTimerHandle,
+			this,
+			&UDeskillzSecureSubmitter::HandleSubmissionTimeout,
+			SubmissionTimeout,
+			false
+		);
+	}
+	
+	// Send request
+	Request->ProcessRequest();
+}
+
+void UDeskillzSecureSubmitter::HandleSubmissionResponse(int32 HttpStatus, const FString& Response)
+{
+	// Clear timeout timer
+	if (SDK && SDK->GetWorld())
+	{
+		SDK->GetWorld()->GetTimerManager().ClearTimer(TimeoutTimerHandle);
+	}
+	
+	TSharedPtr<FJsonObject> JsonObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response);
+	FJsonSerializer::Deserialize(Reader, JsonObject);
+	
+	FDeskillzSubmissionResult Result = ParseSubmissionResult(HttpStatus, JsonObject, CurrentSubmission.OriginalScore);
+	Result.RetryCount = CurrentSubmission.Attempts;
+	
+	if (Result.Status != EDeskillzSubmissionStatus::Failed)
+	{
+		CompleteSubmission(Result);
+		return;
+	}
+	
+	UE_LOG(LogDeskillz, Warning, TEXT("Score submission failed: HTTP %d (attempt %d/%d)"), 
+		HttpStatus, CurrentSubmission.Attempts, MaxRetryAttempts);
+	
+	// Check if we should retry
+	if (CurrentSubmission.Attempts < MaxRetryAttempts)
+	{
+		ScheduleRetry();
+	}
+	else
+	{
+		// Max retries exceeded
+		Result.ErrorMessage = TEXT("Max retry attempts exceeded");
+		CompleteSubmission(Result);
 	}
 }
 
@@ -525,32 +896,215 @@ void UDeskillzSecureSubmitter::CompleteSubmission(const FDeskillzSubmissionResul
 	bIsSubmitting = false;
 	CurrentStatus = Result.Status;
 	
-	// Remove from queue if it was queued
-	if (SubmissionQueue.Num() > 0 && SubmissionQueue[0].OriginalScore == CurrentSubmission.OriginalScore)
+	// Network failures stay queued for the next time we come online; the
+	// server's answer (verified, rejected, flagged) is final
+	const bool bRetryLater = bEnableOfflineQueue
+		&& CurrentSubmission.EncryptedScore.IsValid()
+		&& (Result.Status == EDeskillzSubmissionStatus::Failed || Result.Status == EDeskillzSubmissionStatus::TimedOut);
+	
+	const int32 QueueIndex = FindQueuedSubmission(CurrentSubmission.Id);
+	if (bRetryLater)
 	{
-		SubmissionQueue.RemoveAt(0);
+		FDeskillzQueuedSubmission Parked = CurrentSubmission;
+		Parked.Attempts = 0; // Full retry budget on recovery
+		Parked.Status = Result.Status;
+		
+		if (QueueIndex != INDEX_NONE)
+		{
+			SubmissionQueue[QueueIndex] = Parked;
+			SaveQueue();
+		}
+		else
+		{
+			QueueSubmission(Parked);
+		}
+		
+		UE_LOG(LogDeskillz, Log, TEXT("Score kept in queue until the network recovers"));
+	}
+	else if (QueueIndex != INDEX_NONE)
+	{
+		SubmissionQueue.RemoveAt(QueueIndex);
+		SaveQueue();
 	}
 	
 	// Broadcast completion
 	OnSubmissionComplete.Broadcast(Result, CurrentSubmission.OriginalScore);
 	
-	// Process next in queue
-	if (SubmissionQueue.Num() > 0)
+	// Process next in queue (after a network failure, wait for recovery instead)
+	if (!bRetryLater && SubmissionQueue.Num() > 0)
 	{
 		ProcessQueue();
 	}
 }
 
-void UDeskillzSecureSubmitter::QueueSubmission(const FDeskillzQueuedSubmission& Submission)
+bool UDeskillzSecureSubmitter::QueueSubmission(const FDeskillzQueuedSubmission& Submission)
 {
-	// Check queue limit
+	// Never evict an unsent score to make room; refuse the new one and say so
 	if (SubmissionQueue.Num() >= MaxQueuedSubmissions)
 	{
-		UE_LOG(LogDeskillz, Warning, TEXT("Submission queue full, dropping oldest"));
-		SubmissionQueue.RemoveAt(0);
+		UE_LOG(LogDeskillz, Error, TEXT("Submission queue full (%d), score %lld not stored"), SubmissionQueue.Num(), Submission.OriginalScore);
+		
+		FDeskillzSubmissionResult FailResult;
+		FailResult.Status = EDeskillzSubmissionStatus::Failed;
+		FailResult.ErrorMessage = TEXT("Submission queue full");
+		FailResult.ErrorCode = -4;
+		
+		OnSubmissionComplete.Broadcast(FailResult, Submission.OriginalScore);
+		return false;
 	}
 	
 	SubmissionQueue.Add(Submission);
+	SaveQueue();
+	
+	UE_LOG(LogDeskillz, Log, TEXT("Score queued for submission (queue size: %d)"), SubmissionQueue.Num());
+	return true;
+}
+
+int32 UDeskillzSecureSubmitter::FindQueuedSubmission(const FGuid& Id) const
+{
+	return SubmissionQueue.IndexOfByPredicate([&Id](const FDeskillzQueuedSubmission& Entry)
+	{
+		return Entry.Id == Id;
+	});
+}
+
+// ============================================================================
+// Queue Persistence
+// ============================================================================
+
+FString UDeskillzSecureSubmitter::GetQueueFilePath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("Deskillz") / TEXT("SubmissionQueue.dat");
+}
+
+void UDeskillzSecureSubmitter::SaveQueue() const
+{
+	const FString FilePath = GetQueueFilePath();
+	const FString TempPath = FilePath + TEXT(".tmp");
+	
+	// Only entries with an encrypted payload can be resent
+	TArray<TSharedPtr<FJsonValue>> EntriesArray;
+	for (const FDeskillzQueuedSubmission& Entry : SubmissionQueue)
+	{
+		if (!Entry.EncryptedScore.IsValid())
+		{
+			continue;
+		}
+		
+		TSharedPtr<FJsonObject> EntryJson = MakeShared<FJsonObject>();
+		EntryJson->SetStringField(TEXT("id"), Entry.Id.ToString());
+		EntryJson->SetStringField(TEXT("payload"), Entry.EncryptedScore.ToJson());
+		EntryJson->SetNumberField(TEXT("originalScore"), Entry.OriginalScore);
+		EntryJson->SetStringField(TEXT("matchId"), Entry.MatchId);
+		EntryJson->SetNumberField(TEXT("queuedAt"), Entry.QueuedAt);
+		EntryJson->SetNumberField(TEXT("attempts"), Entry.Attempts);
+		EntriesArray.Add(MakeShared<FJsonValueObject>(EntryJson));
+	}
+	
+	if (EntriesArray.Num() == 0)
+	{
+		IFileManager::Get().Delete(*FilePath, false, false, true);
+		IFileManager::Get().Delete(*TempPath, false, false, true);
+		return;
+	}
+	
+	FString JsonString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
+	FJsonSerializer::Serialize(EntriesArray, Writer);
+	
+	FTCHARToUTF8 JsonUtf8(*JsonString);
+	const TArray<uint8> Plaintext(reinterpret_cast<const uint8*>(JsonUtf8.Get()), JsonUtf8.Length());
+	const TArray<uint8> Sealed = UDeskillzScoreEncryption::SealLocalData(Plaintext);
+	
+	// Queue changes are rare (about once per match), so write synchronously:
+	// the score is on disk before its request goes out. Write-then-rename
+	// means a kill mid-write leaves the previous file intact.
+	if (Sealed.Num() == 0 || !FFileHelper::SaveArrayToFile(Sealed, *TempPath))
+	{
+		UE_LOG(LogDeskillz, Error, TEXT("Failed to write submission queue: %s"), *TempPath);
+		return;
+	}
+	
+	if (!IFileManager::Get().Move(*FilePath, *TempPath, true, true))
+	{
+		UE_LOG(LogDeskillz, Error, TEXT("Failed to replace submission queue: %s"), *FilePath);
+	}
+}
+
+void UDeskillzSecureSubmitter::LoadQueue()
+{
+	const FString FilePath = GetQueueFilePath();
+	const FString TempPath = FilePath + TEXT(".tmp");
 	
-	UE_LOG(LogDeskillz, Log, TEXT("Score queued for later submission (queue size: %d)"), SubmissionQueue.Num());
+	// Fall back to the temp file if a kill landed between write and rename
+	TArray<uint8> Sealed;
+	TArray<uint8> Plaintext;
+	bool bOpened = FFileHelper::LoadFileToArray(Sealed, *FilePath, FILEREAD_Silent)
+		&& UDeskillzScoreEncryption::OpenLocalData(Sealed, Plaintext);
+	
+	if (!bOpened)
+	{
+		bOpened = FFileHelper::LoadFileToArray(Sealed, *TempPath, FILEREAD_Silent)
+			&& UDeskillzScoreEncryption::OpenLocalData(Sealed, Plaintext);
+	}
+	
+	if (!bOpened)
+	{
+		if (IFileManager::Get().FileExists(*FilePath))
+		{
+			UE_LOG(LogDeskillz, Warning, TEXT("Discarding unreadable submission queue: %s"), *FilePath);
+		}
+		return;
+	}
+	
+	FUTF8ToTCHAR JsonTchar(reinterpret_cast<const ANSICHAR*>(Plaintext.GetData()), Plaintext.Num());
+	const FString JsonString(JsonTchar.Length(), JsonTchar.Get());
+	
+	TArray<TSharedPtr<FJsonValue>> EntriesArray;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+	
+	if (!FJsonSerializer::Deserialize(Reader, EntriesArray))
+	{
+		UE_LOG(LogDeskillz, Warning, TEXT("Discarding malformed submission queue: %s"), *FilePath);
+		return;
+	}
+	
+	int32 RestoredCount = 0;
+	for (const TSharedPtr<FJsonValue>& Value : EntriesArray)
+	{
+		const TSharedPtr<FJsonObject> EntryJson = Value->AsObject();
+		if (!EntryJson.IsValid())
+		{
+			continue;
+		}
+		
+		FDeskillzQueuedSubmission Entry;
+		FGuid::Parse(EntryJson->GetStringField(TEXT("id")), Entry.Id);
+		Entry.EncryptedScore = FDeskillzEncryptedScore::FromJson(EntryJson->GetStringField(TEXT("payload")));
+		EntryJson->TryGetNumberField(TEXT("originalScore"), Entry.OriginalScore);
+		EntryJson->TryGetStringField(TEXT("matchId"), Entry.MatchId);
+		EntryJson->TryGetNumberField(TEXT("queuedAt"), Entry.QueuedAt);
+		EntryJson->TryGetNumberField(TEXT("attempts"), Entry.Attempts);
+		Entry.Status = EDeskillzSubmissionStatus::Pending;
+		
+		// Entries without a match ID have nowhere to go
+		if (!Entry.Id.IsValid() || !Entry.EncryptedScore.IsValid() || Entry.MatchId.IsEmpty() || FindQueuedSubmission(Entry.Id) != INDEX_NONE)
+		{
+			continue;
+		}
+		
+		SubmissionQueue.Add(Entry);
+		RestoredCount++;
+	}
+	
+	UE_LOG(LogDeskillz, Log, TEXT("Restored %d queued score submissions"), RestoredCount);
+}
+
+void UDeskillzSecureSubmitter::HandleNetworkStateChanged(EDeskillzNetworkState NewState)
+{
+	// HTTP is enough to submit; the WebSocket may still be reconnecting
+	if (NewState == EDeskillzNetworkState::Online || NewState == EDeskillzNetworkState::PartialOnline)
+	{
+		RetryQueuedSubmissions();
+	}
 }
@@ -2,6 +2,8 @@
 
 #include "Security/DeskillzSecurityModule.h"
 #include "Deskillz.h"
+#include "Core/DeskillzStats.h"
+#include "Core/DeskillzConfig.h"
 
 // Static singleton
 static UDeskillzSecurityModule* GSecurityModule = nullptr;
@@ -10,8 +12,8 @@ UDeskillzSecurityModule::UDeskillzSecurityModule()
 {
 	// Create sub-components
 	Encryption = NewObject<UDeskillzScoreEncryption>(this);
-	Submitter = NewObject<UDeskillzSecureSubmitter>(this);
 	AntiCheat = NewObject<UDeskillzAntiCheat>(this);
+	ReplayRecorder = NewObject<UDeskillzReplayRecorder>(this);
 }
 
 UDeskillzSecurityModule* UDeskillzSecurityModule::Get(const UObject* WorldContextObject)
@@ -21,6 +23,9 @@ UDeskillzSecurityModule* UDeskillzSecurityModule::Get(const UObject* WorldContex
 		GSecurityModule = NewObject<UDeskillzSecurityModule>();
 		GSecurityModule->AddToRoot(); // Prevent garbage collection
 		
+		// Share the submitter singleton so the restored offline queue is the one in use
+		GSecurityModule->Submitter = UDeskillzSecureSubmitter::Get(WorldContextObject);
+		
 		// Bind events
 		if (GSecurityModule->Submitter)
 		{
@@ -37,7 +42,7 @@ UDeskillzSecurityModule* UDeskillzSecurityModule::Get(const UObject* WorldContex
 	return GSecurityModule;
 }
 
-void UDeskillzSecurityModule::InitializeForMatch(const FString& MatchId, const FString& EncryptionKey, const FString& SigningKey)
+void UDeskillzSecurityModule::InitializeForMatch(const FString& MatchId, const FString& EncryptionKey, const FString& SigningKey, int64 RandomSeed)
 {
 	CurrentMatchId = MatchId;
 	LastScoreUpdateTime = FPlatformTime::Seconds();
@@ -54,6 +59,13 @@ void UDeskillzSecurityModule::InitializeForMatch(const FString& MatchId, const F
 		AntiCheat->Initialize(MatchId);
 	}
 	
+	// Start replay recording (opt-in)
+	const UDeskillzConfig* Config = UDeskillzConfig::Get();
+	if (ReplayRecorder && Config && Config->bEnableReplayRecording)
+	{
+		ReplayRecorder->BeginRecording(MatchId, RandomSeed, Config->ReplayMaxKB * 1024);
+	}
+	
 	bIsInitialized = true;
 	
 	UE_LOG(LogDeskillz, Log, TEXT("Security module initialized for match: %s"), *MatchId);
@@ -78,11 +90,13 @@ void UDeskillzSecurityModule::EndMatch()
 		AntiCheat->Reset();
 	}
 	
-	if (Submitter)
+	if (ReplayRecorder)
 	{
-		Submitter->ClearQueue();
+		ReplayRecorder->Reset();
 	}
 	
+	// Queued submissions are kept: they outlive the match until the server answers
+	
 	CurrentMatchId.Empty();
 	bIsInitialized = false;
 	
@@ -107,6 +121,8 @@ FDeskillzSecurityStatus UDeskillzSecurityModule::GetSecurityStatus() const
 
 bool UDeskillzSecurityModule::UpdateScore(int64 Score)
 {
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzUpdateScore, DeskillzSecurityChannel);
+	
 	if (!bIsInitialized)
 	{
 		UE_LOG(LogDeskillz, Warning, TEXT("Security not initialized, cannot update score"));
@@ -130,6 +146,11 @@ bool UDeskillzSecurityModule::UpdateScore(int64 Score)
 		Encryption->RecordScoreUpdate(Score);
 	}
 	
+	if (ReplayRecorder)
+	{
+		ReplayRecorder->RecordScore(Score);
+	}
+	
 	return bValid;
 }
 
@@ -184,6 +205,12 @@ void UDeskillzSecurityModule::SubmitFinalScore(int64 FinalScore)
 	// Submit via secure submitter
 	if (Submitter)
 	{
+		if (ReplayRecorder && ReplayRecorder->IsRecording())
+		{
+			ReplayRecorder->RecordScore(FinalScore);
+			Submitter->AttachReplay(ReplayRecorder->FinishRecording());
+		}
+		
 		Submitter->SubmitScore(FinalScore);
 	}
 }
@@ -201,6 +228,12 @@ void UDeskillzSecurityModule::RecordInput(const FString& InputType, FVector2D Po
 	{
 		AntiCheat->RecordInput(InputType, Position);
 	}
+	
+	// Record in replay
+	if (ReplayRecorder)
+	{
+		ReplayRecorder->RecordInput(InputType, Position);
+	}
 }
 
 bool UDeskillzSecurityModule::RunSecurityChecks()
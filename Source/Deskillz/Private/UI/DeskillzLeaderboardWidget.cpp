@@ -3,6 +3,8 @@
 #include "UI/DeskillzLeaderboardWidget.h"
 #include "Core/DeskillzSDK.h"
 #include "Deskillz.h"
+#include "Core/DeskillzStats.h"
+#include "Analytics/DeskillzTelemetry.h"
 #include "Components/TextBlock.h"
 #include "Components/Button.h"
 #include "Components/ScrollBox.h"
@@ -193,6 +195,9 @@ void UDeskillzLeaderboardWidget::ScrollToCurrentPlayer()
 
 void UDeskillzLeaderboardWidget::PopulateLeaderboard()
 {
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzPopulateLeaderboard, DeskillzUIChannel);
+	DESKILLZ_SCOPED_ACTIVITY(WidgetPopulate);
+	
 	if (!EntriesContainer)
 	{
 		return;
@@ -2,7 +2,10 @@
 
 #include "UI/DeskillzTournamentListWidget.h"
 #include "Core/DeskillzSDK.h"
+#include "Match/DeskillzTournamentStore.h"
 #include "Deskillz.h"
+#include "Core/DeskillzStats.h"
+#include "Analytics/DeskillzTelemetry.h"
 #include "Components/ScrollBox.h"
 #include "Components/VerticalBox.h"
 #include "Components/TextBlock.h"
@@ -130,11 +133,19 @@ void UDeskillzTournamentListWidget::RefreshTournaments()
 		return;
 	}
 	
+	// The tournament manager owns the shared store; show what it has cached
+	const FDeskillzTournamentStore& Store = FDeskillzTournamentStore::Get();
+	if (Store.Num() > 0)
+	{
+		OnTournamentsLoaded(true, Store.ToArray());
+		return;
+	}
+	
 	// Request tournaments from SDK
 	// In full implementation, this would call the actual API
 	// SDK->GetTournaments(FOnTournamentsLoaded::CreateUObject(this, &UDeskillzTournamentListWidget::OnTournamentsLoaded));
 	
-	// For now, simulate with test data
+	// For now, simulate with test data (kept in this widget, never written to the store)
 	TArray<FDeskillzTournament> TestTournaments;
 	
 	// Create sample tournaments
@@ -198,6 +209,9 @@ void UDeskillzTournamentListWidget::SetSort(EDeskillzTournamentSort Sort)
 
 void UDeskillzTournamentListWidget::PopulateTournamentList()
 {
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzPopulateTournaments, DeskillzUIChannel);
+	DESKILLZ_SCOPED_ACTIVITY(WidgetPopulate);
+	
 	if (!TournamentContainer)
 	{
 		return;
@@ -336,11 +350,15 @@ void UDeskillzTournamentListWidget::OnEnterTournament(const FString& TournamentI
 {
 	PlayClickSound();
 	
-	// Find tournament
-	const FDeskillzTournament* Tournament = Tournaments.FindByPredicate([&TournamentId](const FDeskillzTournament& T)
+	// Find tournament (the store, then the locally simulated list)
+	const FDeskillzTournament* Tournament = FDeskillzTournamentStore::Get().Find(TournamentId);
+	if (!Tournament)
 	{
-		return T.Id == TournamentId;
-	});
+		Tournament = Tournaments.FindByPredicate([&TournamentId](const FDeskillzTournament& T)
+		{
+			return T.Id == TournamentId;
+		});
+	}
 	
 	if (!Tournament)
 	{
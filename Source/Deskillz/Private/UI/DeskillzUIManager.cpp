@@ -10,8 +10,10 @@
 #include "UI/DeskillzLeaderboardWidget.h"
 #include "Core/DeskillzTypes.h"
 #include "Deskillz.h"
+#include "Core/DeskillzStats.h"
 #include "Blueprint/UserWidget.h"
 #include "Blueprint/WidgetBlueprintLibrary.h"
+#include "Blueprint/WidgetTree.h"
 #include "Kismet/GameplayStatics.h"
 #include "GameFramework/PlayerController.h"
 #include "Components/Widget.h"
@@ -19,6 +21,37 @@
 // Static singleton
 static UDeskillzUIManager* GUIManager = nullptr;
 
+// Estimated size of a widget and its widget tree
+static int64 GetWidgetTreeBytes(const UUserWidget* Widget)
+{
+	if (!Widget)
+	{
+		return 0;
+	}
+	
+	int64 Bytes = Widget->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+	if (Widget->WidgetTree)
+	{
+		Widget->WidgetTree->ForEachWidget([&Bytes](UWidget* Child)
+		{
+			Bytes += Child->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+		});
+	}
+	return Bytes;
+}
+
+// Drop a cached widget reference if it is not on screen
+template<typename T>
+static bool ReleaseIfHidden(T*& Widget)
+{
+	if (Widget && !Widget->IsInViewport())
+	{
+		Widget = nullptr;
+		return true;
+	}
+	return false;
+}
+
 UDeskillzUIManager::UDeskillzUIManager()
 {
 	// Default theme (gaming/neon style)
@@ -410,6 +443,45 @@ void UDeskillzUIManager::SetUIInputMode(bool bUIOnly)
 	}
 }
 
+// ============================================================================
+// Memory
+// ============================================================================
+
+int64 UDeskillzUIManager::GetWidgetMemoryBytes() const
+{
+	return GetWidgetTreeBytes(TournamentListWidget) +
+		   GetWidgetTreeBytes(MatchmakingWidget) +
+		   GetWidgetTreeBytes(ResultsWidget) +
+		   GetWidgetTreeBytes(WalletWidget) +
+		   GetWidgetTreeBytes(HUDWidget) +
+		   GetWidgetTreeBytes(LeaderboardWidget) +
+		   GetWidgetTreeBytes(PopupWidget) +
+		   GetWidgetTreeBytes(LoadingWidget);
+}
+
+void UDeskillzUIManager::ReleaseHiddenWidgets()
+{
+	int32 Released = 0;
+	Released += ReleaseIfHidden(TournamentListWidget);
+	Released += ReleaseIfHidden(MatchmakingWidget);
+	Released += ReleaseIfHidden(ResultsWidget);
+	Released += ReleaseIfHidden(WalletWidget);
+	Released += ReleaseIfHidden(HUDWidget);
+	Released += ReleaseIfHidden(LeaderboardWidget);
+	Released += ReleaseIfHidden(PopupWidget);
+	Released += ReleaseIfHidden(LoadingWidget);
+	
+	if (ActiveWidget && !ActiveWidget->IsInViewport())
+	{
+		ActiveWidget = nullptr;
+	}
+	
+	if (Released > 0)
+	{
+		UE_LOG(LogDeskillz, Log, TEXT("Released %d hidden widgets"), Released);
+	}
+}
+
 // ============================================================================
 // Internal Methods
 // ============================================================================
@@ -417,6 +489,8 @@ void UDeskillzUIManager::SetUIInputMode(bool bUIOnly)
 template<typename T>
 T* UDeskillzUIManager::CreateWidget(TSubclassOf<T> WidgetClass)
 {
+	LLM_SCOPE_BYTAG(Deskillz_UI);
+	
 	APlayerController* PC = GetPlayerController();
 	if (!PC)
 	{
@@ -3,6 +3,8 @@
 #include "UI/DeskillzWalletWidget.h"
 #include "Core/DeskillzSDK.h"
 #include "Deskillz.h"
+#include "Core/DeskillzStats.h"
+#include "Analytics/DeskillzTelemetry.h"
 #include "Components/TextBlock.h"
 #include "Components/Button.h"
 #include "Components/Image.h"
@@ -234,6 +236,9 @@ void UDeskillzWalletWidget::SetSelectedCurrency(const FString& Symbol)
 
 void UDeskillzWalletWidget::PopulateCurrencyList()
 {
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzPopulateWallet, DeskillzUIChannel);
+	DESKILLZ_SCOPED_ACTIVITY(WidgetPopulate);
+	
 	if (!CurrencyContainer)
 	{
 		return;
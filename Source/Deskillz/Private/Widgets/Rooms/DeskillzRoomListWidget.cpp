@@ -1,7 +1,9 @@
 // Copyright Deskillz Games. All Rights Reserved.
 
 #include "Widgets/Rooms/DeskillzRoomListWidget.h"
+#include "Core/DeskillzStats.h"
 #include "Rooms/DeskillzRooms.h"
+#include "Analytics/DeskillzTelemetry.h"
 #include "Components/Button.h"
 #include "Components/TextBlock.h"
 #include "Components/EditableTextBox.h"
@@ -9,6 +11,8 @@
 #include "Components/ScrollBox.h"
 #include "Components/VerticalBox.h"
 #include "Components/Throbber.h"
+#include "TimerManager.h"
+#include "Engine/World.h"
 
 // =============================================================================
 // UDeskillzRoomListWidget
@@ -16,7 +20,13 @@
 
 UDeskillzRoomListWidget::UDeskillzRoomListWidget(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
+	, PageSize(20)
+	, SearchDebounceSeconds(0.3f)
+	, LoadMoreScrollThreshold(200.0f)
 	, CurrentSortOption(ERoomSortOption::Newest)
+	, ListVersion(0)
+	, bServerQueried(false)
+	, RequestSerial(0)
 	, bIsLoading(false)
 	, bIsVisible(false)
 {
@@ -30,6 +40,14 @@ void UDeskillzRoomListWidget::NativeConstruct()
 
 void UDeskillzRoomListWidget::NativeDestruct()
 {
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(SearchDebounceHandle);
+	}
+	
+	// Drop responses still in flight
+	++RequestSerial;
+	
 	ClearRoomCards();
 	Super::NativeDestruct();
 }
@@ -63,6 +81,12 @@ void UDeskillzRoomListWidget::InitializeUI()
 		SearchInput->OnTextChanged.AddDynamic(this, &UDeskillzRoomListWidget::OnSearchTextChanged);
 	}
 	
+	// Load the next page when scrolled near the end
+	if (RoomListScrollBox)
+	{
+		RoomListScrollBox->OnUserScrolled.AddDynamic(this, &UDeskillzRoomListWidget::OnRoomListScrolled);
+	}
+	
 	// Setup sort dropdown
 	if (SortDropdown)
 	{
@@ -87,118 +111,286 @@ void UDeskillzRoomListWidget::InitializeUI()
 
 void UDeskillzRoomListWidget::RefreshRooms()
 {
+	const bool bQueryUnchanged = LoadedQuery.Search == SearchFilter && LoadedQuery.Sort == CurrentSortOption;
+	if (!bServerQueried || ListVersion == 0 || !bQueryUnchanged)
+	{
+		ReloadRooms();
+		return;
+	}
+	
 	if (bIsLoading)
 	{
 		return;
 	}
 	
-	SetLoading(true);
+	// Same query as the loaded list: fetch only what changed since
+	FRoomListQuery Query = LoadedQuery;
+	Query.Cursor.Empty();
+	Query.SinceVersion = ListVersion;
+	RequestPage(Query, false);
+}
+
+void UDeskillzRoomListWidget::LoadMoreRooms()
+{
+	if (bIsLoading || NextCursor.IsEmpty())
+	{
+		return;
+	}
+	
+	// The cursor belongs to the loaded query, not to a search still being typed
+	FRoomListQuery Query = LoadedQuery;
+	Query.Cursor = NextCursor;
+	Query.SinceVersion = 0;
+	RequestPage(Query, true);
+}
+
+void UDeskillzRoomListWidget::Show()
+{
+	bIsVisible = true;
+	SetVisibility(ESlateVisibility::Visible);
+	RefreshRooms();
+}
+
+void UDeskillzRoomListWidget::Hide()
+{
+	bIsVisible = false;
+	SetVisibility(ESlateVisibility::Collapsed);
+}
+
+// =============================================================================
+// Paging
+// =============================================================================
+
+FRoomListQuery UDeskillzRoomListWidget::MakeQuery() const
+{
+	FRoomListQuery Query;
+	Query.Search = SearchFilter;
+	Query.Sort = CurrentSortOption;
+	Query.Limit = PageSize;
+	return Query;
+}
+
+void UDeskillzRoomListWidget::ReloadRooms()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(SearchDebounceHandle);
+	}
 	
+	RequestPage(MakeQuery(), false);
+}
+
+void UDeskillzRoomListWidget::RequestPage(const FRoomListQuery& Query, bool bAppend)
+{
 	UDeskillzRooms* RoomSystem = UDeskillzRooms::Get(this);
 	if (!RoomSystem)
 	{
 		SetLoading(false);
-		ShowEmptyState(true);
+		ShowEmptyState(Rooms.Num() == 0);
 		return;
 	}
 	
-	FOnRoomListSuccess OnSuccess;
-	OnSuccess.BindLambda([this](const TArray<FPrivateRoom>& RoomList)
+	// A newer request supersedes any still in flight
+	const uint32 Serial = ++RequestSerial;
+	
+	// Only hide the list when there is nothing loaded to show
+	SetLoading(true, Rooms.Num() == 0);
+	
+	FOnRoomPageSuccess OnSuccess;
+	OnSuccess.BindLambda([this, Serial, Query, bAppend](const FRoomListPage& Page)
 	{
-		Rooms = RoomList;
-		ApplyFiltersAndSort();
+		if (Serial != RequestSerial)
+		{
+			return;
+		}
+		
+		LoadedQuery = Query;
+		HandlePage(Page, bAppend);
 		SetLoading(false);
 	});
 	
 	FOnRoomError OnError;
-	OnError.BindLambda([this](const FRoomError& Error)
+	OnError.BindLambda([this, Serial, Query, bAppend](const FRoomError& Error)
 	{
+		if (Serial != RequestSerial)
+		{
+			return;
+		}
+		
 		UE_LOG(LogTemp, Error, TEXT("[RoomListWidget] Failed to load rooms: %s"), *Error.Message);
-		Rooms.Empty();
-		UpdateRoomCards(Rooms);
+		
+		if (Query.SinceVersion > 0)
+		{
+			// Keep the list; the next refresh reloads it from the first page
+			ListVersion = 0;
+		}
+		else if (!bAppend)
+		{
+			Rooms.Empty();
+			NextCursor.Empty();
+			ListVersion = 0;
+			RoomSearchIndex.Reset();
+			UpdateRoomCards(Rooms);
+		}
 		SetLoading(false);
 	});
 	
-	RoomSystem->GetPublicRooms(OnSuccess, OnError);
-}
-
-void UDeskillzRoomListWidget::Show()
-{
-	bIsVisible = true;
-	SetVisibility(ESlateVisibility::Visible);
-	RefreshRooms();
+	RoomSystem->GetPublicRoomsPage(Query, OnSuccess, OnError);
 }
 
-void UDeskillzRoomListWidget::Hide()
+void UDeskillzRoomListWidget::HandlePage(const FRoomListPage& Page, bool bAppend)
 {
-	bIsVisible = false;
-	SetVisibility(ESlateVisibility::Collapsed);
+	bServerQueried = Page.bServerQueried;
+	
+	if (!bServerQueried)
+	{
+		// Unpaged server: the page is every room, filtered and sorted here
+		Rooms = Page.Rooms;
+		NextCursor.Empty();
+		ListVersion = 0;
+		SyncSearchIndex();
+		ApplyFiltersAndSort();
+		return;
+	}
+	
+	ListVersion = Page.Version;
+	Page.ApplyTo(Rooms, bAppend);
+	
+	if (Page.bIsDelta)
+	{
+		// Changed fees or player counts can move rooms within the loaded window
+		SortRooms(Rooms, LoadedQuery.Sort);
+	}
+	else
+	{
+		NextCursor = Page.NextCursor;
+	}
+	
+	SyncSearchIndex();
+	ApplyFiltersAndSort();
 }
 
 // =============================================================================
 // Filtering and Sorting
 // =============================================================================
 
+void UDeskillzRoomListWidget::SyncSearchIndex()
+{
+	TSet<FString> RoomIds;
+	RoomIds.Reserve(Rooms.Num());
+	
+	// Unchanged rooms are no-ops, so only new and edited rooms are re-indexed
+	for (const FPrivateRoom& Room : Rooms)
+	{
+		RoomIds.Add(Room.Id);
+		RoomSearchIndex.Update(Room.Id, { Room.Name, Room.RoomCode, Room.Host.Username, Room.Game.Name });
+	}
+	
+	RoomSearchIndex.Retain(RoomIds);
+}
+
 void UDeskillzRoomListWidget::ApplyFiltersAndSort()
 {
-	TArray<FPrivateRoom> FilteredRooms = Rooms;
+	// Server-queried rooms already match the loaded search and sort
+	if (bServerQueried && LoadedQuery.Search == SearchFilter && LoadedQuery.Sort == CurrentSortOption)
+	{
+		UpdateRoomCards(Rooms);
+		return;
+	}
 	
-	// Apply search filter
-	if (!SearchFilter.IsEmpty())
+	if (SearchFilter.TrimStartAndEnd().IsEmpty())
 	{
-		FilteredRooms = FilteredRooms.FilterByPredicate([this](const FPrivateRoom& Room)
+		TArray<FPrivateRoom> SortedRooms = Rooms;
+		SortRooms(SortedRooms, CurrentSortOption);
+		UpdateRoomCards(SortedRooms);
+		return;
+	}
+	
+	TMap<FString, int32> ScoreById;
+	for (const FDeskillzSearchIndex::FMatch& Match : RoomSearchIndex.Search(SearchFilter))
+	{
+		ScoreById.Add(Match.Id, Match.Score);
+	}
+	
+	TArray<FPrivateRoom> FilteredRooms;
+	FilteredRooms.Reserve(ScoreById.Num());
+	for (const FPrivateRoom& Room : Rooms)
+	{
+		if (ScoreById.Contains(Room.Id))
 		{
-			return Room.Name.Contains(SearchFilter, ESearchCase::IgnoreCase) ||
-			       Room.RoomCode.Contains(SearchFilter, ESearchCase::IgnoreCase) ||
-			       Room.Host.Username.Contains(SearchFilter, ESearchCase::IgnoreCase);
-		});
+			FilteredRooms.Add(Room);
+		}
 	}
 	
-	// Apply sort
-	switch (CurrentSortOption)
+	// Best matches first; the selected sort breaks ties
+	SortRooms(FilteredRooms, CurrentSortOption);
+	FilteredRooms.StableSort([&ScoreById](const FPrivateRoom& A, const FPrivateRoom& B)
+	{
+		return ScoreById.FindRef(A.Id) > ScoreById.FindRef(B.Id);
+	});
+	
+	UpdateRoomCards(FilteredRooms);
+}
+
+void UDeskillzRoomListWidget::SortRooms(TArray<FPrivateRoom>& InOutRooms, ERoomSortOption SortOption)
+{
+	// Stable, so rooms with equal keys keep the server's order
+	switch (SortOption)
 	{
 	case ERoomSortOption::Newest:
-		FilteredRooms.Sort([](const FPrivateRoom& A, const FPrivateRoom& B)
+		InOutRooms.StableSort([](const FPrivateRoom& A, const FPrivateRoom& B)
 		{
 			return A.CreatedAt > B.CreatedAt;
 		});
 		break;
 		
 	case ERoomSortOption::EntryFeeAsc:
-		FilteredRooms.Sort([](const FPrivateRoom& A, const FPrivateRoom& B)
+		InOutRooms.StableSort([](const FPrivateRoom& A, const FPrivateRoom& B)
 		{
 			return A.EntryFee < B.EntryFee;
 		});
 		break;
 		
 	case ERoomSortOption::EntryFeeDesc:
-		FilteredRooms.Sort([](const FPrivateRoom& A, const FPrivateRoom& B)
+		InOutRooms.StableSort([](const FPrivateRoom& A, const FPrivateRoom& B)
 		{
 			return A.EntryFee > B.EntryFee;
 		});
 		break;
 		
 	case ERoomSortOption::PlayersAsc:
-		FilteredRooms.Sort([](const FPrivateRoom& A, const FPrivateRoom& B)
+		InOutRooms.StableSort([](const FPrivateRoom& A, const FPrivateRoom& B)
 		{
 			return A.CurrentPlayers < B.CurrentPlayers;
 		});
 		break;
 		
 	case ERoomSortOption::PlayersDesc:
-		FilteredRooms.Sort([](const FPrivateRoom& A, const FPrivateRoom& B)
+		InOutRooms.StableSort([](const FPrivateRoom& A, const FPrivateRoom& B)
 		{
 			return A.CurrentPlayers > B.CurrentPlayers;
 		});
 		break;
 	}
-	
-	UpdateRoomCards(FilteredRooms);
+}
+
+/** Whether a room card shows anything that differs from the room */
+static bool HasRoomCardChanged(const FPrivateRoom& Shown, const FPrivateRoom& Room)
+{
+	return Shown.CurrentPlayers != Room.CurrentPlayers
+		|| Shown.MaxPlayers != Room.MaxPlayers
+		|| Shown.Status != Room.Status
+		|| Shown.EntryFee != Room.EntryFee
+		|| Shown.EntryCurrency != Room.EntryCurrency
+		|| Shown.Name != Room.Name
+		|| Shown.RoomCode != Room.RoomCode
+		|| Shown.Host.Username != Room.Host.Username;
 }
 
 void UDeskillzRoomListWidget::UpdateRoomCards(const TArray<FPrivateRoom>& FilteredRooms)
 {
-	ClearRoomCards();
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzPopulateRoomList, DeskillzUIChannel);
+	DESKILLZ_SCOPED_ACTIVITY(WidgetPopulate);
 	
 	// Show empty state if no rooms
 	ShowEmptyState(FilteredRooms.Num() == 0);
@@ -208,16 +400,70 @@ void UDeskillzRoomListWidget::UpdateRoomCards(const TArray<FPrivateRoom>& Filter
 		return;
 	}
 	
-	// Create cards for each room
+	// Reuse cards by room ID; only changed rooms are re-rendered
+	TArray<UDeskillzRoomCardWidget*> OrderedCards;
+	OrderedCards.Reserve(FilteredRooms.Num());
+	
+	TMap<FString, UDeskillzRoomCardWidget*> CardsById;
+	CardsById.Reserve(FilteredRooms.Num());
+	
 	for (const FPrivateRoom& Room : FilteredRooms)
 	{
-		UDeskillzRoomCardWidget* Card = CreateRoomCard(Room);
+		UDeskillzRoomCardWidget* Card = nullptr;
+		if (RoomCardsById.RemoveAndCopyValue(Room.Id, Card) && Card)
+		{
+			if (HasRoomCardChanged(Card->GetRoom(), Room))
+			{
+				Card->SetRoom(Room);
+			}
+		}
+		else
+		{
+			Card = CreateRoomCard(Room);
+		}
+		
 		if (Card)
 		{
-			RoomCards.Add(Card);
+			OrderedCards.Add(Card);
+			CardsById.Add(Room.Id, Card);
+		}
+	}
+	
+	// Whatever is left belongs to rooms no longer listed
+	for (const TPair<FString, UDeskillzRoomCardWidget*>& Pair : RoomCardsById)
+	{
+		if (Pair.Value)
+		{
+			Pair.Value->RemoveFromParent();
+		}
+	}
+	
+	// Appending a page keeps existing children; any other order change re-adds them
+	const int32 NumKept = RoomCards.Num();
+	bool bIsAppend = RoomCardsById.Num() == 0 && NumKept <= OrderedCards.Num();
+	for (int32 i = 0; bIsAppend && i < NumKept; i++)
+	{
+		bIsAppend = RoomCards[i] == OrderedCards[i];
+	}
+	
+	if (bIsAppend)
+	{
+		for (int32 i = NumKept; i < OrderedCards.Num(); i++)
+		{
+			RoomListContent->AddChild(OrderedCards[i]);
+		}
+	}
+	else
+	{
+		RoomListContent->ClearChildren();
+		for (UDeskillzRoomCardWidget* Card : OrderedCards)
+		{
 			RoomListContent->AddChild(Card);
 		}
 	}
+	
+	RoomCards = MoveTemp(OrderedCards);
+	RoomCardsById = MoveTemp(CardsById);
 }
 
 UDeskillzRoomCardWidget* UDeskillzRoomListWidget::CreateRoomCard(const FPrivateRoom& Room)
@@ -248,12 +494,18 @@ void UDeskillzRoomListWidget::ClearRoomCards()
 		}
 	}
 	RoomCards.Empty();
+	RoomCardsById.Empty();
 }
 
-void UDeskillzRoomListWidget::SetLoading(bool bLoading)
+void UDeskillzRoomListWidget::SetLoading(bool bLoading, bool bBlocking)
 {
 	bIsLoading = bLoading;
 	
+	if (!bBlocking && bLoading)
+	{
+		return;
+	}
+	
 	if (LoadingIndicator)
 	{
 		LoadingIndicator->SetVisibility(bLoading ? ESlateVisibility::Visible : ESlateVisibility::Collapsed);
@@ -295,14 +547,49 @@ void UDeskillzRoomListWidget::OnRefreshButtonClicked()
 void UDeskillzRoomListWidget::OnSearchTextChanged(const FText& Text)
 {
 	SearchFilter = Text.ToString();
+	
+	// Narrow the loaded rooms immediately from the index
 	ApplyFiltersAndSort();
+	
+	if (!bServerQueried)
+	{
+		return;
+	}
+	
+	// Search the server once typing pauses
+	UWorld* World = GetWorld();
+	if (!World || SearchDebounceSeconds <= 0.0f)
+	{
+		ReloadRooms();
+		return;
+	}
+	
+	World->GetTimerManager().SetTimer(SearchDebounceHandle,
+		FTimerDelegate::CreateUObject(this, &UDeskillzRoomListWidget::ReloadRooms),
+		SearchDebounceSeconds, false);
 }
 
 void UDeskillzRoomListWidget::OnSortSelectionChanged(FString SelectedItem, ESelectInfo::Type SelectionType)
 {
 	int32 Index = SortDropdown ? SortDropdown->GetSelectedIndex() : 0;
 	CurrentSortOption = static_cast<ERoomSortOption>(Index);
-	ApplyFiltersAndSort();
+	
+	if (bServerQueried)
+	{
+		ReloadRooms();
+	}
+	else
+	{
+		ApplyFiltersAndSort();
+	}
+}
+
+void UDeskillzRoomListWidget::OnRoomListScrolled(float CurrentOffset)
+{
+	if (RoomListScrollBox && RoomListScrollBox->GetScrollOffsetOfEnd() - CurrentOffset <= LoadMoreScrollThreshold)
+	{
+		LoadMoreRooms();
+	}
 }
 
 void UDeskillzRoomListWidget::OnCreateRoomButtonClicked()
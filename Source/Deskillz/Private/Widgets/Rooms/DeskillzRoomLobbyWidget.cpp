@@ -1,8 +1,10 @@
 // Copyright Deskillz Games. All Rights Reserved.
 
 #include "Widgets/Rooms/DeskillzRoomLobbyWidget.h"
+#include "Core/DeskillzStats.h"
 #include "Widgets/Rooms/DeskillzRoomPlayerCard.h"
 #include "Rooms/DeskillzRooms.h"
+#include "Analytics/DeskillzTelemetry.h"
 #include "Components/Button.h"
 #include "Components/TextBlock.h"
 #include "Components/ScrollBox.h"
@@ -113,6 +115,7 @@ void UDeskillzRoomLobbyWidget::SubscribeToRoomEvents()
 	Rooms->OnPlayerJoined.AddDynamic(this, &UDeskillzRoomLobbyWidget::HandlePlayerJoined);
 	Rooms->OnPlayerLeft.AddDynamic(this, &UDeskillzRoomLobbyWidget::HandlePlayerLeft);
 	Rooms->OnPlayerReadyChanged.AddDynamic(this, &UDeskillzRoomLobbyWidget::HandlePlayerReadyChanged);
+	Rooms->OnPlayerUpdated.AddDynamic(this, &UDeskillzRoomLobbyWidget::HandlePlayerUpdated);
 	Rooms->OnCountdownStarted.AddDynamic(this, &UDeskillzRoomLobbyWidget::HandleCountdownStarted);
 	Rooms->OnCountdownTick.AddDynamic(this, &UDeskillzRoomLobbyWidget::HandleCountdownTick);
 	Rooms->OnChatReceived.AddDynamic(this, &UDeskillzRoomLobbyWidget::HandleChatReceived);
@@ -129,6 +132,7 @@ void UDeskillzRoomLobbyWidget::UnsubscribeFromRoomEvents()
 	Rooms->OnPlayerJoined.RemoveDynamic(this, &UDeskillzRoomLobbyWidget::HandlePlayerJoined);
 	Rooms->OnPlayerLeft.RemoveDynamic(this, &UDeskillzRoomLobbyWidget::HandlePlayerLeft);
 	Rooms->OnPlayerReadyChanged.RemoveDynamic(this, &UDeskillzRoomLobbyWidget::HandlePlayerReadyChanged);
+	Rooms->OnPlayerUpdated.RemoveDynamic(this, &UDeskillzRoomLobbyWidget::HandlePlayerUpdated);
 	Rooms->OnCountdownStarted.RemoveDynamic(this, &UDeskillzRoomLobbyWidget::HandleCountdownStarted);
 	Rooms->OnCountdownTick.RemoveDynamic(this, &UDeskillzRoomLobbyWidget::HandleCountdownTick);
 	Rooms->OnChatReceived.RemoveDynamic(this, &UDeskillzRoomLobbyWidget::HandleChatReceived);
@@ -157,9 +161,16 @@ void UDeskillzRoomLobbyWidget::SetRoom(const FPrivateRoom& Room)
 
 void UDeskillzRoomLobbyWidget::UpdateRoom(const FPrivateRoom& Room)
 {
+	const bool bWasHost = bIsHost;
 	CurrentRoom = Room;
 	bIsHost = Room.IsCurrentUserHost();
 	
+	// Kick buttons depend on host status
+	if (bIsHost != bWasHost)
+	{
+		ClearPlayerCards();
+	}
+	
 	UpdateDisplay();
 	UpdatePlayerList();
 	UpdateButtons();
@@ -248,23 +259,77 @@ void UDeskillzRoomLobbyWidget::UpdateDisplay()
 	}
 }
 
+/** Whether a card showing Shown needs refreshing for Player */
+static bool HasPlayerCardChanged(const FRoomPlayer& Shown, const FRoomPlayer& Player)
+{
+	return Shown.bIsReady != Player.bIsReady
+		|| Shown.bIsAdmin != Player.bIsAdmin
+		|| Shown.Username != Player.Username
+		|| Shown.AvatarUrl != Player.AvatarUrl;
+}
+
 void UDeskillzRoomLobbyWidget::UpdatePlayerList()
 {
-	ClearPlayerCards();
+	DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzPopulateRoomLobby, DeskillzUIChannel);
+	DESKILLZ_SCOPED_ACTIVITY(WidgetPopulate);
 	
 	if (!PlayerListContent)
 	{
 		return;
 	}
 	
+	// Drop cards for players no longer in the room
+	for (int32 i = PlayerCards.Num() - 1; i >= 0; i--)
+	{
+		UDeskillzRoomPlayerCard* Card = PlayerCards[i];
+		if (!Card)
+		{
+			PlayerCards.RemoveAt(i);
+		}
+		else if (!CurrentRoom.FindPlayer(Card->GetPlayerId()))
+		{
+			RemovePlayerCard(Card->GetPlayerId());
+		}
+	}
+	
+	// Update changed cards in place; new players are appended, matching roster order
 	for (const FRoomPlayer& Player : CurrentRoom.Players)
 	{
-		UDeskillzRoomPlayerCard* Card = CreatePlayerCard(Player);
-		if (Card)
+		UDeskillzRoomPlayerCard** Card = PlayerCardsById.Find(Player.Id);
+		if (!Card)
 		{
-			PlayerCards.Add(Card);
-			PlayerListContent->AddChild(Card);
+			AddPlayerCard(Player);
 		}
+		else if (HasPlayerCardChanged((*Card)->GetPlayer(), Player))
+		{
+			(*Card)->SetPlayer(Player, bIsHost && !Player.bIsCurrentUser);
+		}
+	}
+}
+
+void UDeskillzRoomLobbyWidget::AddPlayerCard(const FRoomPlayer& Player)
+{
+	if (!PlayerListContent || PlayerCardsById.Contains(Player.Id))
+	{
+		return;
+	}
+	
+	UDeskillzRoomPlayerCard* Card = CreatePlayerCard(Player);
+	if (Card)
+	{
+		PlayerCards.Add(Card);
+		PlayerCardsById.Add(Player.Id, Card);
+		PlayerListContent->AddChild(Card);
+	}
+}
+
+void UDeskillzRoomLobbyWidget::RemovePlayerCard(const FString& PlayerId)
+{
+	UDeskillzRoomPlayerCard* Card = nullptr;
+	if (PlayerCardsById.RemoveAndCopyValue(PlayerId, Card) && Card)
+	{
+		Card->RemoveFromParent();
+		PlayerCards.Remove(Card);
 	}
 }
 
@@ -296,6 +361,7 @@ void UDeskillzRoomLobbyWidget::ClearPlayerCards()
 		}
 	}
 	PlayerCards.Empty();
+	PlayerCardsById.Empty();
 }
 
 void UDeskillzRoomLobbyWidget::UpdateButtons()
@@ -522,11 +588,15 @@ void UDeskillzRoomLobbyWidget::HandlePlayerJoined(const FRoomPlayer& Player)
 		return;
 	}
 	
-	UDeskillzRooms* Rooms = UDeskillzRooms::Get(this);
-	if (Rooms)
+	if (!CurrentRoom.FindPlayer(Player.Id))
 	{
-		UpdateRoom(Rooms->GetCurrentRoom());
+		CurrentRoom.AddPlayer(Player);
+		CurrentRoom.CurrentPlayers++;
 	}
+	
+	AddPlayerCard(Player);
+	UpdateDisplay();
+	UpdateButtons();
 }
 
 void UDeskillzRoomLobbyWidget::HandlePlayerLeft(const FString& PlayerId)
@@ -536,11 +606,14 @@ void UDeskillzRoomLobbyWidget::HandlePlayerLeft(const FString& PlayerId)
 		return;
 	}
 	
-	UDeskillzRooms* Rooms = UDeskillzRooms::Get(this);
-	if (Rooms)
+	if (CurrentRoom.RemovePlayer(PlayerId))
 	{
-		UpdateRoom(Rooms->GetCurrentRoom());
+		CurrentRoom.CurrentPlayers = FMath::Max(0, CurrentRoom.CurrentPlayers - 1);
 	}
+	
+	RemovePlayerCard(PlayerId);
+	UpdateDisplay();
+	UpdateButtons();
 }
 
 void UDeskillzRoomLobbyWidget::HandlePlayerReadyChanged(const FString& PlayerId, bool bReady)
@@ -550,13 +623,32 @@ void UDeskillzRoomLobbyWidget::HandlePlayerReadyChanged(const FString& PlayerId,
 		return;
 	}
 	
-	// Update own ready state if it's us
-	// In a real implementation, check if PlayerId matches current user
+	if (FRoomPlayer* Player = CurrentRoom.FindPlayer(PlayerId))
+	{
+		Player->bIsReady = bReady;
+	}
 	
-	UDeskillzRooms* Rooms = UDeskillzRooms::Get(this);
-	if (Rooms)
+	if (UDeskillzRoomPlayerCard** Card = PlayerCardsById.Find(PlayerId))
+	{
+		(*Card)->SetReady(bReady);
+	}
+	
+	UpdateDisplay();
+	UpdateButtons();
+}
+
+void UDeskillzRoomLobbyWidget::HandlePlayerUpdated(const FRoomPlayer& Player)
+{
+	if (!bIsVisible)
+	{
+		return;
+	}
+	
+	CurrentRoom.AddPlayer(Player);
+	
+	if (UDeskillzRoomPlayerCard** Card = PlayerCardsById.Find(Player.Id))
 	{
-		UpdateRoom(Rooms->GetCurrentRoom());
+		(*Card)->SetPlayer(Player, bIsHost && !Player.bIsCurrentUser);
 	}
 }
 
@@ -411,6 +411,18 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Deskillz|Analytics")
 	void ClearQueue();
 	
+	/**
+	 * Get memory held by queued events (bytes)
+	 * Safe to call from any thread; takes the queue lock.
+	 */
+	int64 GetQueueMemoryBytes() const;
+	
+	/**
+	 * Drop oldest queued events until the queue fits in MaxBytes
+	 * Events are persisted first when offline persistence is enabled.
+	 */
+	void TrimQueue(int64 MaxBytes);
+	
 	// ========================================================================
 	// Session
 	// ========================================================================
@@ -490,8 +502,8 @@ protected:
 	/** Is flushing */
 	bool bIsFlushing = false;
 	
-	/** Critical section for queue access */
-	FCriticalSection QueueLock;
+	/** Critical section for queue access (mutable so const readers can lock) */
+	mutable FCriticalSection QueueLock;
 	
 	// ========================================================================
 	// Internal Methods
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
+#include "Core/DeskillzSlotMap.h"
 #include "DeskillzEventTracker.generated.h"
 
 class UDeskillzAnalytics;
@@ -41,6 +42,38 @@ struct DESKILLZ_API FDeskillzTimedEvent
 	TMap<FString, FString> Parameters;
 };
 
+/**
+ * Handle to an active timed event
+ * 
+ * Returned by BeginTimedEvent. Stale once the event is finished or aborted.
+ */
+USTRUCT(BlueprintType)
+struct DESKILLZ_API FDeskillzTimedEventHandle
+{
+	GENERATED_BODY()
+	
+	int32 Index = INDEX_NONE;
+	uint32 Generation = 0;
+	
+	bool IsValid() const { return Generation != 0; }
+};
+
+/**
+ * Handle to an active funnel
+ * 
+ * Returned by BeginFunnel. Stale once the funnel completes or is aborted.
+ */
+USTRUCT(BlueprintType)
+struct DESKILLZ_API FDeskillzFunnelHandle
+{
+	GENERATED_BODY()
+	
+	int32 Index = INDEX_NONE;
+	uint32 Generation = 0;
+	
+	bool IsValid() const { return Generation != 0; }
+};
+
 /**
  * Funnel step
  */
@@ -157,6 +190,18 @@ struct DESKILLZ_API FDeskillzRevenueEvent
  *   // Funnel
  *   Tracker->StartFunnel("registration", {"email", "password", "confirm"});
  *   Tracker->RecordFunnelStep("registration", "email");
+ * 
+ * High-frequency events (per round, per level) should use the handle API,
+ * which does no string hashing or map copies per call:
+ *   static const FName RoundEvent(TEXT("round"));
+ *   FDeskillzTimedEventHandle Round = Tracker->BeginTimedEvent(RoundEvent);
+ *   // ... round ...
+ *   Tracker->FinishTimedEvent(Round, {});
+ *   
+ *   // Funnels are defined once; steps are then recorded by index
+ *   int32 Onboarding = Tracker->DefineFunnel("onboarding", {"tutorial", "practice", "first_match"});
+ *   FDeskillzFunnelHandle Funnel = Tracker->BeginFunnel(Onboarding);
+ *   Tracker->AdvanceFunnel(Funnel, 0, {});
  */
 UCLASS(BlueprintType)
 class DESKILLZ_API UDeskillzEventTracker : public UObject
@@ -210,6 +255,30 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Deskillz|Events")
 	bool IsTimedEventActive(const FString& EventName) const;
 	
+	/**
+	 * Begin a timed event and return its handle
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Deskillz|Events")
+	FDeskillzTimedEventHandle BeginTimedEvent(FName EventName);
+	
+	/**
+	 * Finish a timed event and track its duration
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Deskillz|Events")
+	void FinishTimedEvent(FDeskillzTimedEventHandle Handle, const TMap<FString, FString>& AdditionalParams);
+	
+	/**
+	 * Abort a timed event without tracking it
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Deskillz|Events")
+	void AbortTimedEvent(FDeskillzTimedEventHandle Handle);
+	
+	/**
+	 * Get elapsed time of an active timed event (seconds)
+	 */
+	UFUNCTION(BlueprintPure, Category = "Deskillz|Events")
+	float GetTimedEventElapsed(FDeskillzTimedEventHandle Handle) const;
+	
 	// ========================================================================
 	// Conversion Funnels
 	// ========================================================================
@@ -245,6 +314,45 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Deskillz|Events")
 	FString GetCurrentFunnelStep(const FString& FunnelName) const;
 	
+	/**
+	 * Define a funnel once and return its ID
+	 * Redefining a name with different steps replaces them; while funnels of
+	 * the old steps are running, the new steps get a new ID and running
+	 * funnels keep the old one.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Deskillz|Events")
+	int32 DefineFunnel(const FString& FunnelName, const TArray<FString>& Steps);
+	
+	/**
+	 * Get the index of a step in a defined funnel (INDEX_NONE if unknown)
+	 */
+	UFUNCTION(BlueprintPure, Category = "Deskillz|Events")
+	int32 GetFunnelStepIndex(int32 FunnelId, const FString& StepName) const;
+	
+	/**
+	 * Begin a defined funnel and return its handle
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Deskillz|Events")
+	FDeskillzFunnelHandle BeginFunnel(int32 FunnelId);
+	
+	/**
+	 * Record completion of a funnel step by index
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Deskillz|Events")
+	void AdvanceFunnel(FDeskillzFunnelHandle Handle, int32 StepIndex, const TMap<FString, FString>& Data);
+	
+	/**
+	 * Abort a funnel (tracked as abandoned)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Deskillz|Events")
+	void AbortFunnel(FDeskillzFunnelHandle Handle, const FString& Reason);
+	
+	/**
+	 * Get progress of an active funnel (0-1)
+	 */
+	UFUNCTION(BlueprintPure, Category = "Deskillz|Events")
+	float GetFunnelCompletion(FDeskillzFunnelHandle Handle) const;
+	
 	// ========================================================================
 	// Revenue Tracking
 	// ========================================================================
@@ -390,11 +498,52 @@ protected:
 	UPROPERTY()
 	UDeskillzAnalytics* Analytics;
 	
+	/** Running timed event */
+	struct FActiveTimedEvent
+	{
+		FName EventName;
+		uint64 StartCycles = 0;
+		TMap<FString, FString> Parameters;
+	};
+	
+	/** Precompiled funnel */
+	struct FFunnelDefinition
+	{
+		FString FunnelName;
+		TArray<FString> Steps;
+		TMap<FString, int32> StepIndices;
+		
+		/** Running funnels using this definition */
+		int32 ActiveCount = 0;
+	};
+	
+	/** Running funnel */
+	struct FActiveFunnel
+	{
+		int32 FunnelId = INDEX_NONE;
+		uint64 StartCycles = 0;
+		uint64 LastStepCycles = 0;
+		int32 StepsCompleted = 0;
+		int32 LastStepIndex = INDEX_NONE;
+	};
+	
 	/** Active timed events */
-	TMap<FString, FDeskillzTimedEvent> ActiveTimedEvents;
+	TDeskillzSlotMap<FActiveTimedEvent, FDeskillzTimedEventHandle> ActiveTimedEvents;
+	
+	/** Timed events started by name */
+	TMap<FString, FDeskillzTimedEventHandle> NamedTimedEvents;
+	
+	/** Funnel definitions, indexed by funnel ID */
+	TArray<FFunnelDefinition> FunnelDefinitions;
+	
+	/** Funnel name to funnel ID */
+	TMap<FString, int32> FunnelIds;
 	
 	/** Active funnels */
-	TMap<FString, FDeskillzFunnel> ActiveFunnels;
+	TDeskillzSlotMap<FActiveFunnel, FDeskillzFunnelHandle> ActiveFunnels;
+	
+	/** Funnels started by name */
+	TMap<FString, FDeskillzFunnelHandle> NamedFunnels;
 	
 	/** Counters */
 	TMap<FString, int32> Counters;
@@ -410,4 +559,7 @@ protected:
 	
 	/** Get current timestamp */
 	int64 GetCurrentTimestamp() const;
+	
+	/** Seconds between two FPlatformTime::Cycles64 readings */
+	static float CyclesToSeconds(uint64 StartCycles, uint64 EndCycles);
 };
@@ -4,6 +4,8 @@
 
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
+#include "Core/DeskillzRingBuffer.h"
+#include "Core/DeskillzStats.h"
 #include "DeskillzTelemetry.generated.h"
 
 /**
@@ -34,6 +36,30 @@ enum class EDeskillzMetricType : uint8
 	Custom
 };
 
+/**
+ * SDK activity that can be in flight during a frame (for hitch attribution)
+ */
+UENUM(BlueprintType)
+enum class EDeskillzSdkActivity : uint8
+{
+	/** No SDK activity */
+	None,
+	
+	/** HTTP response handling and callbacks */
+	HttpCompletion,
+	
+	/** JSON deserialization */
+	JsonParse,
+	
+	/** Widget list population */
+	WidgetPopulate,
+	
+	/** Analytics batch flush */
+	AnalyticsFlush,
+	
+	MAX UMETA(Hidden)
+};
+
 /**
  * Performance sample
  */
@@ -188,11 +214,236 @@ struct DESKILLZ_API FDeskillzTelemetryConfig
 	/** High latency threshold for warnings (ms) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Telemetry")
 	float HighLatencyThreshold = 150.0f;
+	
+	/** Detect frame hitches and attribute them to SDK activity */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Telemetry")
+	bool bTrackHitches = true;
+	
+	/** A frame is a hitch when it takes this many times the median frame time */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Telemetry")
+	float HitchMedianMultiplier = 2.5f;
+	
+	/** Frames shorter than this are never hitches (ms) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Telemetry")
+	float MinHitchFrameTimeMs = 33.0f;
+	
+	/** Fraction of a hitch's excess time SDK work must cover to be blamed on the SDK */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Telemetry")
+	float HitchAttributionFraction = 0.5f;
+	
+	/** Max individual hitches kept per match */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Telemetry")
+	int32 MaxHitchRecords = 50;
+};
+
+/**
+ * A single detected frame hitch
+ */
+USTRUCT(BlueprintType)
+struct DESKILLZ_API FDeskillzHitchRecord
+{
+	GENERATED_BODY()
+	
+	/** Timestamp */
+	UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+	int64 Timestamp = 0;
+	
+	/** Frame time (ms) */
+	UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+	float FrameTimeMs = 0.0f;
+	
+	/** Median frame time at detection (ms) */
+	UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+	float MedianFrameTimeMs = 0.0f;
+	
+	/** Game thread time spent in SDK activity during the frame (ms) */
+	UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+	float SdkTimeMs = 0.0f;
+	
+	/** SDK activity that took the most time during the frame */
+	UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+	EDeskillzSdkActivity PrimaryActivity = EDeskillzSdkActivity::None;
+	
+	/** Bitmask of all SDK activities in flight (1 << activity) */
+	UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+	int32 ActivityMask = 0;
+	
+	/** SDK work accounts for the hitch */
+	UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+	bool bSdkAttributed = false;
+};
+
+/**
+ * Per-match frame time and hitch summary
+ */
+USTRUCT(BlueprintType)
+struct DESKILLZ_API FDeskillzMatchHitchReport
+{
+	GENERATED_BODY()
+	
+	/** Match ID (empty outside a match) */
+	UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+	FString MatchId;
+	
+	/** Frames observed */
+	UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+	int32 FrameCount = 0;
+	
+	/** Hitches detected */
+	UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+	int32 HitchCount = 0;
+	
+	/** Hitches attributed to SDK activity */
+	UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+	int32 SdkHitchCount = 0;
+	
+	/** Median frame time (ms) */
+	UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+	float MedianFrameTimeMs = 0.0f;
+	
+	/** 99th percentile frame time (ms) */
+	UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+	float P99FrameTimeMs = 0.0f;
+	
+	/** Worst frame time (ms) */
+	UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+	float WorstFrameTimeMs = 0.0f;
+	
+	/** Total game thread time spent in tracked SDK activity (ms) */
+	UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+	float TotalSdkTimeMs = 0.0f;
+	
+	/** SDK-attributed hitches by primary activity */
+	UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+	TMap<EDeskillzSdkActivity, int32> HitchesByActivity;
+	
+	/** Individual hitches (capped by MaxHitchRecords) */
+	UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+	TArray<FDeskillzHitchRecord> Hitches;
+};
+
+/**
+ * Log-bucketed frame time histogram
+ * 
+ * Four buckets per octave from 0.25ms to 4s, so percentiles are accurate to
+ * ~10% at any frame rate with a fixed 56-counter footprint.
+ */
+struct DESKILLZ_API FDeskillzFrameTimeHistogram
+{
+	static constexpr int32 BucketsPerOctave = 4;
+	static constexpr int32 MinOctave = -2;
+	static constexpr int32 NumBuckets = 56;
+	
+	void Add(float FrameTimeMs);
+	void Reset();
+	
+	/** Approximate percentile (0-1) in ms */
+	float GetPercentile(float Percentile) const;
+	
+	/** Lower bound of a bucket in ms */
+	static float GetBucketLowerBoundMs(int32 Bucket);
+	
+	int32 GetTotalCount() const { return TotalCount; }
+	const int32* GetBucketCounts() const { return BucketCounts; }
+	
+private:
+	int32 BucketCounts[NumBuckets] = {};
+	int32 TotalCount = 0;
+};
+
+/**
+ * Marks SDK work on the game thread for hitch attribution
+ * 
+ * Time spent inside the scope is accumulated per activity and consumed by
+ * UDeskillzTelemetry at the next tick. Nested scopes record exclusive time
+ * (a parent excludes its children), so activity totals add up to SDK time.
+ * Off-game-thread scopes are ignored.
+ */
+class DESKILLZ_API FDeskillzScopedActivity
+{
+public:
+	explicit FDeskillzScopedActivity(EDeskillzSdkActivity InActivity);
+	~FDeskillzScopedActivity();
+	
+	FDeskillzScopedActivity(const FDeskillzScopedActivity&) = delete;
+	FDeskillzScopedActivity& operator=(const FDeskillzScopedActivity&) = delete;
+	
+private:
+	EDeskillzSdkActivity Activity;
+	uint64 StartCycles;
+	
+	/** Enclosing scope on the game thread, if any */
+	FDeskillzScopedActivity* Parent = nullptr;
+	
+	/** Inclusive time of nested scopes, excluded from this one */
+	uint64 ChildCycles = 0;
+};
+
+#define DESKILLZ_SCOPED_ACTIVITY(ActivityName) \
+	FDeskillzScopedActivity PREPROCESSOR_JOIN(DeskillzScopedActivity_, __LINE__)(EDeskillzSdkActivity::ActivityName)
+
+/**
+ * Sample window for one metric
+ * 
+ * Values and timestamps are stored column-wise in a fixed-size ring, with
+ * running aggregates so min/max/average/stddev never rescan the window.
+ * Type and match context are per-metric/per-session, not per-sample.
+ */
+struct FDeskillzMetricWindow
+{
+	/** Metric type */
+	EDeskillzMetricType Type = EDeskillzMetricType::Custom;
+	
+	/** Sample values and timestamps (ms) */
+	TDeskillzSoARingBuffer<float, int64> Samples;
+	
+	/** Running aggregates over sample values */
+	TDeskillzWindowAggregates<float> Aggregates;
+	
+	FDeskillzMetricWindow() = default;
+	
+	FDeskillzMetricWindow(EDeskillzMetricType InType, int32 Capacity)
+		: Type(InType)
+		, Samples(Capacity)
+		, Aggregates(Capacity)
+	{
+	}
+	
+	void Add(float Value, int64 Timestamp)
+	{
+		if (Samples.IsFull() && !Samples.IsEmpty())
+		{
+			Aggregates.RemoveOldest(Samples.Get<0>(0));
+		}
+		if (Samples.Capacity() > 0)
+		{
+			Samples.Push(Value, Timestamp);
+			Aggregates.Add(Value);
+		}
+	}
+	
+	/** Resize the window, keeping the newest samples */
+	void SetCapacity(int32 Capacity)
+	{
+		Samples.SetCapacity(Capacity);
+		Aggregates.SetCapacity(Samples.Capacity());
+		Samples.ForEach<0>([this](float Value) { Aggregates.Add(Value); });
+	}
+	
+	/** Bytes reserved by the window (sample columns plus aggregate deques) */
+	int64 GetAllocatedBytes() const
+	{
+		return static_cast<int64>(Samples.Capacity()) * BytesPerSample;
+	}
+	
+	/** Sample columns plus min/max deque entries */
+	static constexpr int64 BytesPerSample = sizeof(float) + sizeof(int64) + 2 * (sizeof(float) + sizeof(uint64));
 };
 
 /** Telemetry delegates */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPerformanceWarning, const FString&, Warning);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnNetworkQualityChanged, int32, Quality);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnHitchDetected, const FDeskillzHitchRecord&, Hitch);
 
 /**
  * Deskillz Telemetry System
@@ -232,7 +483,7 @@ public:
 	// FTickableGameObject
 	virtual void Tick(float DeltaTime) override;
 	virtual bool IsTickable() const override { return bIsMonitoring; }
-	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UDeskillzTelemetry, STATGROUP_Tickables); }
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UDeskillzTelemetry, STATGROUP_Deskillz); }
 	
 	// ========================================================================
 	// Singleton Access
@@ -361,12 +612,35 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Deskillz|Telemetry")
 	float GetMemoryUsageMB() const;
 	
+	/**
+	 * Get memory held by metric sample windows (bytes)
+	 */
+	int64 GetSampleMemoryBytes() const;
+	
+	/**
+	 * Shrink metric sample windows until they fit in MaxBytes
+	 * Newest samples are kept; new windows use the reduced size.
+	 */
+	void TrimSamples(int64 MaxBytes);
+	
 	/**
 	 * Get network quality (0-100)
 	 */
 	UFUNCTION(BlueprintPure, Category = "Deskillz|Telemetry")
 	int32 GetNetworkQuality() const { return NetworkMetrics.Quality; }
 	
+	/**
+	 * Get frame time and hitch summary for the current match
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Deskillz|Telemetry")
+	FDeskillzMatchHitchReport GetMatchHitchReport() const;
+	
+	/**
+	 * Get frame time histogram bucket counts
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Deskillz|Telemetry")
+	TArray<int32> GetFrameTimeHistogram() const;
+	
 	// ========================================================================
 	// Reporting
 	// ========================================================================
@@ -395,6 +669,10 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Deskillz|Telemetry")
 	FOnNetworkQualityChanged OnNetworkQualityChanged;
 	
+	/** Called when a frame hitch is detected */
+	UPROPERTY(BlueprintAssignable, Category = "Deskillz|Telemetry")
+	FOnHitchDetected OnHitchDetected;
+	
 protected:
 	// ========================================================================
 	// Configuration
@@ -437,13 +715,35 @@ protected:
 	// ========================================================================
 	
 	/** Performance samples by metric name */
-	TMap<FString, TArray<FDeskillzPerformanceSample>> Samples;
+	TMap<FString, FDeskillzMetricWindow> Samples;
+	
+	/** Per-metric window size (reduced by TrimSamples) */
+	int32 SampleWindowCapacity = 0;
 	
 	/** Frame time history for FPS calculation */
-	TArray<float> FrameTimeHistory;
+	TDeskillzStatWindow<float> FrameTimeHistory;
 	
 	/** Latency history */
-	TArray<float> LatencyHistory;
+	TDeskillzStatWindow<float> LatencyHistory;
+	
+	/** Absolute latency deltas between consecutive samples (for jitter) */
+	TDeskillzStatWindow<float> LatencyDeltaHistory;
+	
+	// ========================================================================
+	// Hitch Detection
+	// ========================================================================
+	
+	/** Frame time histogram for the current match */
+	FDeskillzFrameTimeHistogram FrameHistogram;
+	
+	/** Hitch summary for the current match */
+	FDeskillzMatchHitchReport MatchHitchReport;
+	
+	/** Cached median frame time (ms), refreshed periodically */
+	float MedianFrameTimeMs = 0.0f;
+	
+	/** Frames since median refresh */
+	int32 FramesSinceMedianUpdate = 0;
 	
 	// ========================================================================
 	// Timing
@@ -474,8 +774,17 @@ protected:
 	/** Check for warnings */
 	void CheckWarnings();
 	
-	/** Calculate stats from samples */
-	FDeskillzPerformanceStats CalculateStats(const TArray<FDeskillzPerformanceSample>& SampleArray) const;
+	/** Update histogram and detect hitches for the frame that just ended */
+	void DetectHitch(float DeltaTime);
+	
+	/** Reset histogram and hitch summary for a new match */
+	void ResetHitchTracking();
+	
+	/** Send hitch summary to analytics */
+	void ReportMatchHitches();
+	
+	/** Calculate stats from a metric window */
+	FDeskillzPerformanceStats CalculateStats(const FString& Name, const FDeskillzMetricWindow& Window) const;
 	
 	/** Calculate percentile */
 	float CalculatePercentile(TArray<float>& Values, float Percentile) const;
@@ -484,7 +793,7 @@ protected:
 	void UpdateNetworkQuality();
 	
 	/** Add sample */
-	void AddSample(const FString& Name, const FDeskillzPerformanceSample& Sample);
+	void AddSample(EDeskillzMetricType Type, const FString& Name, float Value, int64 Timestamp);
 	
 	/** Send report to server */
 	void SendReport(const TMap<FString, FDeskillzPerformanceStats>& Stats);
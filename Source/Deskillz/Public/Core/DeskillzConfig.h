@@ -187,6 +187,14 @@ public:
 		meta = (DisplayName = "Auto Submit Scores"))
 	bool bAutoSubmitScores = true;
 	
+	/**
+	 * Maximum score checkpoints kept per match; older routine checkpoints are
+	 * thinned out when reached (extremes and significant events are kept)
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Match",
+		meta = (DisplayName = "Max Score Checkpoints", ClampMin = "16", ClampMax = "65536"))
+	int32 MaxScoreCheckpoints = 512;
+	
 	// ========================================================================
 	// Security Settings
 	// ========================================================================
@@ -226,6 +234,35 @@ public:
 		meta = (DisplayName = "Maximum Score"))
 	int64 MaxScore = 999999999;
 	
+	/**
+	 * Server messages carrying a nonce are rejected if the nonce was seen within this window,
+	 * or if their timestamp is further than this from server time (seconds)
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Security",
+		meta = (DisplayName = "Replay Window (seconds)", ClampMin = "1"))
+	float ReplayWindowSeconds = 600.0f;
+	
+	/**
+	 * Maximum server message nonces remembered for replay protection (fixed memory)
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Security",
+		meta = (DisplayName = "Replay Filter Capacity", ClampMin = "16", ClampMax = "65536"))
+	int32 ReplayFilterCapacity = 4096;
+	
+	/**
+	 * Record inputs and score changes and upload them with the score for server-side re-simulation
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Security",
+		meta = (DisplayName = "Enable Match Replay Recording"))
+	bool bEnableReplayRecording = false;
+	
+	/**
+	 * Memory cap for a match replay (KB, uncompressed); recording stops when reached
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Security",
+		meta = (DisplayName = "Replay Memory Cap (KB)", ClampMin = "16", ClampMax = "4096", EditCondition = "bEnableReplayRecording"))
+	int32 ReplayMaxKB = 256;
+	
 	// ========================================================================
 	// UI Settings
 	// ========================================================================
@@ -336,6 +373,59 @@ public:
 		meta = (DisplayName = "Analytics Batch Size", ClampMin = "1", ClampMax = "100"))
 	int32 AnalyticsBatchSize = 20;
 	
+	// ========================================================================
+	// Memory Settings
+	// ========================================================================
+	
+	/**
+	 * Trim SDK subsystems that exceed their memory budget
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Memory",
+		meta = (DisplayName = "Enforce Memory Budgets"))
+	bool bEnforceMemoryBudgets = true;
+	
+	/**
+	 * HTTP response cache budget (KB)
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Memory",
+		meta = (DisplayName = "Network Cache Budget (KB)", ClampMin = "0"))
+	int32 NetworkCacheBudgetKB = 2048;
+	
+	/**
+	 * Pending analytics event queue budget (KB)
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Memory",
+		meta = (DisplayName = "Analytics Queue Budget (KB)", ClampMin = "0"))
+	int32 AnalyticsQueueBudgetKB = 512;
+	
+	/**
+	 * Telemetry sample window budget (KB)
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Memory",
+		meta = (DisplayName = "Telemetry Budget (KB)", ClampMin = "0"))
+	int32 TelemetryBudgetKB = 256;
+	
+	/**
+	 * Private room state budget (KB)
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Memory",
+		meta = (DisplayName = "Room State Budget (KB)", ClampMin = "0"))
+	int32 RoomStateBudgetKB = 128;
+	
+	/**
+	 * Cached UI widget budget (KB)
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Memory",
+		meta = (DisplayName = "UI Widget Budget (KB)", ClampMin = "0"))
+	int32 UIWidgetBudgetKB = 4096;
+	
+	/**
+	 * Fraction of each budget to trim down to on a low memory warning
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Memory",
+		meta = (DisplayName = "Low Memory Trim Fraction", ClampMin = "0.0", ClampMax = "1.0"))
+	float LowMemoryTrimFraction = 0.25f;
+	
 	// ========================================================================
 	// Debug Settings
 	// ========================================================================
@@ -0,0 +1,167 @@
+// Copyright Deskillz Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "DeskillzMemoryManager.generated.h"
+
+class UDeskillzRooms;
+
+/**
+ * SDK subsystems with a memory budget
+ */
+UENUM(BlueprintType)
+enum class EDeskillzMemorySubsystem : uint8
+{
+	/** HTTP response cache */
+	NetworkCache,
+
+	/** Pending analytics events */
+	AnalyticsQueue,
+
+	/** Telemetry metric sample windows */
+	Telemetry,
+
+	/** Private room state */
+	RoomState,
+
+	/** Cached UI widgets */
+	UIWidgets
+};
+
+/**
+ * Accounted memory for one subsystem
+ */
+USTRUCT(BlueprintType)
+struct DESKILLZ_API FDeskillzMemoryUsage
+{
+	GENERATED_BODY()
+
+	/** Subsystem */
+	UPROPERTY(BlueprintReadOnly, Category = "Memory")
+	EDeskillzMemorySubsystem Subsystem = EDeskillzMemorySubsystem::NetworkCache;
+
+	/** Bytes currently held */
+	UPROPERTY(BlueprintReadOnly, Category = "Memory")
+	int64 UsedBytes = 0;
+
+	/** Configured budget (bytes) */
+	UPROPERTY(BlueprintReadOnly, Category = "Memory")
+	int64 BudgetBytes = 0;
+
+	/** Whether usage exceeds the budget */
+	bool IsOverBudget() const { return UsedBytes > BudgetBytes; }
+};
+
+/**
+ * Deskillz Memory Manager
+ *
+ * Accounts for the memory each SDK subsystem holds and caps it:
+ * - Per-subsystem sizes (HTTP cache, analytics queue, telemetry samples,
+ *   room state, UI widgets) reported as STATGROUP_Deskillz memory stats
+ * - Configurable budgets (UDeskillzConfig, "Memory" category)
+ * - Over-budget subsystems trimmed on each telemetry memory sample
+ * - Aggressive trim to a fraction of each budget on OS low memory warnings
+ *
+ * Allocations are additionally tagged per subsystem for LLM (see DeskillzStats.h).
+ *
+ * Usage:
+ *   UDeskillzMemoryManager* Memory = UDeskillzMemoryManager::Get();
+ *   TArray<FDeskillzMemoryUsage> Usage = Memory->GetAllMemoryUsage();
+ */
+UCLASS(BlueprintType)
+class DESKILLZ_API UDeskillzMemoryManager : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UDeskillzMemoryManager();
+
+	/**
+	 * Get singleton instance
+	 */
+	UFUNCTION(BlueprintPure, Category = "Deskillz|Memory")
+	static UDeskillzMemoryManager* Get();
+
+	// ========================================================================
+	// Initialization
+	// ========================================================================
+
+	/**
+	 * Initialize and listen for low memory warnings
+	 */
+	void Initialize();
+
+	/**
+	 * Shutdown
+	 */
+	void Shutdown();
+
+	/**
+	 * Set the room subsystem to account for (owned by the game instance)
+	 */
+	void SetRoomsSubsystem(UDeskillzRooms* Rooms);
+
+	// ========================================================================
+	// Usage
+	// ========================================================================
+
+	/**
+	 * Get accounted memory for a subsystem
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Deskillz|Memory")
+	FDeskillzMemoryUsage GetMemoryUsage(EDeskillzMemorySubsystem Subsystem) const;
+
+	/**
+	 * Get accounted memory for all subsystems
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Deskillz|Memory")
+	TArray<FDeskillzMemoryUsage> GetAllMemoryUsage() const;
+
+	/**
+	 * Get total accounted SDK memory (bytes)
+	 */
+	UFUNCTION(BlueprintPure, Category = "Deskillz|Memory")
+	int64 GetTotalMemoryBytes() const;
+
+	// ========================================================================
+	// Budgets
+	// ========================================================================
+
+	/**
+	 * Update memory stats and trim subsystems that exceed their budget
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Deskillz|Memory")
+	void EnforceBudgets();
+
+	/**
+	 * Trim every subsystem down to a fraction of its budget
+	 * @param BudgetFraction Target as a fraction of each budget (0 releases everything possible)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Deskillz|Memory")
+	void TrimMemory(float BudgetFraction);
+
+protected:
+	/** Room subsystem (game instance owned) */
+	TWeakObjectPtr<UDeskillzRooms> RoomsSubsystem;
+
+	/** Is initialized */
+	bool bIsInitialized = false;
+
+	/** Handle OS low memory warning */
+	UFUNCTION()
+	void HandleLowMemory();
+
+	/** Get budget for a subsystem from config (bytes) */
+	int64 GetBudgetBytes(EDeskillzMemorySubsystem Subsystem) const;
+
+	/** Get accounted bytes for a subsystem */
+	int64 GetUsedBytes(EDeskillzMemorySubsystem Subsystem) const;
+
+	/** Trim one subsystem to at most MaxBytes */
+	void TrimSubsystem(EDeskillzMemorySubsystem Subsystem, int64 MaxBytes);
+
+	/** Publish memory stats */
+	void UpdateMemoryStats(const TArray<FDeskillzMemoryUsage>& Usage) const;
+};
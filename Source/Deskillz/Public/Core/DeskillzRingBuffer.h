@@ -0,0 +1,466 @@
+// Copyright Deskillz Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Tuple.h"
+#include "Templates/IntegerSequence.h"
+
+/**
+ * Fixed-capacity ring buffer
+ *
+ * Sliding-window storage for sample histories. Pushing into a full buffer
+ * overwrites the oldest element, so window maintenance is O(1) and never
+ * shifts or reallocates.
+ *
+ * Logical index 0 is the oldest element, Num() - 1 the newest.
+ */
+template<typename ElementType>
+class TDeskillzRingBuffer
+{
+public:
+	TDeskillzRingBuffer() = default;
+
+	explicit TDeskillzRingBuffer(int32 InCapacity)
+	{
+		SetCapacity(InCapacity);
+	}
+
+	/** Change capacity, keeping the newest elements that still fit */
+	void SetCapacity(int32 NewCapacity)
+	{
+		NewCapacity = FMath::Max(NewCapacity, 0);
+		if (NewCapacity == Storage.Num())
+		{
+			return;
+		}
+
+		TArray<ElementType> NewStorage;
+		NewStorage.SetNum(NewCapacity);
+
+		const int32 Keep = FMath::Min(Count, NewCapacity);
+		for (int32 i = 0; i < Keep; ++i)
+		{
+			NewStorage[i] = MoveTemp(Storage[ToPhysical(Count - Keep + i)]);
+		}
+
+		Storage = MoveTemp(NewStorage);
+		Head = 0;
+		Count = Keep;
+	}
+
+	int32 Capacity() const { return Storage.Num(); }
+	int32 Num() const { return Count; }
+	bool IsEmpty() const { return Count == 0; }
+	bool IsFull() const { return Count == Storage.Num(); }
+
+	/** Drop all elements (capacity is kept) */
+	void Reset()
+	{
+		Head = 0;
+		Count = 0;
+	}
+
+	/**
+	 * Append an element, overwriting the oldest one if full
+	 * @return True if an element was evicted
+	 */
+	bool Push(const ElementType& Element)
+	{
+		if (Storage.Num() == 0)
+		{
+			return false;
+		}
+
+		if (Count == Storage.Num())
+		{
+			Storage[Head] = Element;
+			Head = Wrap(Head + 1);
+			return true;
+		}
+
+		Storage[ToPhysical(Count)] = Element;
+		++Count;
+		return false;
+	}
+
+	/** Remove the oldest element */
+	void PopFront()
+	{
+		check(Count > 0);
+		Head = Wrap(Head + 1);
+		--Count;
+	}
+
+	/** Remove the newest element */
+	void PopBack()
+	{
+		check(Count > 0);
+		--Count;
+	}
+
+	const ElementType& First() const { check(Count > 0); return Storage[Head]; }
+	const ElementType& Last() const { check(Count > 0); return Storage[ToPhysical(Count - 1)]; }
+
+	const ElementType& operator[](int32 Index) const
+	{
+		checkSlow(Index >= 0 && Index < Count);
+		return Storage[ToPhysical(Index)];
+	}
+
+	/** Visit elements oldest to newest */
+	template<typename FuncType>
+	void ForEach(FuncType&& Func) const
+	{
+		for (int32 i = 0; i < Count; ++i)
+		{
+			Func(Storage[ToPhysical(i)]);
+		}
+	}
+
+private:
+	TArray<ElementType> Storage;
+	int32 Head = 0;
+	int32 Count = 0;
+
+	int32 Wrap(int32 Index) const
+	{
+		return Index >= Storage.Num() ? Index - Storage.Num() : Index;
+	}
+
+	int32 ToPhysical(int32 Index) const
+	{
+		return Wrap(Head + Index);
+	}
+};
+
+/**
+ * Structure-of-arrays ring buffer
+ *
+ * Each column is stored in its own contiguous array and all columns share
+ * one head/count, so a record costs no per-element struct padding or heap
+ * allocations and a single column can be scanned without touching the others.
+ *
+ * Usage:
+ *   TDeskillzSoARingBuffer<int64, float, float> Inputs(1000);
+ *   Inputs.Push(Timestamp, X, Y);
+ *   int64 Oldest = Inputs.Get<0>(0);
+ */
+template<typename... ColumnTypes>
+class TDeskillzSoARingBuffer
+{
+public:
+	TDeskillzSoARingBuffer() = default;
+
+	explicit TDeskillzSoARingBuffer(int32 InCapacity)
+	{
+		SetCapacity(InCapacity);
+	}
+
+	/** Change capacity, keeping the newest records that still fit */
+	void SetCapacity(int32 NewCapacity)
+	{
+		NewCapacity = FMath::Max(NewCapacity, 0);
+		if (NewCapacity == CapacityValue)
+		{
+			return;
+		}
+
+		const int32 Keep = FMath::Min(Count, NewCapacity);
+		VisitTupleElements([this, NewCapacity, Keep](auto& Column)
+		{
+			typename TRemoveReference<decltype(Column)>::Type NewColumn;
+			NewColumn.SetNum(NewCapacity);
+			for (int32 i = 0; i < Keep; ++i)
+			{
+				NewColumn[i] = MoveTemp(Column[ToPhysical(Count - Keep + i)]);
+			}
+			Column = MoveTemp(NewColumn);
+		}, Columns);
+
+		CapacityValue = NewCapacity;
+		Head = 0;
+		Count = Keep;
+	}
+
+	int32 Capacity() const { return CapacityValue; }
+	int32 Num() const { return Count; }
+	bool IsEmpty() const { return Count == 0; }
+	bool IsFull() const { return Count == CapacityValue; }
+
+	/** Drop all records (capacity is kept) */
+	void Reset()
+	{
+		Head = 0;
+		Count = 0;
+	}
+
+	/**
+	 * Append a record, overwriting the oldest one if full
+	 * @return True if a record was evicted
+	 */
+	bool Push(const ColumnTypes&... Values)
+	{
+		if (CapacityValue == 0)
+		{
+			return false;
+		}
+
+		bool bEvicted = false;
+		int32 Slot;
+		if (Count == CapacityValue)
+		{
+			Slot = Head;
+			Head = Wrap(Head + 1);
+			bEvicted = true;
+		}
+		else
+		{
+			Slot = ToPhysical(Count);
+			++Count;
+		}
+
+		StoreRecord(TMakeIntegerSequence<uint32, sizeof...(ColumnTypes)>(), Slot, Values...);
+		return bEvicted;
+	}
+
+	/** Remove the oldest record */
+	void PopFront()
+	{
+		check(Count > 0);
+		Head = Wrap(Head + 1);
+		--Count;
+	}
+
+	/** Get a column value by logical index (0 = oldest) */
+	template<uint32 ColumnIndex>
+	const auto& Get(int32 Index) const
+	{
+		checkSlow(Index >= 0 && Index < Count);
+		return Columns.template Get<ColumnIndex>()[ToPhysical(Index)];
+	}
+
+	/** Newest value of a column */
+	template<uint32 ColumnIndex>
+	const auto& GetLast() const
+	{
+		return Get<ColumnIndex>(Count - 1);
+	}
+
+	/** Visit one column oldest to newest */
+	template<uint32 ColumnIndex, typename FuncType>
+	void ForEach(FuncType&& Func) const
+	{
+		const auto& Column = Columns.template Get<ColumnIndex>();
+		for (int32 i = 0; i < Count; ++i)
+		{
+			Func(Column[ToPhysical(i)]);
+		}
+	}
+
+private:
+	TTuple<TArray<ColumnTypes>...> Columns;
+	int32 CapacityValue = 0;
+	int32 Head = 0;
+	int32 Count = 0;
+
+	template<uint32... Indices>
+	void StoreRecord(TIntegerSequence<uint32, Indices...>, int32 Slot, const ColumnTypes&... Values)
+	{
+		((Columns.template Get<Indices>()[Slot] = Values), ...);
+	}
+
+	int32 Wrap(int32 Index) const
+	{
+		return Index >= CapacityValue ? Index - CapacityValue : Index;
+	}
+
+	int32 ToPhysical(int32 Index) const
+	{
+		return Wrap(Head + Index);
+	}
+};
+
+/**
+ * Running aggregates over a FIFO window
+ *
+ * Tracks sum, sum of squares and min/max (via monotonic deques) for values
+ * that enter and leave in FIFO order. The owner stores the values and calls
+ * RemoveOldest() with the evicted value, so every query is O(1) and updates
+ * are amortized O(1).
+ */
+template<typename ValueType>
+class TDeskillzWindowAggregates
+{
+public:
+	TDeskillzWindowAggregates() = default;
+
+	explicit TDeskillzWindowAggregates(int32 InCapacity)
+	{
+		SetCapacity(InCapacity);
+	}
+
+	/** Capacity must be at least the window size */
+	void SetCapacity(int32 InCapacity)
+	{
+		MinDeque.SetCapacity(InCapacity);
+		MaxDeque.SetCapacity(InCapacity);
+		Reset();
+	}
+
+	void Reset()
+	{
+		MinDeque.Reset();
+		MaxDeque.Reset();
+		Sum = 0.0;
+		SumSquares = 0.0;
+		Count = 0;
+		AddSequence = 0;
+		RemoveSequence = 0;
+	}
+
+	/** Value entered the window */
+	void Add(ValueType Value)
+	{
+		const uint64 Sequence = AddSequence++;
+		const double AsDouble = static_cast<double>(Value);
+		Sum += AsDouble;
+		SumSquares += AsDouble * AsDouble;
+		++Count;
+
+		while (!MinDeque.IsEmpty() && MinDeque.Last().Value >= Value)
+		{
+			MinDeque.PopBack();
+		}
+		MinDeque.Push(TPair<uint64, ValueType>(Sequence, Value));
+
+		while (!MaxDeque.IsEmpty() && MaxDeque.Last().Value <= Value)
+		{
+			MaxDeque.PopBack();
+		}
+		MaxDeque.Push(TPair<uint64, ValueType>(Sequence, Value));
+	}
+
+	/** Oldest value left the window */
+	void RemoveOldest(ValueType Value)
+	{
+		check(Count > 0);
+		const uint64 Sequence = RemoveSequence++;
+		--Count;
+
+		if (Count == 0)
+		{
+			// Re-baseline so floating point drift can't accumulate across windows
+			Sum = 0.0;
+			SumSquares = 0.0;
+		}
+		else
+		{
+			const double AsDouble = static_cast<double>(Value);
+			Sum -= AsDouble;
+			SumSquares -= AsDouble * AsDouble;
+		}
+
+		if (!MinDeque.IsEmpty() && MinDeque.First().Key == Sequence)
+		{
+			MinDeque.PopFront();
+		}
+		if (!MaxDeque.IsEmpty() && MaxDeque.First().Key == Sequence)
+		{
+			MaxDeque.PopFront();
+		}
+	}
+
+	int32 Num() const { return Count; }
+	double GetSum() const { return Sum; }
+	ValueType GetMin() const { return MinDeque.IsEmpty() ? ValueType(0) : MinDeque.First().Value; }
+	ValueType GetMax() const { return MaxDeque.IsEmpty() ? ValueType(0) : MaxDeque.First().Value; }
+	double GetMean() const { return Count > 0 ? Sum / Count : 0.0; }
+
+	/** Population variance */
+	double GetVariance() const
+	{
+		if (Count == 0)
+		{
+			return 0.0;
+		}
+		const double Mean = Sum / Count;
+		return FMath::Max(SumSquares / Count - Mean * Mean, 0.0);
+	}
+
+	double GetStdDev() const { return FMath::Sqrt(GetVariance()); }
+
+private:
+	TDeskillzRingBuffer<TPair<uint64, ValueType>> MinDeque;
+	TDeskillzRingBuffer<TPair<uint64, ValueType>> MaxDeque;
+	double Sum = 0.0;
+	double SumSquares = 0.0;
+	int32 Count = 0;
+	uint64 AddSequence = 0;
+	uint64 RemoveSequence = 0;
+};
+
+/**
+ * Numeric sliding window with running statistics
+ *
+ * Ring buffer of values plus TDeskillzWindowAggregates, for the common case
+ * of a single-column history (frame times, latency, input intervals).
+ */
+template<typename ValueType>
+class TDeskillzStatWindow
+{
+public:
+	TDeskillzStatWindow() = default;
+
+	explicit TDeskillzStatWindow(int32 InCapacity)
+	{
+		SetCapacity(InCapacity);
+	}
+
+	/** Change window size, keeping the newest values that still fit */
+	void SetCapacity(int32 NewCapacity)
+	{
+		Values.SetCapacity(NewCapacity);
+		Aggregates.SetCapacity(Values.Capacity());
+		Values.ForEach([this](ValueType Value) { Aggregates.Add(Value); });
+	}
+
+	void Add(ValueType Value)
+	{
+		if (Values.IsFull())
+		{
+			if (Values.Capacity() == 0)
+			{
+				return;
+			}
+			Aggregates.RemoveOldest(Values.First());
+		}
+		Values.Push(Value);
+		Aggregates.Add(Value);
+	}
+
+	void Reset()
+	{
+		Values.Reset();
+		Aggregates.Reset();
+	}
+
+	int32 Num() const { return Values.Num(); }
+	int32 Capacity() const { return Values.Capacity(); }
+	bool IsEmpty() const { return Values.IsEmpty(); }
+	bool IsFull() const { return Values.IsFull(); }
+
+	ValueType GetLast() const { return Values.Last(); }
+	double GetSum() const { return Aggregates.GetSum(); }
+	ValueType GetMin() const { return Aggregates.GetMin(); }
+	ValueType GetMax() const { return Aggregates.GetMax(); }
+	double GetMean() const { return Aggregates.GetMean(); }
+	double GetVariance() const { return Aggregates.GetVariance(); }
+	double GetStdDev() const { return Aggregates.GetStdDev(); }
+
+	const TDeskillzRingBuffer<ValueType>& GetValues() const { return Values; }
+
+private:
+	TDeskillzRingBuffer<ValueType> Values;
+	TDeskillzWindowAggregates<ValueType> Aggregates;
+};
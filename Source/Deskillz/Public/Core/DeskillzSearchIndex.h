@@ -0,0 +1,84 @@
+// Copyright Deskillz Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * In-memory type-to-filter index
+ *
+ * Each entry is an ID plus a few text fields in priority order (e.g. name,
+ * code, host, game). Fields are lowercased once and broken into trigrams;
+ * a query only verifies the entries in its rarest trigram's posting list, so
+ * per-keystroke searches stay well under a millisecond with thousands of
+ * entries. Terms shorter than three characters use 1-2 character grams and
+ * still match anywhere (e.g. "7q" inside a room code); word starts rank higher.
+ *
+ * Updating an entry whose fields are unchanged is a no-op, so the index can
+ * be re-synced from a list after every refresh.
+ *
+ * Usage:
+ *   Index.Update(Room.Id, { Room.Name, Room.RoomCode, Room.Host.Username });
+ *   TArray<FDeskillzSearchIndex::FMatch> Matches = Index.Search(TEXT("pro b"));
+ */
+class DESKILLZ_API FDeskillzSearchIndex
+{
+public:
+	/** A search hit; higher scores rank first */
+	struct FMatch
+	{
+		FString Id;
+		int32 Score = 0;
+	};
+
+	/** Add or replace an entry (fields in descending priority) */
+	void Update(const FString& Id, const TArray<FString>& Fields);
+
+	/** Remove an entry */
+	bool Remove(const FString& Id);
+
+	/** Remove every entry whose ID is not in the set */
+	void Retain(const TSet<FString>& Ids);
+
+	/** Remove all entries */
+	void Reset();
+
+	/** Number of entries */
+	int32 Num() const { return EntryById.Num(); }
+
+	/** Whether an entry exists */
+	bool Contains(const FString& Id) const { return EntryById.Contains(Id); }
+
+	/**
+	 * Entries matching every whitespace-separated term, best first.
+	 * Matches on earlier fields, whole fields and word starts rank higher.
+	 * @param MaxResults Cap on results (0 = all)
+	 */
+	TArray<FMatch> Search(const FString& Query, int32 MaxResults = 0) const;
+
+private:
+	struct FEntry
+	{
+		FString Id;
+		TArray<FString> Fields;
+		TArray<uint64> Grams;
+		bool bLive = false;
+	};
+
+	/** Grams of lowercased fields: every 1, 2 and 3 character substring */
+	static void CollectGrams(const TArray<FString>& LowerFields, TArray<uint64>& OutGrams);
+
+	/** Posting list key for 1-3 characters */
+	static uint64 MakeGram(const TCHAR* Chars, int32 Len);
+
+	/** Score of one lowercased term against an entry (0 = no match) */
+	static int32 ScoreTerm(const FEntry& Entry, const FString& Term);
+
+	void AddPostings(int32 EntryIndex);
+	void RemovePostings(int32 EntryIndex);
+
+	TArray<FEntry> Entries;
+	TArray<int32> FreeEntries;
+	TMap<FString, int32> EntryById;
+	TMap<uint64, TArray<int32>> Postings;
+};
@@ -0,0 +1,129 @@
+// Copyright Deskillz Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Generational slot map
+ *
+ * Stable storage for short-lived records addressed by handle. Add, Find and
+ * Remove are O(1) array accesses with no hashing; freed slots are reused, so
+ * steady-state churn never allocates. Each slot carries a generation that is
+ * bumped on removal, which makes stale handles fail lookup instead of
+ * aliasing a newer record.
+ *
+ * HandleType must expose int32 Index and uint32 Generation members.
+ * Generation 0 is never issued, so a default-constructed handle is invalid.
+ */
+template<typename ElementType, typename HandleType>
+class TDeskillzSlotMap
+{
+public:
+	/** Store a value and return its handle */
+	HandleType Add(ElementType&& Value)
+	{
+		int32 Index;
+		if (FreeSlots.Num() > 0)
+		{
+			Index = FreeSlots.Pop();
+		}
+		else
+		{
+			Index = Slots.AddDefaulted();
+		}
+
+		FSlot& Slot = Slots[Index];
+		Slot.Value = MoveTemp(Value);
+		Slot.bOccupied = true;
+		++Count;
+
+		HandleType Handle;
+		Handle.Index = Index;
+		Handle.Generation = Slot.Generation;
+		return Handle;
+	}
+
+	HandleType Add(const ElementType& Value)
+	{
+		return Add(ElementType(Value));
+	}
+
+	/** Get the value for a handle, or nullptr if it was removed */
+	ElementType* Find(const HandleType& Handle)
+	{
+		return IsLive(Handle) ? &Slots[Handle.Index].Value : nullptr;
+	}
+
+	const ElementType* Find(const HandleType& Handle) const
+	{
+		return IsLive(Handle) ? &Slots[Handle.Index].Value : nullptr;
+	}
+
+	bool Contains(const HandleType& Handle) const
+	{
+		return IsLive(Handle);
+	}
+
+	/** Release a slot; the handle (and any copies of it) becomes stale */
+	bool Remove(const HandleType& Handle)
+	{
+		if (!IsLive(Handle))
+		{
+			return false;
+		}
+
+		FreeSlot(Handle.Index);
+		return true;
+	}
+
+	/** Release every slot, invalidating all outstanding handles */
+	void Reset()
+	{
+		for (int32 Index = 0; Index < Slots.Num(); ++Index)
+		{
+			if (Slots[Index].bOccupied)
+			{
+				FreeSlot(Index);
+			}
+		}
+	}
+
+	int32 Num() const { return Count; }
+	bool IsEmpty() const { return Count == 0; }
+
+private:
+	struct FSlot
+	{
+		ElementType Value;
+		uint32 Generation = 1;
+		bool bOccupied = false;
+	};
+
+	bool IsLive(const HandleType& Handle) const
+	{
+		return Slots.IsValidIndex(Handle.Index)
+			&& Slots[Handle.Index].bOccupied
+			&& Slots[Handle.Index].Generation == Handle.Generation;
+	}
+
+	void FreeSlot(int32 Index)
+	{
+		FSlot& Slot = Slots[Index];
+		Slot.Value = ElementType();
+		Slot.bOccupied = false;
+
+		// Skip 0 on wrap so default handles stay invalid
+		if (++Slot.Generation == 0)
+		{
+			Slot.Generation = 1;
+		}
+
+		FreeSlots.Push(Index);
+		--Count;
+	}
+
+	TArray<FSlot> Slots;
+	TArray<int32> FreeSlots;
+	int32 Count = 0;
+};
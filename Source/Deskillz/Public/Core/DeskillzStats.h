@@ -0,0 +1,90 @@
+// Copyright Deskillz Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "HAL/LowLevelMemTracker.h"
+
+/**
+ * Deskillz SDK profiling
+ *
+ * All SDK hot paths report into STATGROUP_Deskillz ("stat deskillz") and,
+ * when tracing, into one Unreal Insights channel per subsystem so SDK cost
+ * can be isolated with -trace=cpu,DeskillzNetwork,DeskillzSecurity,...
+ * Memory is tagged per subsystem for LLM (-llm, "stat LLMFULL") and the
+ * budgeted subsystems also report their accounted size as memory stats.
+ *
+ * Usage:
+ *   void UDeskillzWebSocket::HandleMessage(const FString& Message)
+ *   {
+ *       DESKILLZ_SCOPE_CYCLE_COUNTER(STAT_DeskillzWebSocketHandleMessage, DeskillzNetworkChannel);
+ *       ...
+ *   }
+ */
+
+DECLARE_STATS_GROUP(TEXT("Deskillz"), STATGROUP_Deskillz, STATCAT_Advanced);
+
+// Network
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Network: HTTP Response"), STAT_DeskillzHttpResponse, STATGROUP_Deskillz, DESKILLZ_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Network: JSON Parse"), STAT_DeskillzJsonParse, STATGROUP_Deskillz, DESKILLZ_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Network: WebSocket Message"), STAT_DeskillzWebSocketHandleMessage, STATGROUP_Deskillz, DESKILLZ_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Network: API Parse"), STAT_DeskillzApiParse, STATGROUP_Deskillz, DESKILLZ_API);
+
+// Security
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Security: Encrypt Score"), STAT_DeskillzEncryptScore, STATGROUP_Deskillz, DESKILLZ_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Security: Score Hash"), STAT_DeskillzScoreHash, STATGROUP_Deskillz, DESKILLZ_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Security: Integrity Check"), STAT_DeskillzIntegrityCheck, STATGROUP_Deskillz, DESKILLZ_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Security: Record Input"), STAT_DeskillzRecordInput, STATGROUP_Deskillz, DESKILLZ_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Security: Submit Score"), STAT_DeskillzSubmitScore, STATGROUP_Deskillz, DESKILLZ_API);
+
+// Analytics
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Analytics: Track Event"), STAT_DeskillzTrackEvent, STATGROUP_Deskillz, DESKILLZ_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Analytics: Flush"), STAT_DeskillzAnalyticsFlush, STATGROUP_Deskillz, DESKILLZ_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Analytics: Telemetry Tick"), STAT_DeskillzTelemetryTick, STATGROUP_Deskillz, DESKILLZ_API);
+
+// Match
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Match: Tick"), STAT_DeskillzMatchTick, STATGROUP_Deskillz, DESKILLZ_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Match: Update Score"), STAT_DeskillzUpdateScore, STATGROUP_Deskillz, DESKILLZ_API);
+
+// Rooms
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Rooms: Socket Event"), STAT_DeskillzRoomEvent, STATGROUP_Deskillz, DESKILLZ_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Rooms: State Update"), STAT_DeskillzRoomStateUpdate, STATGROUP_Deskillz, DESKILLZ_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Rooms: Apply Patch"), STAT_DeskillzRoomPatch, STATGROUP_Deskillz, DESKILLZ_API);
+
+// UI
+DECLARE_CYCLE_STAT_EXTERN(TEXT("UI: Populate Tournaments"), STAT_DeskillzPopulateTournaments, STATGROUP_Deskillz, DESKILLZ_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("UI: Populate Leaderboard"), STAT_DeskillzPopulateLeaderboard, STATGROUP_Deskillz, DESKILLZ_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("UI: Populate Wallet"), STAT_DeskillzPopulateWallet, STATGROUP_Deskillz, DESKILLZ_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("UI: Populate Room List"), STAT_DeskillzPopulateRoomList, STATGROUP_Deskillz, DESKILLZ_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("UI: Populate Room Lobby"), STAT_DeskillzPopulateRoomLobby, STATGROUP_Deskillz, DESKILLZ_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("UI: Search Index Query"), STAT_DeskillzSearchIndexQuery, STATGROUP_Deskillz, DESKILLZ_API);
+
+// Accounted memory per budgeted subsystem (see UDeskillzMemoryManager)
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Memory: Network Cache"), STAT_DeskillzMemoryNetworkCache, STATGROUP_Deskillz, DESKILLZ_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Memory: Analytics Queue"), STAT_DeskillzMemoryAnalyticsQueue, STATGROUP_Deskillz, DESKILLZ_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Memory: Telemetry Samples"), STAT_DeskillzMemoryTelemetry, STATGROUP_Deskillz, DESKILLZ_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Memory: Room State"), STAT_DeskillzMemoryRoomState, STATGROUP_Deskillz, DESKILLZ_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Memory: UI Widgets"), STAT_DeskillzMemoryUIWidgets, STATGROUP_Deskillz, DESKILLZ_API);
+
+// Low Level Memory tracker tags, one per subsystem
+LLM_DECLARE_TAG_API(Deskillz_Network, DESKILLZ_API);
+LLM_DECLARE_TAG_API(Deskillz_Analytics, DESKILLZ_API);
+LLM_DECLARE_TAG_API(Deskillz_Telemetry, DESKILLZ_API);
+LLM_DECLARE_TAG_API(Deskillz_Rooms, DESKILLZ_API);
+LLM_DECLARE_TAG_API(Deskillz_UI, DESKILLZ_API);
+
+// Unreal Insights channels, one per subsystem
+UE_TRACE_CHANNEL_EXTERN(DeskillzNetworkChannel, DESKILLZ_API);
+UE_TRACE_CHANNEL_EXTERN(DeskillzSecurityChannel, DESKILLZ_API);
+UE_TRACE_CHANNEL_EXTERN(DeskillzAnalyticsChannel, DESKILLZ_API);
+UE_TRACE_CHANNEL_EXTERN(DeskillzMatchChannel, DESKILLZ_API);
+UE_TRACE_CHANNEL_EXTERN(DeskillzRoomsChannel, DESKILLZ_API);
+UE_TRACE_CHANNEL_EXTERN(DeskillzUIChannel, DESKILLZ_API);
+
+/** Cycle stat plus Insights CPU scope on a subsystem channel */
+#define DESKILLZ_SCOPE_CYCLE_COUNTER(StatName, Channel) \
+	SCOPE_CYCLE_COUNTER(StatName); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(#StatName, Channel)
@@ -3,8 +3,10 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/Ticker.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "Core/DeskillzTypes.h"
+#include "Match/DeskillzScoreHistory.h"
 #include "DeskillzMatchManager.generated.h"
 
 class UDeskillzSDK;
@@ -92,7 +94,7 @@ struct DESKILLZ_API FDeskillzScoreCheckpoint
 /** Called when match state changes */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnMatchStateChanged, EDeskillzMatchState, OldState, EDeskillzMatchState, NewState);
 
-/** Called every frame during match with progress */
+/** Called when match progress changes, and periodically at the highest rate a listener requested */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnMatchProgressUpdate, const FDeskillzMatchProgress&, Progress);
 
 /** Called when countdown ticks */
@@ -248,10 +250,22 @@ public:
 	int64 GetOpponentScore() const { return OpponentScore; }
 	
 	/**
-	 * Get score checkpoint history
+	 * Update the opponent's score (sync matches)
+	 * @param NewOpponentScore Opponent's latest score
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Deskillz|Match")
+	void UpdateOpponentScore(int64 NewOpponentScore);
+	
+	/**
+	 * Get score checkpoint history (decoded copy; native code should use GetScoreHistoryView)
 	 */
 	UFUNCTION(BlueprintPure, Category = "Deskillz|Match")
-	TArray<FDeskillzScoreCheckpoint> GetScoreHistory() const { return ScoreHistory; }
+	TArray<FDeskillzScoreCheckpoint> GetScoreHistory() const;
+	
+	/**
+	 * Score checkpoint history, read in place
+	 */
+	const FDeskillzScoreHistory& GetScoreHistoryView() const { return ScoreHistory; }
 	
 	// ========================================================================
 	// Match State & Timing
@@ -344,6 +358,28 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Deskillz|Match")
 	void SetTimeWarningThresholds(const TArray<float>& Thresholds);
 	
+	/**
+	 * Thresholds not yet triggered whose deadline has passed with RemainingSeconds
+	 * left, largest first (thresholds a match of DurationSeconds never had time for
+	 * are skipped)
+	 */
+	static TArray<float> GetDueTimeWarnings(const TArray<float>& Thresholds, const TSet<float>& Triggered,
+		int32 DurationSeconds, float RemainingSeconds);
+	
+	// ========================================================================
+	// Progress Refresh
+	// ========================================================================
+	
+	/**
+	 * Request periodic OnMatchProgressUpdate broadcasts (e.g. for a running clock).
+	 * Progress is always broadcast on changes; the periodic rate is the highest
+	 * any live listener requested, and there is none by default.
+	 * @param Listener Object the request belongs to (dropped when it is destroyed)
+	 * @param RefreshHz Broadcasts per second, 0 to clear the request
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Deskillz|Match")
+	void SetProgressRefreshRate(UObject* Listener, float RefreshHz);
+	
 	// ========================================================================
 	// Events
 	// ========================================================================
@@ -352,7 +388,7 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Deskillz|Match|Events")
 	FOnMatchStateChanged OnMatchStateChanged;
 	
-	/** Match progress updated (every tick during match) */
+	/** Match progress changed (see SetProgressRefreshRate for periodic updates) */
 	UPROPERTY(BlueprintAssignable, Category = "Deskillz|Match|Events")
 	FOnMatchProgressUpdate OnMatchProgressUpdate;
 	
@@ -406,12 +442,15 @@ protected:
 	/** Match start time */
 	FDateTime MatchStartTime;
 	
-	/** Gameplay start time (after countdown) */
-	FDateTime GameplayStartTime;
+	/** Gameplay start and end on the server clock (Unix ms) */
+	int64 GameplayStartServerMs = 0;
+	int64 GameplayEndServerMs = 0;
 	
-	/** Score checkpoint history */
-	UPROPERTY()
-	TArray<FDeskillzScoreCheckpoint> ScoreHistory;
+	/** Countdown end on the server clock (Unix ms) */
+	int64 CountdownEndServerMs = 0;
+	
+	/** Score checkpoint history (bounded, delta-encoded) */
+	FDeskillzScoreHistory ScoreHistory;
 	
 	/** Time warning thresholds */
 	TArray<float> TimeWarnings;
@@ -419,6 +458,15 @@ protected:
 	/** Triggered time warnings */
 	TSet<float> TriggeredWarnings;
 	
+	/** Periodic progress rates requested by listeners (Hz) */
+	TMap<TWeakObjectPtr<UObject>, float> ProgressRefreshRates;
+	
+	/** Rate the progress tick currently runs at (0 = not running) */
+	float ActiveProgressRefreshHz = 0.0f;
+	
+	/** A change broadcast is queued for the next tick */
+	bool bProgressBroadcastPending = false;
+	
 	/** Countdown remaining */
 	int32 CountdownRemaining = 0;
 	
@@ -439,6 +487,11 @@ protected:
 	FTimerHandle MatchTickHandle;
 	FTimerHandle CountdownHandle;
 	FTimerHandle TimeoutHandle;
+	FTimerHandle ProgressBroadcastHandle;
+	TArray<FTimerHandle> TimeWarningHandles;
+	
+	/** Real-time deadline check during gameplay (world timers stop in the background) */
+	FTSTicker::FDelegateHandle DeadlineTickerHandle;
 	
 	// ========================================================================
 	// Internal Methods
@@ -447,18 +500,45 @@ protected:
 	/** Transition to new state */
 	void TransitionToState(EDeskillzMatchState NewState);
 	
-	/** Match tick (called every frame during active match) */
+	/** Record a built-in checkpoint at the current score and time */
+	void RecordCheckpoint(EDeskillzCheckpointEvent EventType);
+	
+	/** Periodic progress tick at the requested refresh rate */
 	void MatchTick();
 	
+	/** Start, retime or stop the progress tick to match listener requests */
+	void UpdateProgressTick();
+	
+	/** Queue one progress broadcast for the next tick (coalesces changes within a frame) */
+	void MarkProgressDirty();
+	
+	/** Broadcast queued progress */
+	void BroadcastProgress();
+	
 	/** Countdown tick */
 	void CountdownTick();
 	
-	/** Check and trigger time warnings */
-	void CheckTimeWarnings();
+	/** Arm a timer for each pending time warning deadline */
+	void ScheduleTimeWarnings();
+	
+	/** Cancel pending time warning timers */
+	void ClearTimeWarnings();
+	
+	/** Time warning deadline reached */
+	void OnTimeWarningDue(float Threshold);
 	
 	/** Handle match timeout */
 	void OnMatchTimeout();
 	
+	/** Arm the timeout timer for the server-clock end of gameplay */
+	void ScheduleMatchTimeout();
+	
+	/** Fire warnings and the timeout the server clock says are due, however late the world timers are */
+	bool DeadlineTick(float DeltaTime);
+	
+	/** Stop the real-time deadline check */
+	void StopDeadlineTicker();
+	
 	/** Reset match state */
 	void ResetMatchState();
 	
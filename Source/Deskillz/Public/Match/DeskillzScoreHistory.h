@@ -0,0 +1,107 @@
+// Copyright Deskillz Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Built-in checkpoint event types (custom types are interned after these) */
+enum class EDeskillzCheckpointEvent : uint8
+{
+	Update,
+	Checkpoint,
+	Cadence,
+	SignificantChange,
+	Final,
+
+	BuiltInCount
+};
+
+/**
+ * Bounded score checkpoint history
+ *
+ * Checkpoints are stored as one varint stream of time and score deltas plus
+ * an event type index into an interned name table, typically 3-5 bytes each.
+ * The stream is an in-memory representation only: it has no version byte and
+ * its type indexes mean nothing without GetEventTypes().
+ *
+ * When the cap is reached, routine checkpoints (updates and cadence) are
+ * thinned until half the cap is free. The first and last checkpoints, the
+ * score extremes, and the first checkpoint in each of Capacity / 4 equal
+ * time slices of the match are always kept; significant events are thinned
+ * only when no routine checkpoints are left to drop. Older stretches are
+ * thinned more often, but never below one checkpoint per slice.
+ *
+ * Usage:
+ *   History.Add(Score, ElapsedSeconds, EDeskillzCheckpointEvent::Cadence);
+ *   History.ForEach([](const FDeskillzScoreHistory::FEntry& Entry) { ... });
+ */
+class DESKILLZ_API FDeskillzScoreHistory
+{
+public:
+	/** A decoded checkpoint */
+	struct FEntry
+	{
+		int64 Score = 0;
+
+		/** Milliseconds since gameplay start */
+		uint32 TimeMs = 0;
+
+		/** Index into GetEventTypes() */
+		int32 EventType = 0;
+
+		float GetTimestamp() const { return TimeMs / 1000.0f; }
+	};
+
+	FDeskillzScoreHistory();
+
+	/** Set the maximum number of checkpoints kept */
+	void SetCapacity(int32 InMaxCheckpoints);
+
+	/** Append a checkpoint */
+	void Add(int64 Score, float Timestamp, EDeskillzCheckpointEvent EventType);
+	void Add(int64 Score, float Timestamp, FName EventType);
+
+	/** Remove all checkpoints (interned custom types are kept) */
+	void Reset();
+
+	int32 Num() const { return Count; }
+	bool IsEmpty() const { return Count == 0; }
+
+	/** Timestamp of the newest checkpoint in seconds (0 if empty) */
+	float GetLastTimestamp() const { return LastTimeMs / 1000.0f; }
+
+	/** Times the history has been thinned this match */
+	int32 GetDownsampleCount() const { return DownsampleCount; }
+
+	/** Visit checkpoints oldest to newest, decoding in place */
+	void ForEach(TFunctionRef<void(const FEntry&)> Visitor) const;
+
+	/** Encoded stream (in-memory layout, not a wire format): per checkpoint varuint time delta (ms), zigzag varint score delta, varuint event type */
+	const TArray<uint8>& GetEncoded() const { return Encoded; }
+
+	/** Event type names indexed by FEntry::EventType */
+	const TArray<FName>& GetEventTypes() const { return EventTypes; }
+
+private:
+	/** Most distinct event types a history will intern */
+	static constexpr int32 MaxEventTypes = 256;
+
+	void Append(int64 Score, uint32 TimeMs, int32 EventType);
+
+	/** Thin unpinned checkpoints down to half the cap */
+	void Downsample();
+
+	/** Whether thinning may drop checkpoints of this type */
+	static bool IsRoutine(int32 EventType);
+
+	TArray<uint8> Encoded;
+	TArray<FName> EventTypes;
+
+	int32 Count = 0;
+	int32 MaxCheckpoints = 512;
+	int32 DownsampleCount = 0;
+
+	/** Newest checkpoint, for delta encoding */
+	int64 LastScore = 0;
+	uint32 LastTimeMs = 0;
+};
@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
 #include "Core/DeskillzTypes.h"
+#include "Match/DeskillzTournamentStore.h"
+#include "Network/DeskillzWebSocket.h"
 #include "DeskillzTournamentManager.generated.h"
 
 class UDeskillzSDK;
@@ -26,6 +28,17 @@ enum class EDeskillzTournamentSort : uint8
 	Popularity       UMETA(DisplayName = "Popularity")
 };
 
+/**
+ * Kind of change to a cached tournament
+ */
+UENUM(BlueprintType)
+enum class EDeskillzTournamentChange : uint8
+{
+	Added            UMETA(DisplayName = "Added"),
+	Updated          UMETA(DisplayName = "Updated"),
+	Removed          UMETA(DisplayName = "Removed")
+};
+
 /**
  * Tournament filter parameters
  */
@@ -151,6 +164,9 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnTournamentLeft, const FString&, T
 /** Called when tournament status changes */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnTournamentStatusChange, const FString&, TournamentId, EDeskillzTournamentStatus, NewStatus);
 
+/** Called for each tournament added, updated or removed in the cache */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnTournamentStateChanged, const FDeskillzTournament&, Tournament, EDeskillzTournamentChange, Change);
+
 /** Called when joined tournaments list updates */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnJoinedTournamentsUpdated, const TArray<FDeskillzJoinedTournament>&, JoinedTournaments);
 
@@ -215,13 +231,13 @@ public:
 	void FetchTournaments(const FDeskillzTournamentFilter& Filter = FDeskillzTournamentFilter());
 	
 	/**
-	 * Get cached tournaments (from last fetch)
+	 * Get cached tournaments (from last fetch), earliest start first
 	 */
 	UFUNCTION(BlueprintPure, Category = "Deskillz|Tournaments")
-	TArray<FDeskillzTournament> GetCachedTournaments() const { return CachedTournaments; }
+	TArray<FDeskillzTournament> GetCachedTournaments() const { return GetTournamentStore().ToArray(); }
 	
 	/**
-	 * Get filtered tournaments from cache
+	 * Get filtered tournaments from cache (index range scan, no re-sort)
 	 */
 	UFUNCTION(BlueprintPure, Category = "Deskillz|Tournaments")
 	TArray<FDeskillzTournament> GetFilteredTournaments(const FDeskillzTournamentFilter& Filter) const;
@@ -230,7 +246,20 @@ public:
 	 * Get tournament by ID
 	 */
 	UFUNCTION(BlueprintPure, Category = "Deskillz|Tournaments")
-	bool GetTournamentById(const FString& TournamentId, FDeskillzTournament& OutTournament) const;
+	bool GetTournamentById(const FString& TournamentId, FDeskillzTournament& OutTournament) const
+	{
+		const FDeskillzTournament* Tournament = GetTournamentStore().Find(TournamentId);
+		if (Tournament)
+		{
+			OutTournament = *Tournament;
+		}
+		return Tournament != nullptr;
+	}
+	
+	/**
+	 * Indexed tournament cache shared with the tournament UI
+	 */
+	const FDeskillzTournamentStore& GetTournamentStore() const { return FDeskillzTournamentStore::Get(); }
 	
 	/**
 	 * Fetch details for specific tournament
@@ -267,7 +296,7 @@ public:
 	 * Check if user is registered for tournament
 	 */
 	UFUNCTION(BlueprintPure, Category = "Deskillz|Tournaments")
-	bool IsRegisteredFor(const FString& TournamentId) const;
+	bool IsRegisteredFor(const FString& TournamentId) const { return RegisteredTournamentIds.Contains(TournamentId); }
 	
 	// ========================================================================
 	// Joined Tournaments
@@ -297,6 +326,37 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Deskillz|Tournaments")
 	TArray<FDeskillzJoinedTournament> GetActiveTournaments() const;
 	
+	// ========================================================================
+	// Realtime Updates
+	// ========================================================================
+	
+	/**
+	 * Subscribe to tournament deltas pushed over the realtime socket.
+	 * Player counts, status transitions and new or closed tournaments are
+	 * applied to the cache as they happen; AutoRefresh falls back to an
+	 * occasional full resync. Called automatically after the first
+	 * successful fetch.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Deskillz|Tournaments")
+	void SubscribeToUpdates();
+	
+	/**
+	 * Stop receiving pushed tournament deltas
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Deskillz|Tournaments")
+	void UnsubscribeFromUpdates();
+	
+	/**
+	 * Check if pushed deltas are keeping the cache current (the server acked
+	 * the channel join or sent a delta within the last two minutes)
+	 */
+	UFUNCTION(BlueprintPure, Category = "Deskillz|Tournaments")
+	bool IsReceivingUpdates() const;
+	
+	/** Seconds between full resyncs while receiving pushed deltas */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deskillz|Tournaments", meta = (ClampMin = "30.0"))
+	float FullResyncIntervalSeconds = 600.0f;
+	
 	// ========================================================================
 	// Utility
 	// ========================================================================
@@ -347,6 +407,10 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Deskillz|Tournaments|Events")
 	FOnTournamentStatusChange OnTournamentStatusChanged;
 	
+	/** Cached tournament added, updated or removed (fetch or pushed delta) */
+	UPROPERTY(BlueprintAssignable, Category = "Deskillz|Tournaments|Events")
+	FOnTournamentStateChanged OnTournamentStateChanged;
+	
 	/** Joined tournaments updated */
 	UPROPERTY(BlueprintAssignable, Category = "Deskillz|Tournaments|Events")
 	FOnJoinedTournamentsUpdated OnJoinedTournamentsUpdated;
@@ -356,10 +420,6 @@ protected:
 	// Internal State
 	// ========================================================================
 	
-	/** Cached tournaments */
-	UPROPERTY()
-	TArray<FDeskillzTournament> CachedTournaments;
-	
 	/** Joined tournaments */
 	UPROPERTY()
 	TArray<FDeskillzJoinedTournament> JoinedTournaments;
@@ -380,23 +440,48 @@ protected:
 	/** World reference */
 	TWeakObjectPtr<UWorld> WorldRef;
 	
+	/** Socket channel carrying tournament deltas (empty = not subscribed) */
+	FString UpdatesChannel;
+	
+	/** Sequence number of the last applied delta (0 = none since resync) */
+	int64 LastUpdateSequence = 0;
+	
+	/** FPlatformTime::Seconds() of the last join ack or delta (0 = none since joining) */
+	double LastUpdateActivitySeconds = 0.0;
+	
 	// ========================================================================
 	// Internal Methods
 	// ========================================================================
 	
-	/** Apply filter to tournaments */
-	TArray<FDeskillzTournament> ApplyFilter(const TArray<FDeskillzTournament>& Tournaments, const FDeskillzTournamentFilter& Filter) const;
-	
-	/** Sort tournaments */
-	void SortTournaments(TArray<FDeskillzTournament>& Tournaments, EDeskillzTournamentSort SortBy, bool bAscending) const;
+	/** Filtered tournaments from the store, applying affordability (MaxCount 0 = all) */
+	TArray<FDeskillzTournament> ApplyFilter(const FDeskillzTournamentFilter& Filter, int32 MaxCount = 0) const;
 	
-	/** Handle SDK tournament response */
+	/** Handle SDK tournament response (syncs the store incrementally) */
 	UFUNCTION()
 	void OnTournamentsReceived(const TArray<FDeskillzTournament>& Tournaments, const FDeskillzError& Error);
 	
-	/** Auto-refresh tournaments */
+	/** Auto-refresh tournaments (full resync; infrequent while receiving deltas) */
 	void AutoRefresh();
 	
+	/** Apply a pushed tournament delta */
+	void HandleTournamentEvent(const FDeskillzWebSocketMessage& Message);
+	
+	/** Rejoin the channel and resync after reconnecting, since deltas may have been missed */
+	UFUNCTION()
+	void HandleSocketConnected();
+	
+	/** Store a new or changed tournament and fire change events */
+	void ApplyTournamentChange(const FDeskillzTournament& Tournament);
+	
+	/** Drop a tournament from the cache and fire change events */
+	void ApplyTournamentRemoval(const FString& TournamentId);
+	
+	/** Fetch the full list to recover from missed deltas */
+	void RequestResync(const TCHAR* Reason);
+	
+	/** Overwrite tournament fields present in a delta payload */
+	static void ReadTournamentFields(const TSharedPtr<FJsonObject>& Json, FDeskillzTournament& InOutTournament);
+	
 	/** Update registered tournament IDs from joined list */
 	void UpdateRegisteredIds();
 };
@@ -0,0 +1,140 @@
+// Copyright Deskillz Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/DeskillzTypes.h"
+#include "Core/DeskillzSearchIndex.h"
+
+struct FDeskillzTournamentFilter;
+enum class EDeskillzTournamentSort : uint8;
+
+/**
+ * Indexed tournament cache
+ *
+ * Tournaments live in stable slots with their sort keys precomputed, plus
+ * sorted secondary indexes by start time, prize pool, entry fee and player
+ * count. Status, match type and currency are single bits, so filter checks
+ * are mask tests. Refreshes update only the tournaments that changed, and
+ * queries are range scans over an index that visit tournaments in place
+ * with no copying or sorting.
+ *
+ * The shared store is written only by UDeskillzTournamentManager; the
+ * tournament UI reads it (game thread only).
+ *
+ * Usage:
+ *   FDeskillzTournamentStore::Get().Query(Filter, [](const FDeskillzTournament& T) { ...; return true; });
+ */
+class DESKILLZ_API FDeskillzTournamentStore
+{
+public:
+	/** What an upsert did */
+	enum class EChange : uint8
+	{
+		None,
+		Added,
+		Updated
+	};
+
+	/** Visitor for queries; return false to stop */
+	using FVisitor = TFunctionRef<bool(const FDeskillzTournament&)>;
+
+	/** Shared store (read-only; UDeskillzTournamentManager keeps it current) */
+	static const FDeskillzTournamentStore& Get();
+
+	// ========================================================================
+	// Updates
+	// ========================================================================
+
+	/** Add or replace a tournament; unchanged tournaments are left alone */
+	EChange Upsert(const FDeskillzTournament& Tournament);
+
+	/** Remove a tournament */
+	bool Remove(const FString& TournamentId);
+
+	/**
+	 * Make the store match a full tournament list
+	 * @param OutRemovedIds Optional; receives IDs no longer listed
+	 * @return Number of tournaments added or updated
+	 */
+	int32 Sync(const TArray<FDeskillzTournament>& Tournaments, TArray<FString>* OutRemovedIds = nullptr);
+
+	/** Remove all tournaments */
+	void Reset();
+
+	// ========================================================================
+	// Queries
+	// ========================================================================
+
+	/** Number of tournaments */
+	int32 Num() const { return SlotById.Num(); }
+
+	/** Tournament by ID, or nullptr */
+	const FDeskillzTournament* Find(const FString& TournamentId) const;
+
+	/** Visit tournaments matching a filter in its sort order */
+	void Query(const FDeskillzTournamentFilter& Filter, FVisitor Visitor) const;
+
+	/** Copy of the tournaments matching a filter (MaxCount 0 = all) */
+	TArray<FDeskillzTournament> Query(const FDeskillzTournamentFilter& Filter, int32 MaxCount = 0) const;
+
+	/** Visit tournaments starting in [From, To), earliest first */
+	void ForEachStartingBetween(const FDateTime& From, const FDateTime& To, FVisitor Visitor) const;
+
+	/** Copy of every tournament, earliest start first */
+	TArray<FDeskillzTournament> ToArray() const;
+
+private:
+	friend class UDeskillzTournamentManager;
+
+	/** Writable shared store, for the tournament manager only */
+	static FDeskillzTournamentStore& GetMutable();
+
+	enum ESortIndex : uint8
+	{
+		ByStartTime,
+		ByPrizePool,
+		ByEntryFee,
+		ByPlayerCount,
+
+		SortIndexCount
+	};
+
+	struct FSlot
+	{
+		FDeskillzTournament Tournament;
+
+		/** Precomputed sort keys */
+		int64 StartTicks = 0;
+		double PrizePool = 0.0;
+		double EntryFee = 0.0;
+		int32 PlayerCount = 0;
+
+		/** Single-bit filter keys */
+		uint32 StatusBit = 0;
+		uint32 MatchTypeBit = 0;
+		uint32 CurrencyBit = 0;
+
+		bool bLive = false;
+	};
+
+	static ESortIndex GetSortIndex(EDeskillzTournamentSort SortBy);
+
+	/** Strict order of two slots in an index (key, then slot) */
+	bool IsBefore(ESortIndex Index, int32 SlotA, int32 SlotB) const;
+
+	/** First position in an index not before the slot */
+	int32 LowerBound(ESortIndex Index, int32 Slot) const;
+
+	void SetKeys(FSlot& Slot) const;
+	void Link(int32 Slot);
+	void Unlink(int32 Slot);
+
+	TArray<FSlot> Slots;
+	TArray<int32> FreeSlots;
+	TMap<FString, int32> SlotById;
+	TArray<int32> Sorted[SortIndexCount];
+
+	/** Name and description search for filter SearchText */
+	FDeskillzSearchIndex SearchIndex;
+};
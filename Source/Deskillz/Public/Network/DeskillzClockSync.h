@@ -0,0 +1,222 @@
+// Copyright Deskillz Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "Core/DeskillzRingBuffer.h"
+#include "DeskillzClockSync.generated.h"
+
+struct FDeskillzWebSocketMessage;
+
+/**
+ * Server-authoritative clock
+ *
+ * NTP-style sync over the realtime socket: each "time:sync" round trip
+ * yields an offset and round-trip time against the local monotonic clock.
+ * Only the lowest-RTT samples in the window are trusted (queueing delay is
+ * what makes samples wrong), and a line fitted through them tracks clock
+ * skew between syncs.
+ *
+ * Once synced, corrections forward are stepped and corrections backward
+ * are slewed at a fraction of real time. Server time is derived from
+ * FPlatformTime rather than the wall clock, so device clock changes and
+ * frame hitches do not move it.
+ *
+ * FPlatformTime stops while a mobile device sleeps, so on returning to the
+ * foreground the time asleep is bridged from the wall clock. That bridge is
+ * only as honest as the device clock: until the next round trip confirms
+ * it, IsSynced() is false, and that round trip is stepped to outright, in
+ * either direction. Without a socket the bridged estimate stands.
+ *
+ * Usage:
+ *   int64 Now = UDeskillzClockSync::Get()->GetServerTimeMs();
+ */
+UCLASS(BlueprintType)
+class DESKILLZ_API UDeskillzClockSync : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UDeskillzClockSync();
+
+	// ========================================================================
+	// Singleton Access
+	// ========================================================================
+
+	/**
+	 * Get the clock sync instance
+	 */
+	UFUNCTION(BlueprintPure, Category = "Deskillz|Network", meta = (DisplayName = "Get Deskillz Clock Sync"))
+	static UDeskillzClockSync* Get();
+
+	// ========================================================================
+	// Server Time
+	// ========================================================================
+
+	/**
+	 * Current server time in Unix milliseconds. Monotonic, except that a
+	 * round trip replacing an unconfirmed estimate (the wall-clock guess
+	 * before the first sync, or the bridge over sleep) may step it back.
+	 * Deadlines held as server instants stay valid across such a step.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Deskillz|Network")
+	int64 GetServerTimeMs() const;
+
+	/**
+	 * Seconds until a server instant (negative once passed)
+	 */
+	UFUNCTION(BlueprintPure, Category = "Deskillz|Network")
+	double GetSecondsUntil(int64 ServerTimeMs) const;
+
+	/**
+	 * Whether a round trip has confirmed the current estimate (false from
+	 * returning to the foreground until the next one)
+	 */
+	UFUNCTION(BlueprintPure, Category = "Deskillz|Network")
+	bool IsSynced() const { return bHasRoundTrip && !bStepOnNextSample; }
+
+	/**
+	 * Lowest round-trip time in the sample window (ms, -1 if unsynced)
+	 */
+	UFUNCTION(BlueprintPure, Category = "Deskillz|Network")
+	int32 GetBestRoundTripMs() const { return BestRoundTripMs; }
+
+	/**
+	 * Estimated local clock skew (parts per million)
+	 */
+	UFUNCTION(BlueprintPure, Category = "Deskillz|Network")
+	float GetSkewPpm() const { return static_cast<float>(Skew * 1e6); }
+
+	/**
+	 * Incremented when server time moves to a new reference (first server
+	 * estimate, first round trip); intervals measured across a change are
+	 * not meaningful. Confirming the bridge over sleep does not count: the
+	 * interval across it is exactly what a changed device clock shows up in.
+	 */
+	int32 GetStepEpoch() const { return StepEpoch; }
+
+	// ========================================================================
+	// Sync
+	// ========================================================================
+
+	/**
+	 * Start syncing over the realtime socket (burst on every connect, then periodic)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Deskillz|Network")
+	void StartSync();
+
+	/**
+	 * Stop periodic syncing (the current estimate keeps running)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Deskillz|Network")
+	void StopSync();
+
+	/**
+	 * Send one sync request now
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Deskillz|Network")
+	void RequestSample();
+
+	/**
+	 * Use a server timestamp with unknown latency (e.g. from an HTTP response).
+	 * Only applied until the first round-trip sample.
+	 */
+	void AddCoarseSample(int64 ServerTimeMs);
+
+	// ========================================================================
+	// Settings
+	// ========================================================================
+
+	/** Seconds between samples once synced */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deskillz|Network", meta = (ClampMin = "1.0"))
+	float SyncIntervalSeconds = 15.0f;
+
+	/** Samples taken in quick succession after connecting */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deskillz|Network", meta = (ClampMin = "1"))
+	int32 BurstSampleCount = 6;
+
+	/** Fraction of real time a backward correction may slew at */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deskillz|Network", meta = (ClampMin = "0.001", ClampMax = "0.5"))
+	float MaxSlewRate = 0.05f;
+
+protected:
+	/** Clock offset sample against local monotonic time */
+	struct FClockSample
+	{
+		/** Local monotonic time of the sample (seconds) */
+		double LocalSeconds = 0.0;
+
+		/** Server minus local (ms) */
+		double OffsetMs = 0.0;
+
+		/** Round-trip time excluding server processing (ms) */
+		double RoundTripMs = 0.0;
+	};
+
+	/** Recent samples */
+	TDeskillzRingBuffer<FClockSample> Samples;
+
+	/** Fitted offset at FitLocalSeconds, and its drift per local second (ms/ms) */
+	double FitOffsetMs = 0.0;
+	double FitLocalSeconds = 0.0;
+	double Skew = 0.0;
+
+	/** Offset actually applied, slewed toward the fit (mutable: advanced on read) */
+	mutable double AppliedOffsetMs = 0.0;
+	mutable double AppliedAtSeconds = 0.0;
+	mutable int64 LastServerTimeMs = 0;
+
+	bool bHasEstimate = false;
+	bool bHasRoundTrip = false;
+	int32 BestRoundTripMs = -1;
+
+	/** Burst samples still to send */
+	int32 BurstRemaining = 0;
+
+	/** See GetStepEpoch() */
+	int32 StepEpoch = 0;
+
+	/** The next round trip replaces the bridged estimate outright (after sleep) */
+	bool bStepOnNextSample = false;
+
+	/** Wall clock (Unix ms) and local time when the app went to the background (0 = in foreground) */
+	double BackgroundWallMs = 0.0;
+	double BackgroundLocalSeconds = 0.0;
+
+	bool bSyncing = false;
+
+	FTimerHandle SyncTimerHandle;
+
+	/** Local monotonic time in seconds */
+	static double GetLocalSeconds();
+
+	/** Target offset from the fit at a local time */
+	double GetFittedOffsetMs(double LocalSeconds) const;
+
+	/** Refit offset and skew from the trusted samples */
+	void UpdateEstimate();
+
+	/** Bring the applied offset toward the fit */
+	void AdvanceAppliedOffset(double LocalSeconds) const;
+
+	/** Schedule the next sample */
+	void ScheduleNextSample();
+
+	void HandleSyncResponse(const FDeskillzWebSocketMessage& Message);
+
+	UFUNCTION()
+	void HandleSocketConnected();
+
+	UFUNCTION()
+	void HandleAppWillEnterBackground();
+
+	/** Bridge the time the local clock was stopped and resample */
+	UFUNCTION()
+	void HandleAppDidEnterForeground();
+
+	/** Device wall clock in Unix ms */
+	static double GetWallMs();
+
+	void SendScheduledSample();
+};
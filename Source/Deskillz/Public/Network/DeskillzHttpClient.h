@@ -314,6 +314,17 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Deskillz|Network")
 	void ClearCache();
 	
+	/**
+	 * Get memory held by the response cache (bytes)
+	 */
+	int64 GetCacheMemoryBytes() const { return ResponseCacheBytes; }
+	
+	/**
+	 * Evict cached responses until the cache fits in MaxBytes
+	 * Expired entries go first, then those closest to expiry.
+	 */
+	void TrimCache(int64 MaxBytes);
+	
 	/**
 	 * Parse JSON response
 	 */
@@ -362,6 +373,9 @@ protected:
 	/** Response cache */
 	TMap<FString, TPair<FDeskillzHttpResponse, double>> ResponseCache;
 	
+	/** Accounted size of ResponseCache (bytes) */
+	int64 ResponseCacheBytes = 0;
+	
 	/** Request counter for IDs */
 	int32 RequestCounter = 0;
 	
@@ -393,6 +407,12 @@ protected:
 	/** Generate cache key */
 	FString GenerateCacheKey(const FDeskillzHttpRequest& Request) const;
 	
+	/** Accounted size of one cache entry */
+	static int64 GetCacheEntryBytes(const FString& CacheKey, const FDeskillzHttpResponse& Response);
+	
+	/** Remove a cache entry and update accounting */
+	void RemoveCachedResponse(const FString& CacheKey);
+	
 	/** Schedule retry */
 	void ScheduleRetry(const FDeskillzHttpRequest& Request, const FOnDeskillzHttpResponse& OnComplete, int32 AttemptNumber);
 	
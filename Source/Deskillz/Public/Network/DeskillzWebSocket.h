@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
 #include "IWebSocket.h"
+#include "Security/DeskillzReplayFilter.h"
 #include "DeskillzWebSocket.generated.h"
 
 /**
@@ -51,6 +52,10 @@ struct DESKILLZ_API FDeskillzWebSocketMessage
 	/** Binary data */
 	TArray<uint8> BinaryData;
 	
+	/** Server nonce (from JSON, empty if absent) */
+	UPROPERTY(BlueprintReadOnly, Category = "WebSocket")
+	FString Nonce;
+	
 	/** Event type (from JSON) */
 	UPROPERTY(BlueprintReadOnly, Category = "WebSocket")
 	FString EventType;
@@ -85,6 +90,7 @@ DECLARE_DELEGATE_OneParam(FOnDeskillzWSMessageNative, const FDeskillzWebSocketMe
  * - Heartbeat/ping-pong
  * - Message queuing during disconnect
  * - Event-based messaging
+ * - Replay protection for server messages carrying a "nonce"
  * 
  * Usage:
  *   UDeskillzWebSocket* WS = UDeskillzWebSocket::Get();
@@ -324,6 +330,9 @@ protected:
 	/** Last pong time */
 	double LastPongTime = 0.0;
 	
+	/** Recently seen server message nonces (bounded, see UDeskillzConfig::ReplayWindowSeconds) */
+	FDeskillzReplayFilter ReplayFilter;
+	
 	// ========================================================================
 	// Internal Methods
 	// ========================================================================
@@ -278,6 +278,7 @@ protected:
 	FDelegateHandle SuspendHandle;
 	FDelegateHandle ResumeHandle;
 	FDelegateHandle TerminateHandle;
+	FDelegateHandle LowMemoryHandle;
 	
 	// ========================================================================
 	// Internal Methods
@@ -298,6 +299,7 @@ protected:
 	void OnApplicationWillSuspend();
 	void OnApplicationHasResumed();
 	void OnApplicationWillTerminate();
+	void OnApplicationLowMemory();
 	
 	/** Get current timestamp */
 	int64 GetCurrentTimestamp() const;
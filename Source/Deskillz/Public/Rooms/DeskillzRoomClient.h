@@ -9,12 +9,14 @@
 #include "DeskillzRoomClient.generated.h"
 
 class IWebSocket;
+class FJsonObject;
 
 // =============================================================================
 // Internal Delegates for WebSocket Events
 // =============================================================================
 
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnRoomStateReceived, const FPrivateRoom&);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnRoomPatchReceived, const FRoomStatePatch&);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnRoomPlayerJoined, const FRoomPlayer&);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnRoomPlayerLeft, const FString&);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnRoomPlayerKicked, const FString&);
@@ -28,6 +30,9 @@ DECLARE_MULTICAST_DELEGATE_OneParam(FOnRoomKicked, const FString&);
 DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnRoomChat, const FString&, const FString&, const FString&);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnRoomClientError, const FString&);
 
+/** Handler for a custom room WebSocket event (receives the event's "data" object, may be null) */
+using FRoomEventHandler = TFunction<void(const TSharedPtr<FJsonObject>&)>;
+
 /**
  * Internal HTTP/WebSocket client for Private Room operations.
  * Handles API calls and real-time WebSocket events.
@@ -83,6 +88,13 @@ public:
 		FOnRoomListSuccess OnSuccess,
 		FOnRoomError OnError);
 
+	/** Get one page (or the changes since a version) of public rooms for a game */
+	void GetPublicRoomsPage(
+		const FString& GameId,
+		const FRoomListQuery& Query,
+		FOnRoomPageSuccess OnSuccess,
+		FOnRoomError OnError);
+
 	/** Get rooms for current user */
 	void GetMyRooms(
 		FOnRoomListSuccess OnSuccess,
@@ -157,6 +169,7 @@ public:
 	// =========================================================================
 
 	FOnRoomStateReceived OnStateUpdate;
+	FOnRoomPatchReceived OnStatePatch;
 	FOnRoomPlayerJoined OnPlayerJoined;
 	FOnRoomPlayerLeft OnPlayerLeft;
 	FOnRoomPlayerKicked OnPlayerKicked;
@@ -170,6 +183,31 @@ public:
 	FOnRoomChat OnChat;
 	FOnRoomClientError OnError;
 
+	// =========================================================================
+	// Custom Events
+	// =========================================================================
+
+	/**
+	 * Handle a game-specific room event (e.g. "my-game:round-result").
+	 * Built-in room events cannot be overridden.
+	 * @return False if the name is empty, built-in, or the handler is unbound
+	 */
+	bool RegisterEventHandler(FName EventType, FRoomEventHandler Handler);
+
+	/** Remove a custom room event handler */
+	void UnregisterEventHandler(FName EventType);
+
+	// =========================================================================
+	// Parsing
+	// =========================================================================
+
+	/**
+	 * Parse a public rooms response: a paged object, or the bare room array
+	 * older servers return (an unpaged page)
+	 * @return False if the body is not JSON
+	 */
+	bool ParseRoomListPage(const FString& Content, FRoomListPage& OutPage) const;
+
 protected:
 	// =========================================================================
 	// HTTP Helpers
@@ -196,6 +234,12 @@ protected:
 	/** Parse player from JSON */
 	FRoomPlayer ParsePlayer(const TSharedPtr<FJsonObject>& JsonObject) const;
 
+	/** Parse room patch from JSON (only fields present are set) */
+	FRoomStatePatch ParseRoomPatch(const TSharedPtr<FJsonObject>& JsonObject) const;
+
+	/** Parse changed player fields from JSON */
+	FRoomPlayerPatch ParsePlayerPatch(const TSharedPtr<FJsonObject>& JsonObject) const;
+
 	// =========================================================================
 	// WebSocket Helpers
 	// =========================================================================
@@ -218,6 +262,34 @@ protected:
 	/** Process WebSocket event */
 	void ProcessWebSocketEvent(const FString& EventType, const TSharedPtr<FJsonObject>& Data);
 
+	/** Decode + broadcast handler for a built-in event */
+	using FBuiltInEventHandler = void (UDeskillzRoomClient::*)(const TSharedPtr<FJsonObject>&);
+
+	/** Built-in event table, keyed by event name (built once) */
+	static const TMap<FName, FBuiltInEventHandler>& GetBuiltInEventHandlers();
+
+	/** Built-in event handlers (Data is always valid) */
+	void HandleStateEvent(const TSharedPtr<FJsonObject>& Data);
+	void HandlePatchEvent(const TSharedPtr<FJsonObject>& Data);
+	void HandlePlayerJoinedEvent(const TSharedPtr<FJsonObject>& Data);
+	void HandlePlayerLeftEvent(const TSharedPtr<FJsonObject>& Data);
+	void HandlePlayerKickedEvent(const TSharedPtr<FJsonObject>& Data);
+	void HandlePlayerReadyEvent(const TSharedPtr<FJsonObject>& Data);
+	void HandleAllReadyEvent(const TSharedPtr<FJsonObject>& Data);
+	void HandleCountdownStartedEvent(const TSharedPtr<FJsonObject>& Data);
+	void HandleCountdownTickEvent(const TSharedPtr<FJsonObject>& Data);
+	void HandleLaunchingEvent(const TSharedPtr<FJsonObject>& Data);
+	void HandleCancelledEvent(const TSharedPtr<FJsonObject>& Data);
+	void HandleKickedEvent(const TSharedPtr<FJsonObject>& Data);
+	void HandleChatEvent(const TSharedPtr<FJsonObject>& Data);
+	void HandleErrorEvent(const TSharedPtr<FJsonObject>& Data);
+
+	/** Whether a player event carries a state version (servers without patches omit it) */
+	bool IsSequencedEvent(const TSharedPtr<FJsonObject>& Data) const;
+
+	/** Broadcast a per-player event as a single-change patch, sequenced with snapshots */
+	void BroadcastSequencedPatch(const TSharedPtr<FJsonObject>& Data, FRoomStatePatch& Patch);
+
 	/** Subscribe to room */
 	void SubscribeToRoom();
 
@@ -235,6 +307,9 @@ private:
 	/** WebSocket connection */
 	TSharedPtr<IWebSocket> WebSocket;
 
+	/** Game-registered handlers for events outside the built-in table */
+	TMap<FName, FRoomEventHandler> CustomEventHandlers;
+
 	/** Current room ID */
 	FString CurrentRoomId;
 
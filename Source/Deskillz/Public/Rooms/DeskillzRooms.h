@@ -8,6 +8,7 @@
 #include "DeskillzRooms.generated.h"
 
 class UDeskillzRoomClient;
+class FJsonObject;
 
 /**
  * Deskillz SDK - Private Room Management
@@ -132,6 +133,20 @@ public:
 		FOnRoomListSuccess OnSuccess,
 		FOnRoomError OnError);
 
+	/**
+	 * Get one page of public rooms, searched and sorted by the server.
+	 * Pass the page's NextCursor to load the next page, or its Version as
+	 * SinceVersion to fetch only rooms changed since.
+	 * @param Query Search, sort and paging options
+	 * @param OnSuccess Called with the page on success
+	 * @param OnError Called on error
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Deskillz|Rooms")
+	void GetPublicRoomsPage(
+		const FRoomListQuery& Query,
+		FOnRoomPageSuccess OnSuccess,
+		FOnRoomError OnError);
+
 	/**
 	 * Get rooms created by or joined by current user.
 	 * @param OnSuccess Called with list of rooms on success
@@ -271,6 +286,31 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Deskillz|Rooms")
 	bool CanStartMatch() const;
 
+	/**
+	 * Handle a game-specific room WebSocket event.
+	 * Built-in room events cannot be overridden.
+	 * @param EventType Event name sent by the server (e.g. "my-game:round-result")
+	 * @param Handler Receives the event's "data" object
+	 * @return True if registered
+	 */
+	bool RegisterRoomEventHandler(FName EventType, TFunction<void(const TSharedPtr<FJsonObject>&)> Handler);
+
+	/**
+	 * Remove a game-specific room event handler.
+	 */
+	void UnregisterRoomEventHandler(FName EventType);
+
+	/**
+	 * Get memory held by cached room state (bytes).
+	 */
+	int64 GetRoomStateMemoryBytes() const;
+
+	/**
+	 * Release cached room state that is no longer needed.
+	 * The current room is kept while connected.
+	 */
+	void TrimRoomState();
+
 	// =========================================================================
 	// Events - Bindable in Blueprint and C++
 	// =========================================================================
@@ -295,6 +335,10 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Deskillz|Rooms|Events")
 	FOnPlayerReadyChanged OnPlayerReadyChanged;
 
+	/** Called when a player's details change (name, avatar, admin); ready changes use OnPlayerReadyChanged */
+	UPROPERTY(BlueprintAssignable, Category = "Deskillz|Rooms|Events")
+	FOnPlayerUpdatedInRoom OnPlayerUpdated;
+
 	/** Called when all players are ready */
 	UPROPERTY(BlueprintAssignable, Category = "Deskillz|Rooms|Events")
 	FOnAllPlayersReady OnAllPlayersReady;
@@ -343,6 +387,21 @@ protected:
 	/** Whether initialized */
 	bool bIsInitialized;
 
+	/** A snapshot was requested after a version gap; patches are held until it arrives */
+	bool bAwaitingRoomSnapshot;
+
+	/** Patches received while awaiting a snapshot, replayed on top of it */
+	TArray<FRoomStatePatch> PendingRoomPatches;
+
+	/** Most patches held while awaiting a snapshot */
+	static constexpr int32 MaxPendingRoomPatches = 32;
+
+	/** FPlatformTime::Seconds() of the last snapshot request */
+	double LastRoomSnapshotRequestTime;
+
+	/** Least time between snapshot requests (seconds) */
+	static constexpr double MinRoomSnapshotInterval = 2.0;
+
 	/** Connect WebSocket to room */
 	void ConnectToRoom(const FString& RoomId);
 
@@ -351,6 +410,7 @@ protected:
 
 	/** Handle WebSocket events */
 	void HandleRoomStateUpdate(const FPrivateRoom& Room);
+	void HandleRoomPatch(const FRoomStatePatch& Patch);
 	void HandlePlayerJoined(const FRoomPlayer& Player);
 	void HandlePlayerLeft(const FString& PlayerId);
 	void HandlePlayerKicked(const FString& PlayerId);
@@ -364,6 +424,18 @@ protected:
 	void HandleChat(const FString& SenderId, const FString& Username, const FString& Message);
 	void HandleError(const FString& ErrorMessage);
 
+	/** Apply an in-sequence patch to CurrentRoom and broadcast what changed */
+	void ApplyRoomPatch(const FRoomStatePatch& Patch);
+
+	/** Hold a patch until a snapshot arrives (oldest dropped when full) */
+	void HoldRoomPatch(const FRoomStatePatch& Patch);
+
+	/** Fetch a full snapshot after a version gap (at most once per MinRoomSnapshotInterval) */
+	void RequestRoomSnapshot();
+
+	/** Forget sequencing state (room changed or left) */
+	void ResetRoomSync();
+
 	/** Validate authentication */
 	bool ValidateAuthentication(FOnRoomError OnError);
 };
\ No newline at end of file
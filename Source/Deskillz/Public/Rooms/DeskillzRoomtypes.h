@@ -69,6 +69,19 @@ enum class ERoomMode : uint8
 	Async UMETA(DisplayName = "Asynchronous")
 };
 
+/**
+ * Sort options for room lists
+ */
+UENUM(BlueprintType)
+enum class ERoomSortOption : uint8
+{
+	Newest UMETA(DisplayName = "Newest First"),
+	EntryFeeAsc UMETA(DisplayName = "Entry Fee: Low to High"),
+	EntryFeeDesc UMETA(DisplayName = "Entry Fee: High to Low"),
+	PlayersAsc UMETA(DisplayName = "Players: Low to High"),
+	PlayersDesc UMETA(DisplayName = "Players: High to Low")
+};
+
 // =============================================================================
 // DATA STRUCTURES
 // =============================================================================
@@ -241,6 +254,10 @@ struct DESKILLZ_API FPrivateRoom
 	UPROPERTY(BlueprintReadOnly, Category = "Deskillz|Rooms")
 	FDateTime ExpiresAt;
 
+	/** Server state sequence number (0 = unversioned) */
+	UPROPERTY(BlueprintReadOnly, Category = "Deskillz|Rooms")
+	int64 Version;
+
 	FPrivateRoom()
 		: Mode(ERoomMode::Sync)
 		, EntryFee(0.0f)
@@ -251,6 +268,7 @@ struct DESKILLZ_API FPrivateRoom
 		, Status(ERoomStatus::Waiting)
 		, Visibility(ERoomVisibility::Unlisted)
 		, bInviteRequired(false)
+		, Version(0)
 	{}
 
 	/** Check if room is full */
@@ -267,6 +285,59 @@ struct DESKILLZ_API FPrivateRoom
 
 	/** Find a player by ID */
 	const FRoomPlayer* FindPlayer(const FString& PlayerId) const;
+	FRoomPlayer* FindPlayer(const FString& PlayerId);
+
+	/** Add a player, or overwrite the entry with the same ID */
+	FRoomPlayer& AddPlayer(const FRoomPlayer& Player);
+
+	/** Remove a player by ID; returns false if not in the room */
+	bool RemovePlayer(const FString& PlayerId);
+
+	/** Rebuild the ID index after assigning Players directly */
+	void RebuildPlayerIndex();
+
+	/** Player ID -> index into Players, kept by AddPlayer/RemovePlayer */
+	TMap<FString, int32> PlayerIndex;
+};
+
+/**
+ * Changed fields of one player in a room patch
+ */
+struct DESKILLZ_API FRoomPlayerPatch
+{
+	FString Id;
+	TOptional<FString> Username;
+	TOptional<FString> AvatarUrl;
+	TOptional<bool> bIsReady;
+	TOptional<bool> bIsAdmin;
+
+	/** Apply the changed fields to a player */
+	void ApplyTo(FRoomPlayer& Player) const;
+};
+
+/**
+ * Incremental room state change
+ *
+ * Moves a room from Version - 1 to Version. Only changed fields are set;
+ * players not listed are unchanged.
+ */
+struct DESKILLZ_API FRoomStatePatch
+{
+	FString RoomId;
+	int64 Version = 0;
+
+	TOptional<ERoomStatus> Status;
+	TOptional<int32> CurrentPlayers;
+	TOptional<float> PrizePool;
+
+	/** Players added or changed */
+	TArray<FRoomPlayerPatch> Players;
+
+	/** Players that left or were kicked */
+	TArray<FString> RemovedPlayerIds;
+
+	/** Server reports every player ready after this change */
+	bool bAllReady = false;
 };
 
 /**
@@ -334,6 +405,88 @@ struct DESKILLZ_API FCreateRoomConfig
 	{}
 };
 
+/**
+ * Query for one page of public rooms.
+ * Search and sort are applied by the server.
+ */
+USTRUCT(BlueprintType)
+struct DESKILLZ_API FRoomListQuery
+{
+	GENERATED_BODY()
+
+	/** Text matched against room name, code and host (empty = all) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deskillz|Rooms")
+	FString Search;
+
+	/** Sort order */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deskillz|Rooms")
+	ERoomSortOption Sort;
+
+	/** Rooms per page */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deskillz|Rooms", meta = (ClampMin = "1", ClampMax = "100"))
+	int32 Limit;
+
+	/** Cursor from the previous page (empty = first page) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deskillz|Rooms")
+	FString Cursor;
+
+	/** Only return rooms changed after this list version (0 = full page) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deskillz|Rooms")
+	int64 SinceVersion;
+
+	FRoomListQuery()
+		: Sort(ERoomSortOption::Newest)
+		, Limit(20)
+		, SinceVersion(0)
+	{}
+};
+
+/**
+ * One page of public rooms, or the changes since a list version
+ */
+USTRUCT(BlueprintType)
+struct DESKILLZ_API FRoomListPage
+{
+	GENERATED_BODY()
+
+	/** Rooms in server order (changed rooms for a delta) */
+	UPROPERTY(BlueprintReadOnly, Category = "Deskillz|Rooms")
+	TArray<FPrivateRoom> Rooms;
+
+	/** Rooms closed or filled since SinceVersion (delta only) */
+	UPROPERTY(BlueprintReadOnly, Category = "Deskillz|Rooms")
+	TArray<FString> RemovedRoomIds;
+
+	/** Cursor for the next page (empty = last page) */
+	UPROPERTY(BlueprintReadOnly, Category = "Deskillz|Rooms")
+	FString NextCursor;
+
+	/** List version to pass as SinceVersion for the next incremental refresh */
+	UPROPERTY(BlueprintReadOnly, Category = "Deskillz|Rooms")
+	int64 Version;
+
+	/** Page holds only changes since SinceVersion */
+	UPROPERTY(BlueprintReadOnly, Category = "Deskillz|Rooms")
+	bool bIsDelta;
+
+	/** Server applied search, sort and paging (false = unpaged list from an older server) */
+	UPROPERTY(BlueprintReadOnly, Category = "Deskillz|Rooms")
+	bool bServerQueried;
+
+	FRoomListPage()
+		: Version(0)
+		, bIsDelta(false)
+		, bServerQueried(false)
+	{}
+
+	/**
+	 * Merge into the loaded rooms: a delta drops removed rooms and updates or
+	 * appends changed ones, an appended page adds rooms not already loaded,
+	 * anything else replaces the list. Order is left to the caller.
+	 */
+	void ApplyTo(TArray<FPrivateRoom>& InOutRooms, bool bAppend) const;
+};
+
 /**
  * Match launch data received when match starts
  */
@@ -417,6 +570,9 @@ DECLARE_DYNAMIC_DELEGATE_OneParam(FOnRoomSuccess, const FPrivateRoom&, Room);
 /** Delegate for room list operations */
 DECLARE_DYNAMIC_DELEGATE_OneParam(FOnRoomListSuccess, const TArray<FPrivateRoom>&, Rooms);
 
+/** Delegate for paged room list operations */
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnRoomPageSuccess, const FRoomListPage&, Page);
+
 /** Delegate for simple success operations */
 DECLARE_DYNAMIC_DELEGATE(FOnRoomActionSuccess);
 
@@ -427,6 +583,7 @@ DECLARE_DYNAMIC_DELEGATE_OneParam(FOnRoomError, const FRoomError&, Error);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPlayerJoinedRoom, const FRoomPlayer&, Player);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPlayerLeftRoom, const FString&, PlayerId);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnPlayerReadyChanged, const FString&, PlayerId, bool, bIsReady);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPlayerUpdatedInRoom, const FRoomPlayer&, Player);
 
 /** Delegate for room state events */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnRoomJoined, const FPrivateRoom&, Room);
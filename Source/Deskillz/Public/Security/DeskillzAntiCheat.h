@@ -4,6 +4,9 @@
 
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
+#include "Tickable.h"
+#include "Core/DeskillzRingBuffer.h"
+#include "Security/DeskillzProtectedValue.h"
 #include "DeskillzAntiCheat.generated.h"
 
 /**
@@ -71,6 +74,44 @@ enum class EDeskillzViolationSeverity : uint8
 	Critical
 };
 
+/**
+ * Integrity checks run by the anti-cheat scheduler
+ */
+UENUM(BlueprintType)
+enum class EDeskillzIntegrityCheck : uint8
+{
+	/** Protected score checksum */
+	Memory,
+	
+	/** Frame pacing vs expected frame time */
+	SpeedHack,
+	
+	/** Wall clock jumps */
+	TimeTamper,
+	
+	/** Attached debugger */
+	Debugger,
+	
+	/** Root/jailbreak and emulator (filesystem and platform probes) */
+	DeviceIntegrity
+};
+
+/**
+ * Cost class of an integrity check (decides where and how often it runs)
+ */
+UENUM(BlueprintType)
+enum class EDeskillzCheckCost : uint8
+{
+	/** A few microseconds; runs on the game thread at a short cadence */
+	Cheap,
+	
+	/** Platform calls; runs on the game thread at a long cadence */
+	Moderate,
+	
+	/** Filesystem or blocking platform probes; runs on a background thread */
+	Background
+};
+
 /**
  * Details about a detected violation
  */
@@ -107,56 +148,6 @@ struct DESKILLZ_API FDeskillzViolation
 	bool IsValid() const { return Type != EDeskillzViolationType::None; }
 };
 
-/**
- * Protected value that detects tampering
- */
-template<typename T>
-struct TDeskillzProtectedValue
-{
-	T Get() const
-	{
-		// XOR decrypt
-		return Value ^ Key;
-	}
-	
-	void Set(T NewValue)
-	{
-		// Generate new key
-		Key = FMath::Rand();
-		Value = NewValue ^ Key;
-		
-		// Update checksum
-		UpdateChecksum();
-	}
-	
-	bool Verify() const
-	{
-		uint32 CurrentChecksum = CalculateChecksum();
-		return CurrentChecksum == StoredChecksum;
-	}
-	
-private:
-	T Value = 0;
-	T Key = 0;
-	uint32 StoredChecksum = 0;
-	
-	void UpdateChecksum()
-	{
-		StoredChecksum = CalculateChecksum();
-	}
-	
-	uint32 CalculateChecksum() const
-	{
-		// Simple checksum based on value and key
-		uint32 Hash = 0x811c9dc5; // FNV offset basis
-		Hash ^= (uint32)Value;
-		Hash *= 0x01000193; // FNV prime
-		Hash ^= (uint32)Key;
-		Hash *= 0x01000193;
-		return Hash;
-	}
-};
-
 /** Delegate for violation detection */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnViolationDetected, const FDeskillzViolation&, Violation);
 
@@ -172,15 +163,25 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnViolationDetected, const FDeskill
  * - Device integrity checks
  * 
  * All violations are logged and can be sent to server for analysis.
+ * 
+ * During a match the checks are scheduled rather than run all at once: each
+ * has a cost class and cadence, due checks are spread across frames within
+ * IntegrityBudgetMicroseconds, and root/emulator probes run once per session
+ * on a background thread (their results can't change while the app runs).
  */
 UCLASS(BlueprintType)
-class DESKILLZ_API UDeskillzAntiCheat : public UObject
+class DESKILLZ_API UDeskillzAntiCheat : public UObject, public FTickableGameObject
 {
 	GENERATED_BODY()
 	
 public:
 	UDeskillzAntiCheat();
 	
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return bSchedulerActive; }
+	virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UDeskillzAntiCheat, STATGROUP_Deskillz); }
+	
 	// ========================================================================
 	// Singleton Access
 	// ========================================================================
@@ -215,14 +216,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deskillz|AntiCheat")
 	bool bEnableDeviceIntegrity = true;
 	
-	/** Maximum score per second (for anomaly detection) */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deskillz|AntiCheat")
-	float MaxScorePerSecond = 1000.0f;
-	
 	/** Time drift tolerance in seconds */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deskillz|AntiCheat")
 	float TimeDriftTolerance = 2.0f;
 	
+	/** Game thread time the scheduler may spend on integrity checks per frame (microseconds) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deskillz|AntiCheat", meta = (ClampMin = "10"))
+	float IntegrityBudgetMicroseconds = 250.0f;
+	
 	// ========================================================================
 	// Events
 	// ========================================================================
@@ -248,7 +249,8 @@ public:
 	void Reset();
 	
 	/**
-	 * Run all integrity checks
+	 * Run all integrity checks now (ignores cadence and frame budget)
+	 * Device integrity uses the cached session result, or starts the background probe
 	 * @return True if all checks pass
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Deskillz|AntiCheat")
@@ -292,20 +294,21 @@ public:
 	// ========================================================================
 	
 	/**
-	 * Sync with server time
+	 * Sync with server time (seeds the shared server clock until it has round-trip samples)
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Deskillz|AntiCheat")
 	void SyncServerTime(int64 ServerTimestamp);
 	
 	/**
 	 * Get validated timestamp
-	 * @return Timestamp corrected for any detected drift
+	 * @return Server time in ms from UDeskillzClockSync, unaffected by device clock changes
 	 */
 	UFUNCTION(BlueprintPure, Category = "Deskillz|AntiCheat")
 	int64 GetValidatedTimestamp() const;
 	
 	/**
-	 * Check for time manipulation
+	 * Check for time manipulation: has the device clock kept pace with the
+	 * server clock since the last scheduled time check?
 	 */
 	UFUNCTION(BlueprintPure, Category = "Deskillz|AntiCheat")
 	bool IsTimeValid() const;
@@ -394,6 +397,19 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Deskillz|AntiCheat")
 	bool ValidateInputPatterns() const;
 	
+	/**
+	 * Shannon entropy of recent inter-input intervals (bits, quarter-octave buckets)
+	 * Human play spreads over several buckets; scripted input collapses to one or two
+	 */
+	UFUNCTION(BlueprintPure, Category = "Deskillz|AntiCheat")
+	float GetInputIntervalEntropy() const;
+	
+	/**
+	 * Standard deviation of the offset between consecutive inputs aimed at the same spot (pixels)
+	 */
+	UFUNCTION(BlueprintPure, Category = "Deskillz|AntiCheat")
+	float GetInputJitterStdDev() const;
+	
 protected:
 	// ========================================================================
 	// Internal State
@@ -411,24 +427,82 @@ protected:
 	/** Last score update time */
 	double LastScoreUpdateTime = 0;
 	
-	/** Server time offset */
-	int64 ServerTimeOffset = 0;
-	
 	/** Last time check */
 	double LastTimeCheck = 0;
 	
 	/** Recorded violations */
 	TArray<FDeskillzViolation> DetectedViolations;
 	
-	/** Input history for pattern detection */
-	TArray<TPair<int64, FVector2D>> InputHistory;
+	/** Input history for pattern detection (timestamp ms, X, Y) */
+	TDeskillzSoARingBuffer<int64, float, float> InputHistory;
+	
+	/** Intervals between consecutive inputs (ms) */
+	TDeskillzStatWindow<float> InputIntervals;
+	
+	/** 1 if an input landed on the previous input's position, else 0 */
+	TDeskillzStatWindow<float> InputRepeatFlags;
+	
+	/** Quarter-octave buckets cover ~0ms to ~4s */
+	static constexpr int32 NumIntervalBuckets = 48;
+	
+	/** Interval histogram over InputIntervals */
+	int32 IntervalBucketCounts[NumIntervalBuckets] = {};
+	
+	/** Sum of c * log2(c) over IntervalBucketCounts, kept incrementally for O(1) entropy */
+	double IntervalBucketCLogC = 0.0;
+	
+	/** Offset to the previous input when both target the same spot (pixels, exact repeats excluded) */
+	TDeskillzStatWindow<float> InputJitter;
 	
 	/** Frame time samples for speed hack detection */
-	TArray<float> FrameTimeSamples;
+	TDeskillzStatWindow<float> FrameTimeSamples;
 	
 	/** Expected frame time */
 	float ExpectedFrameTime = 1.0f / 60.0f;
 	
+	/** Last frame sample time (FPlatformTime::Seconds) */
+	double LastFrameSampleTime = 0;
+	
+	/** Last wall clock seen by the time tamper check (ms) */
+	int64 LastTamperTimestamp = 0;
+	
+	/** Server clock at the last time tamper check (ms) */
+	int64 LastTamperServerTimestamp = 0;
+	
+	/** Server clock step epoch at the last time tamper check */
+	int32 LastTamperClockEpoch = 0;
+	
+	// ========================================================================
+	// Scheduler
+	// ========================================================================
+	
+	/** A check's cost class, cadence and next due time */
+	struct FScheduledCheck
+	{
+		EDeskillzIntegrityCheck Check;
+		EDeskillzCheckCost Cost;
+		
+		/** Seconds between runs (0 = once per match) */
+		float Interval;
+		
+		double NextRunTime;
+	};
+	
+	/** Scheduled checks, visited round-robin */
+	TArray<FScheduledCheck> ScheduledChecks;
+	
+	/** Where the next frame's scan starts */
+	int32 NextCheckIndex = 0;
+	
+	/** Scheduler runs while a match is active */
+	bool bSchedulerActive = false;
+	
+	/** Device probe running on a background thread */
+	bool bDeviceProbeInFlight = false;
+	
+	/** Root/emulator violations already reported this match */
+	bool bDeviceViolationsReported = false;
+	
 	// ========================================================================
 	// Internal Methods
 	// ========================================================================
@@ -442,12 +516,39 @@ protected:
 	/** Check for time tampering */
 	bool CheckTimeTamper();
 	
-	/** Check device integrity */
+	/** Whether the device clock kept pace with the server clock since the last tamper check */
+	bool IsClockPaceValid(int64 Timestamp, int64 ServerTimestamp, int32 ClockEpoch) const;
+	
+	/** Check device integrity (cached; starts the background probe if needed) */
 	bool CheckDeviceIntegrity();
 	
+	/** Run one check and report any violation */
+	bool RunCheck(EDeskillzIntegrityCheck Check);
+	
+	/** Run due checks until the frame budget is spent */
+	void RunScheduledChecks(double BudgetSeconds);
+	
+	/** Record the frame interval for speed hack detection */
+	void SampleFrameTime();
+	
+	/** Probe root/emulator status on a background thread */
+	void StartDeviceIntegrityProbe();
+	
+	/** Root/jailbreak probe (thread-safe, touches the filesystem) */
+	static bool ProbeDeviceRooted();
+	
+	/** Emulator/VM probe (thread-safe) */
+	static bool ProbeEmulator();
+	
 	/** Detect input automation */
 	bool DetectInputAutomation() const;
 	
+	/** Move one interval into or out of the entropy histogram */
+	void UpdateIntervalBucket(float IntervalMs, int32 Delta);
+	
+	/** Clear input statistics */
+	void ResetInputStats();
+	
 	/** Get current timestamp */
 	static int64 GetTimestamp();
 };
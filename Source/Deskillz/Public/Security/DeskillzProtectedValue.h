@@ -0,0 +1,209 @@
+// Copyright Deskillz Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Per-instance key generator for protected values
+ *
+ * xorshift64* seeded once from the cycle counter and the owner's address,
+ * so key generation is a few ALU ops with no shared global state (unlike
+ * FMath::Rand) and two values never share a key sequence.
+ */
+struct FDeskillzProtectedKeyStream
+{
+	void Seed(const void* Owner)
+	{
+		State = Mix(FPlatformTime::Cycles64() ^ reinterpret_cast<UPTRINT>(Owner));
+		if (State == 0)
+		{
+			State = 0x9e3779b97f4a7c15ull;
+		}
+	}
+
+	uint64 Next()
+	{
+		State ^= State >> 12;
+		State ^= State << 25;
+		State ^= State >> 27;
+		return State * 0x2545f4914f6cdd1dull;
+	}
+
+	/** splitmix64 finalizer (also used for checksums) */
+	static uint64 Mix(uint64 Value)
+	{
+		Value = (Value ^ (Value >> 30)) * 0xbf58476d1ce4e5b9ull;
+		Value = (Value ^ (Value >> 27)) * 0x94d049bb133111ebull;
+		return Value ^ (Value >> 31);
+	}
+
+private:
+	uint64 State = 0;
+};
+
+/**
+ * Protected value that detects tampering
+ *
+ * Stored XOR-obfuscated with a fresh key per write, plus a 64-bit checksum
+ * over the encoded value and key. Works for any trivially copyable type up
+ * to 8 bytes (integers, floats, enums).
+ */
+template<typename T>
+struct TDeskillzProtectedValue
+{
+	static_assert(sizeof(T) <= sizeof(uint64), "TDeskillzProtectedValue supports types up to 8 bytes");
+
+	TDeskillzProtectedValue()
+	{
+		Keys.Seed(this);
+		Salt = Keys.Next();
+		Set(T());
+	}
+
+	T Get() const
+	{
+		// XOR decrypt
+		const uint64 Bits = Value ^ Key;
+		T Result;
+		FMemory::Memcpy(&Result, &Bits, sizeof(T));
+		return Result;
+	}
+
+	void Set(T NewValue)
+	{
+		uint64 Bits = 0;
+		FMemory::Memcpy(&Bits, &NewValue, sizeof(T));
+
+		// Generate new key
+		Key = Keys.Next();
+		Value = Bits ^ Key;
+
+		// Update checksum
+		StoredChecksum = CalculateChecksum();
+	}
+
+	bool Verify() const
+	{
+		return CalculateChecksum() == StoredChecksum;
+	}
+
+private:
+	uint64 Value = 0;
+	uint64 Key = 0;
+	uint64 Salt = 0;
+	uint64 StoredChecksum = 0;
+	FDeskillzProtectedKeyStream Keys;
+
+	uint64 CalculateChecksum() const
+	{
+		return FDeskillzProtectedKeyStream::Mix(FDeskillzProtectedKeyStream::Mix(Value ^ Salt) ^ Key);
+	}
+};
+
+/**
+ * Block of protected int64 values updated together
+ *
+ * For game state that changes as a unit (score, combo, lives, ...): one key
+ * draw and one checksum cover the whole block, so protecting more values
+ * adds an XOR and a mix per value rather than a full protected value each.
+ *
+ * Usage:
+ *   TDeskillzProtectedBlock<3> State;   // 0 = score, 1 = combo, 2 = lives
+ *   State.SetAll({ Score, Combo, Lives });
+ *   State.Set(1, Combo + 1);
+ *   if (!State.Verify()) { ... }
+ */
+template<int32 NumValues>
+struct TDeskillzProtectedBlock
+{
+	static_assert(NumValues > 0, "TDeskillzProtectedBlock needs at least one value");
+
+	TDeskillzProtectedBlock()
+	{
+		Keys.Seed(this);
+		Salt = Keys.Next();
+		Rekey();
+	}
+
+	int64 Get(int32 Index) const
+	{
+		check(Index >= 0 && Index < NumValues);
+		return static_cast<int64>(Values[Index] ^ SlotKey(Index));
+	}
+
+	/** Update one value (the whole block is re-keyed) */
+	void Set(int32 Index, int64 NewValue)
+	{
+		check(Index >= 0 && Index < NumValues);
+		int64 Plain[NumValues];
+		Decode(Plain);
+		Plain[Index] = NewValue;
+		Encode(Plain);
+	}
+
+	/** Update every value at once */
+	void SetAll(std::initializer_list<int64> NewValues)
+	{
+		check(static_cast<int32>(NewValues.size()) == NumValues);
+		int64 Plain[NumValues];
+		int32 Index = 0;
+		for (int64 NewValue : NewValues)
+		{
+			Plain[Index++] = NewValue;
+		}
+		Encode(Plain);
+	}
+
+	bool Verify() const
+	{
+		return CalculateChecksum() == StoredChecksum;
+	}
+
+private:
+	uint64 Values[NumValues] = {};
+	uint64 Key = 0;
+	uint64 Salt = 0;
+	uint64 StoredChecksum = 0;
+	FDeskillzProtectedKeyStream Keys;
+
+	/** Weyl-spaced per-slot keys from the block key */
+	uint64 SlotKey(int32 Index) const
+	{
+		return Key + static_cast<uint64>(Index) * 0x9e3779b97f4a7c15ull;
+	}
+
+	void Decode(int64 (&OutPlain)[NumValues]) const
+	{
+		for (int32 i = 0; i < NumValues; i++)
+		{
+			OutPlain[i] = static_cast<int64>(Values[i] ^ SlotKey(i));
+		}
+	}
+
+	void Encode(const int64 (&Plain)[NumValues])
+	{
+		Key = Keys.Next();
+		for (int32 i = 0; i < NumValues; i++)
+		{
+			Values[i] = static_cast<uint64>(Plain[i]) ^ SlotKey(i);
+		}
+		StoredChecksum = CalculateChecksum();
+	}
+
+	void Rekey()
+	{
+		int64 Zeros[NumValues] = {};
+		Encode(Zeros);
+	}
+
+	uint64 CalculateChecksum() const
+	{
+		uint64 Hash = Salt;
+		for (int32 i = 0; i < NumValues; i++)
+		{
+			Hash = FDeskillzProtectedKeyStream::Mix(Hash ^ Values[i]);
+		}
+		return FDeskillzProtectedKeyStream::Mix(Hash ^ Key);
+	}
+};
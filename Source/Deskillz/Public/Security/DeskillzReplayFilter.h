@@ -0,0 +1,208 @@
+// Copyright Deskillz Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Hash/CityHash.h"
+
+/**
+ * Bounded, time-windowed replay filter
+ *
+ * Remembers the most recent 64-bit nonce keys in a fixed ring (insertion
+ * order) indexed by an open-addressed hash table, so insert and lookup are
+ * O(1) and memory never grows after construction. Keys are forgotten once
+ * they are older than the window or pushed out by Capacity newer keys;
+ * callers should reject messages whose own timestamp falls outside the
+ * window rather than relying on the filter to remember them.
+ *
+ * Lookups are exact (no false positives), so a fresh nonce is never rejected.
+ *
+ * Usage:
+ *   FDeskillzReplayFilter Filter(1024, 300.0);
+ *   if (!Filter.CheckAndInsert(FDeskillzReplayFilter::HashNonce(Nonce), FPlatformTime::Seconds()))
+ *   {
+ *       // replayed
+ *   }
+ */
+class FDeskillzReplayFilter
+{
+public:
+	explicit FDeskillzReplayFilter(int32 InCapacity = 1024, double InWindowSeconds = 300.0)
+	{
+		Configure(InCapacity, InWindowSeconds);
+	}
+
+	/** Resize and clear (Capacity is rounded up to a power of two) */
+	void Configure(int32 InCapacity, double InWindowSeconds)
+	{
+		const int32 RingSize = FMath::RoundUpToPowerOfTwo(FMath::Max(InCapacity, 16));
+		WindowSeconds = FMath::Max(InWindowSeconds, 0.0);
+
+		Ring.SetNumZeroed(RingSize);
+		Table.SetNumZeroed(RingSize * 2);
+		Reset();
+	}
+
+	/** Forget every key */
+	void Reset()
+	{
+		FMemory::Memzero(Ring.GetData(), Ring.Num() * sizeof(FEntry));
+		FMemory::Memset(Table.GetData(), 0xff, Table.Num() * sizeof(int32));
+		Head = 0;
+		Count = 0;
+	}
+
+	/**
+	 * Record a key if it hasn't been seen inside the window
+	 * @return true if the key is new (and is now recorded), false for a replay
+	 */
+	bool CheckAndInsert(uint64 Key, double NowSeconds)
+	{
+		Key = NormalizeKey(Key);
+		Expire(NowSeconds);
+
+		if (FindSlot(Key) != INDEX_NONE)
+		{
+			return false;
+		}
+
+		// Evict the oldest entry when the ring is full
+		if (Count == Ring.Num())
+		{
+			EvictOldest();
+		}
+
+		const int32 RingIndex = (Head + Count) & (Ring.Num() - 1);
+		Ring[RingIndex].Key = Key;
+		Ring[RingIndex].Time = NowSeconds;
+		++Count;
+
+		int32 Slot = HomeSlot(Key);
+		while (Table[Slot] != INDEX_NONE)
+		{
+			Slot = (Slot + 1) & (Table.Num() - 1);
+		}
+		Table[Slot] = RingIndex;
+
+		return true;
+	}
+
+	/** Whether a key has been seen inside the window */
+	bool Contains(uint64 Key, double NowSeconds) const
+	{
+		const int32 Slot = FindSlot(NormalizeKey(Key));
+		return Slot != INDEX_NONE && NowSeconds - Ring[Table[Slot]].Time <= WindowSeconds;
+	}
+
+	/** Keys currently remembered */
+	int32 Num() const { return Count; }
+
+	/** Maximum keys remembered */
+	int32 GetCapacity() const { return Ring.Num(); }
+
+	/** How long keys are remembered (seconds) */
+	double GetWindowSeconds() const { return WindowSeconds; }
+
+	/** Fixed memory footprint (bytes) */
+	SIZE_T GetAllocatedSize() const { return Ring.GetAllocatedSize() + Table.GetAllocatedSize(); }
+
+	/** Hash a string nonce (e.g. Base64 or GUID text) to a filter key */
+	static uint64 HashNonce(const FString& Nonce)
+	{
+		return CityHash64(reinterpret_cast<const char*>(*Nonce), Nonce.Len() * sizeof(TCHAR));
+	}
+
+	/** Hash raw nonce bytes to a filter key */
+	static uint64 HashNonce(const uint8* Bytes, int32 NumBytes)
+	{
+		return CityHash64(reinterpret_cast<const char*>(Bytes), NumBytes);
+	}
+
+private:
+	struct FEntry
+	{
+		uint64 Key;
+		double Time;
+	};
+
+	/** Key 0 marks an empty ring entry */
+	static uint64 NormalizeKey(uint64 Key)
+	{
+		return Key != 0 ? Key : 1;
+	}
+
+	int32 HomeSlot(uint64 Key) const
+	{
+		// Keys are already hashes; fold the high bits in for small tables
+		return static_cast<int32>((Key ^ (Key >> 32)) & (Table.Num() - 1));
+	}
+
+	int32 FindSlot(uint64 Key) const
+	{
+		int32 Slot = HomeSlot(Key);
+		while (Table[Slot] != INDEX_NONE)
+		{
+			if (Ring[Table[Slot]].Key == Key)
+			{
+				return Slot;
+			}
+			Slot = (Slot + 1) & (Table.Num() - 1);
+		}
+		return INDEX_NONE;
+	}
+
+	void Expire(double NowSeconds)
+	{
+		while (Count > 0 && NowSeconds - Ring[Head].Time > WindowSeconds)
+		{
+			EvictOldest();
+		}
+	}
+
+	void EvictOldest()
+	{
+		const int32 Slot = FindSlot(Ring[Head].Key);
+		check(Slot != INDEX_NONE);
+		RemoveSlot(Slot);
+
+		Ring[Head].Key = 0;
+		Head = (Head + 1) & (Ring.Num() - 1);
+		--Count;
+	}
+
+	/** Linear-probe deletion with backward shift (no tombstones) */
+	void RemoveSlot(int32 Slot)
+	{
+		const int32 Mask = Table.Num() - 1;
+		int32 Hole = Slot;
+		int32 Next = (Hole + 1) & Mask;
+
+		while (Table[Next] != INDEX_NONE)
+		{
+			const int32 Home = HomeSlot(Ring[Table[Next]].Key);
+
+			// Move the entry back if its home isn't in the cyclic range (Hole, Next]
+			const bool bHomeInRange = (Hole <= Next)
+				? (Home > Hole && Home <= Next)
+				: (Home > Hole || Home <= Next);
+			if (!bHomeInRange)
+			{
+				Table[Hole] = Table[Next];
+				Hole = Next;
+			}
+			Next = (Next + 1) & Mask;
+		}
+
+		Table[Hole] = INDEX_NONE;
+	}
+
+	/** Keys in insertion order; Head is the oldest */
+	TArray<FEntry> Ring;
+
+	/** Open-addressed index into Ring (2x Ring size keeps probes short) */
+	TArray<int32> Table;
+
+	int32 Head = 0;
+	int32 Count = 0;
+	double WindowSeconds = 300.0;
+};
@@ -0,0 +1,128 @@
+// Copyright Deskillz Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "DeskillzReplayRecorder.generated.h"
+
+/**
+ * Deskillz Replay Recorder
+ *
+ * Opt-in compact recording of a match for server-side re-simulation:
+ * - Random seed and start time header
+ * - Timestamped inputs (type, position) and score changes
+ * - Delta + varint encoding (a typical tap is 4-6 bytes)
+ * - Fixed-size chunk buffers under a hard memory cap; recording stops
+ *   (and the stream is flagged truncated) when the cap is reached
+ * - Zlib-compressed on finish for upload alongside the encrypted score
+ *
+ * Stream layout (all integers are LEB128 varints, signed ones zigzagged):
+ *   Header:  "DZRP" | version u8 | randomSeed s | startUnixMs u | matchId (len u + UTF-8)
+ *   Event:   tag u8 (type | NewInputType flag) | deltaMs u | payload
+ *            Input: [len u + UTF-8 if new type] typeId u | dX s | dY s
+ *            Score: dScore s
+ *   Trailer: 0 u8 | flags u8 (bit 0 = truncated) | eventCount u
+ * Finished output: uncompressed size u32 LE | zlib data
+ *
+ * Usage:
+ *   Recorder->BeginRecording(MatchId, RandomSeed, 256 * 1024);
+ *   Recorder->RecordInput(TEXT("tap"), Position);
+ *   Recorder->RecordScore(Score);
+ *   TArray<uint8> Replay = Recorder->FinishRecording();
+ */
+UCLASS(BlueprintType)
+class DESKILLZ_API UDeskillzReplayRecorder : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UDeskillzReplayRecorder();
+
+	// ========================================================================
+	// Recording
+	// ========================================================================
+
+	/**
+	 * Start recording a match
+	 * @param MatchId Match being recorded
+	 * @param RandomSeed Match random seed (needed to re-simulate)
+	 * @param MaxBytes Memory cap for the uncompressed stream
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Deskillz|Security")
+	void BeginRecording(const FString& MatchId, int64 RandomSeed, int32 MaxBytes);
+
+	/**
+	 * Record an input event
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Deskillz|Security")
+	void RecordInput(const FString& InputType, FVector2D Position);
+
+	/**
+	 * Record the current score (no-op if unchanged)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Deskillz|Security")
+	void RecordScore(int64 Score);
+
+	/**
+	 * Stop recording and return the compressed stream (empty if not recording)
+	 */
+	TArray<uint8> FinishRecording();
+
+	/**
+	 * Discard any recording in progress
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Deskillz|Security")
+	void Reset();
+
+	// ========================================================================
+	// State
+	// ========================================================================
+
+	UFUNCTION(BlueprintPure, Category = "Deskillz|Security")
+	bool IsRecording() const { return bIsRecording; }
+
+	/** Hit the memory cap and stopped recording events */
+	UFUNCTION(BlueprintPure, Category = "Deskillz|Security")
+	bool IsTruncated() const { return bTruncated; }
+
+	/** Uncompressed bytes recorded so far */
+	UFUNCTION(BlueprintPure, Category = "Deskillz|Security")
+	int32 GetRecordedBytes() const { return RecordedBytes; }
+
+	/** Events recorded so far */
+	UFUNCTION(BlueprintPure, Category = "Deskillz|Security")
+	int32 GetEventCount() const { return EventCount; }
+
+private:
+	/** Encoded stream, in fixed-size chunks so growth never copies */
+	TArray<TArray<uint8>> Chunks;
+
+	/** Input type string table (id = order of first use) */
+	TMap<FString, int32> InputTypeIds;
+
+	/** Memory cap for the uncompressed stream */
+	int32 MaxRecordedBytes = 0;
+
+	int32 RecordedBytes = 0;
+	int32 EventCount = 0;
+
+	/** Previous event values (delta base) */
+	double StartTime = 0.0;
+	int64 LastEventMs = 0;
+	int32 LastX = 0;
+	int32 LastY = 0;
+	int64 LastScore = 0;
+
+	bool bIsRecording = false;
+	bool bTruncated = false;
+
+	/** Append encoded bytes, starting new chunks as needed */
+	void Append(const uint8* Data, int32 Num);
+
+	/** Check the cap before writing an event; stops recording if it would overflow */
+	bool ReserveEvent(int32 MaxEventBytes);
+
+	/** Milliseconds since the previous event (and advance the base) */
+	uint64 ConsumeDeltaMs();
+};
@@ -4,8 +4,11 @@
 
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
+#include "Security/DeskillzReplayFilter.h"
 #include "DeskillzScoreEncryption.generated.h"
 
+class FJsonObject;
+
 /**
  * Encrypted score payload structure
  * Contains all data needed to verify and decrypt a score
@@ -51,6 +54,10 @@ struct DESKILLZ_API FDeskillzEncryptedScore
 	UPROPERTY(BlueprintReadOnly, Category = "Deskillz|Security")
 	int32 Version = 1;
 	
+	/** Base64 compressed match replay (optional, see UDeskillzReplayRecorder) */
+	UPROPERTY(BlueprintReadOnly, Category = "Deskillz|Security")
+	FString Replay;
+	
 	/** Check if this is a valid encrypted score */
 	bool IsValid() const
 	{
@@ -64,6 +71,9 @@ struct DESKILLZ_API FDeskillzEncryptedScore
 	/** Convert to JSON for transmission */
 	FString ToJson() const;
 	
+	/** Convert to a JSON object (for embedding in a larger request) */
+	TSharedRef<FJsonObject> ToJsonObject() const;
+	
 	/** Parse from JSON response */
 	static FDeskillzEncryptedScore FromJson(const FString& JsonString);
 };
@@ -111,8 +121,17 @@ struct DESKILLZ_API FDeskillzScoreIntegrity
 	/** Checksum of all score updates */
 	UPROPERTY(BlueprintReadOnly, Category = "Deskillz|Security")
 	FString ScoreTrailHash;
+	
+	/** SHA-256 of the attached replay bytes (empty if none); binds the replay to the signed score */
+	UPROPERTY(BlueprintReadOnly, Category = "Deskillz|Security")
+	FString ReplayHash;
 };
 
+/** Completion callback for EncryptScoreAsync (called on the game thread) */
+DECLARE_DELEGATE_OneParam(FOnScoreEncrypted, const FDeskillzEncryptedScore&);
+
+class FDeskillzScoreCipher;
+
 /**
  * Deskillz Score Encryption System
  * 
@@ -124,6 +143,10 @@ struct DESKILLZ_API FDeskillzScoreIntegrity
  * - Score trail hashing
  * 
  * All encryption keys are derived server-side and rotated regularly.
+ * 
+ * The cipher context and device fingerprint are prepared once in Initialize.
+ * EncryptScoreAsync snapshots the payload on the game thread and runs the
+ * AES-GCM + HMAC step on a background thread, so match end doesn't hitch.
  */
 UCLASS(BlueprintType)
 class DESKILLZ_API UDeskillzScoreEncryption : public UObject
@@ -182,6 +205,22 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Deskillz|Security")
 	FDeskillzEncryptedScore EncryptScoreSimple(int64 Score);
 	
+	/**
+	 * Encrypt and sign a score on a background thread
+	 * @param Score The score value to encrypt
+	 * @param Integrity Additional integrity data for verification
+	 * @param OnComplete Called on the game thread; the payload is invalid on failure
+	 */
+	void EncryptScoreAsync(int64 Score, const FDeskillzScoreIntegrity& Integrity, FOnScoreEncrypted OnComplete);
+	
+	/**
+	 * Encrypt a score with automatically collected integrity data on a background thread
+	 * @param Score The score value to encrypt
+	 * @param OnComplete Called on the game thread; the payload is invalid on failure
+	 * @param ReplayHash HashBytesSHA256 of the replay sent with the score, if any
+	 */
+	void EncryptScoreSimpleAsync(int64 Score, FOnScoreEncrypted OnComplete, const FString& ReplayHash = FString());
+	
 	/**
 	 * Verify an encrypted score's signature locally
 	 * @param EncryptedScore The score to verify
@@ -190,6 +229,15 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Deskillz|Security")
 	bool VerifySignature(const FDeskillzEncryptedScore& EncryptedScore) const;
 	
+	/** Whether a signing key is loaded */
+	bool HasSigningKey() const;
+	
+	/**
+	 * HMAC an arbitrary payload with the signing key
+	 * @return Base64 signature, or empty if no signing key is loaded
+	 */
+	FString SignPayload(const FString& Payload) const;
+	
 	// ========================================================================
 	// Score Trail (Anti-Cheat)
 	// ========================================================================
@@ -266,6 +314,11 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Deskillz|Security")
 	static FString HashSHA256(const FString& Data);
 	
+	/**
+	 * Hash raw bytes using SHA-256 (lowercase hex)
+	 */
+	static FString HashBytesSHA256(const TArray<uint8>& Bytes);
+	
 	/**
 	 * Encode bytes to Base64
 	 */
@@ -277,7 +330,23 @@ public:
 	 */
 	UFUNCTION(BlueprintPure, Category = "Deskillz|Security")
 	static TArray<uint8> FromBase64(const FString& Base64String);
-	
+
+	// ========================================================================
+	// Local Storage
+	// ========================================================================
+
+	/**
+	 * Encrypt data for on-device storage with a device-bound key (thread safe)
+	 * @return version u8 | IV (12) | auth tag (16) | ciphertext, empty on failure
+	 */
+	static TArray<uint8> SealLocalData(const TArray<uint8>& Plaintext);
+
+	/**
+	 * Decrypt SealLocalData output (thread safe)
+	 * @return false if the data is corrupt, tampered with or from another device
+	 */
+	static bool OpenLocalData(const TArray<uint8>& Sealed, TArray<uint8>& OutPlaintext);
+
 private:
 	// ========================================================================
 	// Internal State
@@ -286,20 +355,27 @@ private:
 	/** Is encryption initialized with valid keys */
 	bool bIsInitialized = false;
 	
-	/** AES-256 encryption key (32 bytes) */
-	TArray<uint8> EncryptionKey;
-	
-	/** HMAC signing key */
-	TArray<uint8> SigningKey;
+	/** AES-256-GCM context and keys, shared with in-flight encrypt tasks */
+	TSharedPtr<FDeskillzScoreCipher, ESPMode::ThreadSafe> Cipher;
 	
 	/** Current match ID */
 	FString CurrentMatchId;
 	
+	/** Device fingerprint, computed once */
+	mutable FString CachedDeviceFingerprint;
+	
 	/** Score update trail for integrity verification */
 	TArray<TPair<int64, int64>> ScoreTrail; // Timestamp, Score
 	
-	/** Running hash of score trail */
-	FString RunningScoreHash;
+	/**
+	 * Running hash of the score/input trail
+	 * SHA-256 chain over fixed-layout binary records: State = SHA256(State || Record).
+	 * Hex encoded only when read.
+	 */
+	uint8 ScoreChainState[32] = {};
+	
+	/** Whether any record has been chained yet */
+	bool bHasScoreChain = false;
 	
 	/** Input event count */
 	int32 InputEventCount = 0;
@@ -313,35 +389,50 @@ private:
 	/** FPS samples for average */
 	TArray<float> FPSSamples;
 	
-	/** Used nonces to prevent replay */
-	TSet<FString> UsedNonces;
+	/** Recently issued nonces (bounded) to prevent reuse */
+	FDeskillzReplayFilter UsedNonces{ 256, 3600.0 };
 	
 	// ========================================================================
 	// Internal Methods
 	// ========================================================================
 	
-	/** AES-256-GCM encryption */
-	bool AES256GCMEncrypt(
-		const TArray<uint8>& Plaintext,
-		const TArray<uint8>& Key,
-		const TArray<uint8>& IV,
-		const TArray<uint8>& AAD,
-		TArray<uint8>& Ciphertext,
-		TArray<uint8>& AuthTag
-	);
-	
-	/** HMAC-SHA256 signature */
-	TArray<uint8> HMACSHA256(const TArray<uint8>& Data, const TArray<uint8>& Key);
-	
 	/** Generate random IV for AES-GCM (12 bytes) */
-	TArray<uint8> GenerateIV();
+	static TArray<uint8> GenerateIV();
 	
 	/** Build payload for signing */
-	FString BuildSigningPayload(const FString& EncryptedData, const FString& IV, int64 Timestamp, const FString& Nonce);
+	static FString BuildSigningPayload(const FString& EncryptedData, const FString& IV, int64 Timestamp, const FString& Nonce, const FString& MatchId);
+	
+	/** Serialize integrity data to the fixed binary plaintext layout */
+	static TArray<uint8> BuildPlaintext(int64 Score, const FDeskillzScoreIntegrity& Integrity);
+	
+	/** Game-thread half of encryption: snapshot everything the background step needs */
+	struct FPendingScore
+	{
+		TArray<uint8> Plaintext;
+		TArray<uint8> IV;
+		TArray<uint8> AAD;
+		FString Nonce;
+		FString MatchId;
+		FString DeviceFingerprint;
+		int64 Timestamp = 0;
+	};
+	bool PrepareScore(int64 Score, const FDeskillzScoreIntegrity& Integrity, FPendingScore& OutPending);
+	
+	/** Thread-safe half of encryption: AES-GCM, HMAC and Base64 */
+	static FDeskillzEncryptedScore EncryptPendingScore(const FDeskillzScoreCipher& InCipher, const FPendingScore& Pending);
+	
+	/** Build fingerprint from device characteristics */
+	static FString ComputeDeviceFingerprint();
 	
 	/** Update running score hash */
 	void UpdateScoreHash(int64 Score, int64 Timestamp);
 	
+	/** Chain a binary record (plus optional UTF-8 strings) into the running score hash */
+	void ChainScoreRecord(const uint8* Record, int32 RecordSize, const FString* TextA = nullptr, const FString* TextB = nullptr);
+	
+	/** Clear the running score hash */
+	void ResetScoreChain();
+	
 	/** Collect current integrity data */
 	FDeskillzScoreIntegrity CollectIntegrityData(int64 FinalScore);
 };
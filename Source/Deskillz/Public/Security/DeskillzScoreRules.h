@@ -0,0 +1,191 @@
+// Copyright Deskillz Games. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DeskillzScoreRules.generated.h"
+
+class FJsonObject;
+
+/**
+ * Score rules broken by a score or score update (bit flags)
+ */
+enum class EDeskillzScoreRule : uint32
+{
+	None			= 0,
+
+	/** Below the minimum score */
+	BelowMinimum	= 1 << 0,
+
+	/** Above the maximum score */
+	AboveMaximum	= 1 << 1,
+
+	/** Decreased by more than allowed (any decrease when monotonic) */
+	Decrease		= 1 << 2,
+
+	/** Single update larger than the maximum jump */
+	Jump			= 1 << 3,
+
+	/** Faster than the maximum score rate */
+	Rate			= 1 << 4,
+
+	OutOfRange		= BelowMinimum | AboveMaximum
+};
+ENUM_CLASS_FLAGS(EDeskillzScoreRule);
+
+/**
+ * Declarative score validation rules for a game or tournament
+ *
+ * Delivered by the game config ("scoreRules", with per-tournament overrides
+ * in "tournamentScoreRules"); defaults come from UDeskillzConfig.
+ * Zero disables a limit.
+ */
+USTRUCT(BlueprintType)
+struct DESKILLZ_API FDeskillzScoreRules
+{
+	GENERATED_BODY()
+
+	/** Lowest valid score */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deskillz|Security")
+	int64 MinScore = 0;
+
+	/** Highest valid score */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deskillz|Security")
+	int64 MaxScore = 999999999;
+
+	/** Maximum points gained per second between updates (0 = no limit) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deskillz|Security")
+	float MaxScorePerSecond = 1000.0f;
+
+	/** Maximum points gained in a single update (0 = no limit) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deskillz|Security")
+	int64 MaxScoreJump = 0;
+
+	/** Maximum points lost in a single update, e.g. penalties (0 = no limit) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deskillz|Security")
+	int64 MaxScoreDecrease = 1000;
+
+	/** Score may never decrease */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deskillz|Security")
+	bool bMonotonic = false;
+
+	/** Record a score checkpoint at least this often during a match (0 = only on events) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deskillz|Security")
+	float CheckpointIntervalSeconds = 0.0f;
+
+	/** Defaults from UDeskillzConfig */
+	static FDeskillzScoreRules FromConfig();
+
+	/** Override fields present in a rules JSON object */
+	static FDeskillzScoreRules FromJson(const TSharedPtr<FJsonObject>& Json, const FDeskillzScoreRules& Base);
+};
+
+/**
+ * Score rules compiled into flat thresholds
+ *
+ * Disabled limits become sentinel values, so every check is a handful of
+ * branch-predictable comparisons with no lookups or division; cheap enough
+ * to run on every score update.
+ *
+ * The active validator is shared by the SDK, match manager, anti-cheat and
+ * submitter so they all apply the same rules (game thread only).
+ *
+ * Usage:
+ *   const FDeskillzScoreValidator& Rules = FDeskillzScoreValidator::GetActive();
+ *   EDeskillzScoreRule Broken = Rules.CheckUpdate(LastScore, NewScore, DeltaSeconds);
+ */
+class DESKILLZ_API FDeskillzScoreValidator
+{
+public:
+	FDeskillzScoreValidator() : FDeskillzScoreValidator(FDeskillzScoreRules()) {}
+	explicit FDeskillzScoreValidator(const FDeskillzScoreRules& Rules);
+
+	/** Rules broken by a score value */
+	EDeskillzScoreRule CheckRange(int64 Score) const
+	{
+		EDeskillzScoreRule Result = EDeskillzScoreRule::None;
+		if (Score < MinScore)
+		{
+			Result |= EDeskillzScoreRule::BelowMinimum;
+		}
+		if (Score > MaxScore)
+		{
+			Result |= EDeskillzScoreRule::AboveMaximum;
+		}
+		return Result;
+	}
+
+	/** Rules broken by a score update */
+	EDeskillzScoreRule CheckUpdate(int64 PreviousScore, int64 NewScore, double ElapsedSeconds) const
+	{
+		EDeskillzScoreRule Result = CheckRange(NewScore);
+
+		// Compare magnitudes unsigned; the signed difference of extreme scores overflows
+		const uint64 Change = Distance(PreviousScore, NewScore);
+		if (NewScore < PreviousScore)
+		{
+			if (Change > static_cast<uint64>(MaxDecrease))
+			{
+				Result |= EDeskillzScoreRule::Decrease;
+			}
+			return Result;
+		}
+
+		if (Change > static_cast<uint64>(MaxJump))
+		{
+			Result |= EDeskillzScoreRule::Jump;
+		}
+		if (ElapsedSeconds > 0.0 && static_cast<double>(Change) > MaxRate * ElapsedSeconds)
+		{
+			Result |= EDeskillzScoreRule::Rate;
+		}
+		return Result;
+	}
+
+	/** Absolute difference between two scores (exact for any pair, including INT64_MIN) */
+	static uint64 Distance(int64 A, int64 B)
+	{
+		return A < B ? static_cast<uint64>(B) - static_cast<uint64>(A) : static_cast<uint64>(A) - static_cast<uint64>(B);
+	}
+
+	/** Clamp a score into the valid range */
+	int64 ClampScore(int64 Score) const
+	{
+		return FMath::Clamp(Score, MinScore, MaxScore);
+	}
+
+	/** Whether a periodic checkpoint is due */
+	bool IsCheckpointDue(double SecondsSinceCheckpoint) const
+	{
+		return SecondsSinceCheckpoint >= CheckpointInterval;
+	}
+
+	/** Source rules */
+	const FDeskillzScoreRules& GetRules() const { return Rules; }
+
+	/** Human-readable list of broken rules (for logs and violation reports) */
+	static FString Describe(EDeskillzScoreRule Broken);
+
+	// ========================================================================
+	// Active Rules
+	// ========================================================================
+
+	/** Rules for the current game and tournament */
+	static const FDeskillzScoreValidator& GetActive();
+
+	/** Apply "scoreRules" / "tournamentScoreRules" from a GetGameConfig response */
+	static void ApplyGameConfig(const TSharedPtr<FJsonObject>& GameConfig);
+
+	/** Switch to a tournament's rules (empty or unknown = game rules) */
+	static void SelectTournament(const FString& TournamentId);
+
+private:
+	FDeskillzScoreRules Rules;
+
+	int64 MinScore;
+	int64 MaxScore;
+	int64 MaxDecrease;
+	int64 MaxJump;
+	double MaxRate;
+	double CheckpointInterval;
+};
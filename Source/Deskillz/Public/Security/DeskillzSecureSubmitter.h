@@ -5,9 +5,11 @@
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
 #include "Security/DeskillzScoreEncryption.h"
+#include "Network/DeskillzNetworkManager.h"
 #include "DeskillzSecureSubmitter.generated.h"
 
 class UDeskillzSDK;
+class IHttpRequest;
 
 /**
  * Score submission status
@@ -99,6 +101,9 @@ struct FDeskillzQueuedSubmission
 {
 	GENERATED_BODY()
 	
+	/** Local identity (stable across app restarts) */
+	FGuid Id;
+	
 	/** Encrypted score payload */
 	FDeskillzEncryptedScore EncryptedScore;
 	
@@ -133,7 +138,10 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnScoreSubmissionProgress, int64
  * Handles the secure submission of encrypted scores:
  * - Encryption via UDeskillzScoreEncryption
  * - Automatic retries with exponential backoff
- * - Offline queueing for poor connectivity
+ * - Offline queueing for poor connectivity, persisted encrypted on disk
+ *   and retried when the network comes back
+ * - Queue draining in one batch request with per-item results (or bounded
+ *   parallel requests when the server has no batch endpoint)
  * - Server-side verification
  * - Integrity validation
  * 
@@ -179,14 +187,26 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deskillz|Security")
 	float SubmissionTimeout = 15.0f;
 	
-	/** Enable offline queueing */
+	/** Enable offline queueing (stored on disk so scores survive app restarts) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deskillz|Security")
 	bool bEnableOfflineQueue = true;
 	
-	/** Maximum queued submissions */
+	/** Maximum queued submissions (further scores are reported as failed, queued ones are never evicted) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deskillz|Security")
 	int32 MaxQueuedSubmissions = 10;
 	
+	/** Send queued submissions together in one batch request */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deskillz|Security")
+	bool bEnableBatchSubmission = true;
+	
+	/** Maximum submissions per batch request */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deskillz|Security")
+	int32 MaxBatchSize = 20;
+	
+	/** Concurrent requests when draining the queue without batching */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deskillz|Security")
+	int32 MaxParallelSubmissions = 3;
+	
 	// ========================================================================
 	// Events
 	// ========================================================================
@@ -220,6 +240,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Deskillz|Security")
 	void SubmitScoreWithIntegrity(int64 Score, const FDeskillzScoreIntegrity& Integrity);
 	
+	/**
+	 * Attach a compressed match replay to the next submitted score
+	 * @param ReplayData Output of UDeskillzReplayRecorder::FinishRecording
+	 */
+	void AttachReplay(const TArray<uint8>& ReplayData);
+	
 	/**
 	 * Cancel pending submission
 	 */
@@ -320,7 +346,16 @@ protected:
 	/** Current submission being processed */
 	FDeskillzQueuedSubmission CurrentSubmission;
 	
-	/** Queue of pending submissions */
+	/** Bumped per encrypt and on cancel; stale encrypt callbacks are ignored */
+	int32 EncryptionSerial = 0;
+	
+	/** Base64 replay for the next submission */
+	FString PendingReplay;
+	
+	/** SHA-256 of the pending replay bytes, sealed into the encrypted score */
+	FString PendingReplayHash;
+	
+	/** Queue of pending submissions (mirrored to disk by SaveQueue) */
 	TArray<FDeskillzQueuedSubmission> SubmissionQueue;
 	
 	/** Encryption instance */
@@ -337,6 +372,21 @@ protected:
 	/** Timeout timer handle */
 	FTimerHandle TimeoutTimerHandle;
 	
+	/** Re-drain timer after a drain left scores unsent */
+	FTimerHandle DrainRetryTimerHandle;
+	
+	/** Queued submissions with a request in flight */
+	TSet<FGuid> InFlightQueued;
+	
+	/** Start of the current drain; entries attempted since then are skipped */
+	int64 DrainStartedAt = 0;
+	
+	/** A queued submission failed during the current drain */
+	bool bDrainHadFailures = false;
+	
+	/** Server has no batch endpoint; drain with parallel requests instead */
+	bool bBatchUnsupported = false;
+	
 	// ========================================================================
 	// Internal Methods
 	// ========================================================================
@@ -344,9 +394,36 @@ protected:
 	/** Initialize with SDK */
 	void Initialize(UDeskillzSDK* InSDK);
 	
-	/** Process the submission queue */
+	/** Start draining the submission queue */
 	void ProcessQueue();
 	
+	/** Send the next queued submissions (batch, or parallel up to the limit) */
+	void ContinueDrain();
+	
+	/** Queued entry that should be sent in the current drain */
+	bool IsDrainCandidate(const FDeskillzQueuedSubmission& Entry) const;
+	
+	/** Send queued submissions in one envelope */
+	void SendBatch(const TArray<FGuid>& Ids);
+	
+	/** Handle per-item batch results */
+	void HandleBatchResponse(const TArray<FGuid>& Ids, int32 HttpStatus, const FString& Response);
+	
+	/** Send one queued submission (parallel fallback) */
+	void SendQueuedSubmission(const FGuid& Id);
+	
+	/** Apply a server answer to a queued submission */
+	void FinishQueuedSubmission(const FGuid& Id, int32 HttpStatus, const TSharedPtr<FJsonObject>& JsonObject);
+	
+	/** Remove (final answer) or keep (network failure) a queued submission and report it */
+	void CompleteQueuedSubmission(int32 Index, FDeskillzSubmissionResult Result);
+	
+	/** Score API POST request with auth headers */
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> CreateScoreRequest(const FString& Path) const;
+	
+	/** Map a score API answer to a submission result */
+	static FDeskillzSubmissionResult ParseSubmissionResult(int32 HttpStatus, const TSharedPtr<FJsonObject>& JsonObject, int64 OriginalScore);
+	
 	/** Send submission to server */
 	void SendSubmission(const FDeskillzQueuedSubmission& Submission);
 	
@@ -365,8 +442,24 @@ protected:
 	/** Complete the current submission */
 	void CompleteSubmission(const FDeskillzSubmissionResult& Result);
 	
-	/** Add to offline queue */
-	void QueueSubmission(const FDeskillzQueuedSubmission& Submission);
+	/** Add to offline queue; when full, the entry is refused and reported as failed */
+	bool QueueSubmission(const FDeskillzQueuedSubmission& Submission);
+	
+	/** Index of a queued submission, or INDEX_NONE */
+	int32 FindQueuedSubmission(const FGuid& Id) const;
+	
+	/** Write the queue to disk (encrypted, write-then-rename) */
+	void SaveQueue() const;
+	
+	/** Restore queued submissions saved by a previous session */
+	void LoadQueue();
+	
+	/** On-disk queue location */
+	static FString GetQueueFilePath();
+	
+	/** Retry queued submissions when HTTP comes back */
+	UFUNCTION()
+	void HandleNetworkStateChanged(EDeskillzNetworkState NewState);
 	
 	friend class UDeskillzSDK;
 };
@@ -7,6 +7,7 @@
 #include "Security/DeskillzScoreEncryption.h"
 #include "Security/DeskillzSecureSubmitter.h"
 #include "Security/DeskillzAntiCheat.h"
+#include "Security/DeskillzReplayRecorder.h"
 #include "DeskillzSecurityModule.generated.h"
 
 /**
@@ -58,6 +59,7 @@ struct DESKILLZ_API FDeskillzSecurityStatus
  * - Secure score submission with retries
  * - Anti-cheat detection and prevention
  * - Device integrity validation
+ * - Optional match replay recording (UDeskillzConfig::bEnableReplayRecording)
  * 
  * This is the recommended way to interact with security features.
  * 
@@ -96,9 +98,10 @@ public:
 	 * @param MatchId The match identifier
 	 * @param EncryptionKey Base64 encoded AES-256 key from server
 	 * @param SigningKey Base64 encoded HMAC key from server
+	 * @param RandomSeed Match random seed (recorded in the replay header)
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Deskillz|Security")
-	void InitializeForMatch(const FString& MatchId, const FString& EncryptionKey, const FString& SigningKey);
+	void InitializeForMatch(const FString& MatchId, const FString& EncryptionKey, const FString& SigningKey, int64 RandomSeed = 0);
 	
 	/**
 	 * End match and reset security state
@@ -219,6 +222,12 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Deskillz|Security")
 	UDeskillzAntiCheat* GetAntiCheat() const { return AntiCheat; }
 	
+	/**
+	 * Get replay recorder component (for advanced usage)
+	 */
+	UFUNCTION(BlueprintPure, Category = "Deskillz|Security")
+	UDeskillzReplayRecorder* GetReplayRecorder() const { return ReplayRecorder; }
+	
 protected:
 	// ========================================================================
 	// Internal State
@@ -245,6 +254,10 @@ protected:
 	UPROPERTY()
 	UDeskillzAntiCheat* AntiCheat;
 	
+	/** Replay recorder component */
+	UPROPERTY()
+	UDeskillzReplayRecorder* ReplayRecorder;
+	
 	// ========================================================================
 	// Internal Methods
 	// ========================================================================
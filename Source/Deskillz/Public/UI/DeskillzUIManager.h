@@ -398,6 +398,21 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Deskillz|UI")
 	void SetUIInputMode(bool bUIOnly);
 	
+	// ========================================================================
+	// Memory
+	// ========================================================================
+	
+	/**
+	 * Get estimated memory held by cached widgets (bytes)
+	 */
+	int64 GetWidgetMemoryBytes() const;
+	
+	/**
+	 * Release cached widgets that are not on screen
+	 * They are recreated the next time they are shown.
+	 */
+	void ReleaseHiddenWidgets();
+	
 protected:
 	// ========================================================================
 	// Widget Instances
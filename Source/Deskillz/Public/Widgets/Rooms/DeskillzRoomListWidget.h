@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
 #include "Rooms/DeskillzRoomTypes.h"
+#include "Core/DeskillzSearchIndex.h"
 #include "DeskillzRoomListWidget.generated.h"
 
 class UScrollBox;
@@ -16,17 +17,6 @@ class UDeskillzRoomCardWidget;
 class UVerticalBox;
 class UThrobber;
 
-/** Sort options for room list */
-UENUM(BlueprintType)
-enum class ERoomSortOption : uint8
-{
-	Newest UMETA(DisplayName = "Newest First"),
-	EntryFeeAsc UMETA(DisplayName = "Entry Fee: Low to High"),
-	EntryFeeDesc UMETA(DisplayName = "Entry Fee: High to Low"),
-	PlayersAsc UMETA(DisplayName = "Players: Low to High"),
-	PlayersDesc UMETA(DisplayName = "Players: High to Low")
-};
-
 /** Delegate for room selection */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnRoomSelectedDelegate, const FPrivateRoom&, Room);
 
@@ -57,11 +47,25 @@ public:
 	// =========================================================================
 
 	/**
-	 * Refresh the room list from server
+	 * Refresh the room list from server.
+	 * Fetches only rooms changed since the last load when search and sort
+	 * are unchanged; otherwise reloads the first page.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Deskillz|Rooms|UI")
 	void RefreshRooms();
 
+	/**
+	 * Append the next page of rooms (no-op on the last page)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Deskillz|Rooms|UI")
+	void LoadMoreRooms();
+
+	/**
+	 * Check if more pages are available
+	 */
+	UFUNCTION(BlueprintPure, Category = "Deskillz|Rooms|UI")
+	bool HasMoreRooms() const { return !NextCursor.IsEmpty(); }
+
 	/**
 	 * Show the widget
 	 */
@@ -157,18 +161,54 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deskillz|Rooms|UI|Settings")
 	TSubclassOf<UDeskillzRoomCardWidget> RoomCardClass;
 
+	/** Rooms requested per page */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deskillz|Rooms|UI|Settings", meta = (ClampMin = "1", ClampMax = "100"))
+	int32 PageSize;
+
+	/** Delay after the last keystroke before searching the server */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deskillz|Rooms|UI|Settings", meta = (ClampMin = "0.0"))
+	float SearchDebounceSeconds;
+
+	/** Load the next page when scrolled within this distance of the end */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deskillz|Rooms|UI|Settings", meta = (ClampMin = "0.0"))
+	float LoadMoreScrollThreshold;
+
 	// =========================================================================
 	// State
 	// =========================================================================
 
-	/** Cached room list */
+	/** Loaded rooms, in display order when server-queried */
 	UPROPERTY()
 	TArray<FPrivateRoom> Rooms;
 
-	/** Active room card widgets */
+	/** Active room card widgets, in display order */
 	UPROPERTY()
 	TArray<UDeskillzRoomCardWidget*> RoomCards;
 
+	/** Room ID -> card (cards are owned by RoomCards) */
+	TMap<FString, UDeskillzRoomCardWidget*> RoomCardsById;
+
+	/** Search and sort the loaded rooms were queried with */
+	FRoomListQuery LoadedQuery;
+
+	/** Cursor for the next page (empty = last page) */
+	FString NextCursor;
+
+	/** List version of the last response (0 = nothing loaded) */
+	int64 ListVersion;
+
+	/** Server applied search and sort (false = filter locally) */
+	bool bServerQueried;
+
+	/** Incremented per request; responses to superseded requests are dropped */
+	uint32 RequestSerial;
+
+	/** Pending search debounce */
+	FTimerHandle SearchDebounceHandle;
+
+	/** Type-to-filter index over loaded rooms (name, code, host, game) */
+	FDeskillzSearchIndex RoomSearchIndex;
+
 	/** Current search filter */
 	FString SearchFilter;
 
@@ -188,20 +228,38 @@ protected:
 	/** Initialize UI bindings */
 	void InitializeUI();
 
-	/** Apply filters and sort to room list */
+	/** Build a query for the current search and sort */
+	FRoomListQuery MakeQuery() const;
+
+	/** Request a page (first page, next page or delta) */
+	void RequestPage(const FRoomListQuery& Query, bool bAppend);
+
+	/** Merge a received page into the loaded rooms */
+	void HandlePage(const FRoomListPage& Page, bool bAppend);
+
+	/** Drop loaded rooms and load the first page for the current query */
+	void ReloadRooms();
+
+	/** Re-sync the search index with the loaded rooms */
+	void SyncSearchIndex();
+
+	/** Show loaded rooms matching the current search, ranked, until the server answers */
 	void ApplyFiltersAndSort();
 
-	/** Update room card display */
+	/** Reconcile room cards with the given rooms, reusing cards by room ID */
 	void UpdateRoomCards(const TArray<FPrivateRoom>& FilteredRooms);
 
+	/** Sort rooms the way the server does for a sort option */
+	static void SortRooms(TArray<FPrivateRoom>& InOutRooms, ERoomSortOption SortOption);
+
 	/** Create a room card widget */
 	UDeskillzRoomCardWidget* CreateRoomCard(const FPrivateRoom& Room);
 
 	/** Clear all room cards */
 	void ClearRoomCards();
 
-	/** Set loading state */
-	void SetLoading(bool bLoading);
+	/** Set loading state (background loads keep the list visible) */
+	void SetLoading(bool bLoading, bool bBlocking = true);
 
 	/** Show/hide empty state */
 	void ShowEmptyState(bool bShow);
@@ -222,6 +280,9 @@ protected:
 	UFUNCTION()
 	void OnSortSelectionChanged(FString SelectedItem, ESelectInfo::Type SelectionType);
 
+	UFUNCTION()
+	void OnRoomListScrolled(float CurrentOffset);
+
 	UFUNCTION()
 	void OnCreateRoomButtonClicked();
 
@@ -246,6 +246,9 @@ protected:
 	UPROPERTY()
 	TArray<UDeskillzRoomPlayerCard*> PlayerCards;
 
+	/** Player ID -> card (cards are owned by PlayerCards) */
+	TMap<FString, UDeskillzRoomPlayerCard*> PlayerCardsById;
+
 	/** Whether current user is host */
 	bool bIsHost;
 
@@ -274,12 +277,18 @@ protected:
 	/** Update all display elements */
 	void UpdateDisplay();
 
-	/** Update player list */
+	/** Bring player cards in line with CurrentRoom, touching only cards that changed */
 	void UpdatePlayerList();
 
 	/** Create a player card */
 	UDeskillzRoomPlayerCard* CreatePlayerCard(const FRoomPlayer& Player);
 
+	/** Create and add a card for a player */
+	void AddPlayerCard(const FRoomPlayer& Player);
+
+	/** Remove a player's card */
+	void RemovePlayerCard(const FString& PlayerId);
+
 	/** Clear all player cards */
 	void ClearPlayerCards();
 
@@ -342,6 +351,9 @@ protected:
 	UFUNCTION()
 	void HandlePlayerReadyChanged(const FString& PlayerId, bool bReady);
 
+	UFUNCTION()
+	void HandlePlayerUpdated(const FRoomPlayer& Player);
+
 	UFUNCTION()
 	void HandleCountdownStarted(int32 Seconds);
 
@@ -0,0 +1,745 @@
+// Copyright Deskillz Games. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Rooms/DeskillzRoomTypes.h"
+#include "Rooms/DeskillzRoomClient.h"
+#include "Core/DeskillzSearchIndex.h"
+#include "Match/DeskillzTournamentManager.h"
+#include "Match/DeskillzTournamentStore.h"
+#include "Match/DeskillzScoreHistory.h"
+#include "Match/DeskillzMatchManager.h"
+
+/**
+ * Focused unit tests for the SDK's in-memory data structures.
+ * No SDK instance, network or world is needed.
+ */
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace DeskillzUnitTests
+{
+	FRoomPlayer MakePlayer(const FString& Id, const FString& Username = FString())
+	{
+		FRoomPlayer Player;
+		Player.Id = Id;
+		Player.Username = Username.IsEmpty() ? Id : Username;
+		return Player;
+	}
+
+	/** Every roster entry is indexed at its position, and nothing else is */
+	bool IsPlayerIndexConsistent(const FPrivateRoom& Room)
+	{
+		if (Room.PlayerIndex.Num() != Room.Players.Num())
+		{
+			return false;
+		}
+		for (int32 i = 0; i < Room.Players.Num(); i++)
+		{
+			const int32* Index = Room.PlayerIndex.Find(Room.Players[i].Id);
+			if (!Index || *Index != i)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	FPrivateRoom MakeRoom(const FString& Id, const FString& Name = FString())
+	{
+		FPrivateRoom Room;
+		Room.Id = Id;
+		Room.Name = Name.IsEmpty() ? Id : Name;
+		return Room;
+	}
+
+	/** Room JSON with every field the parser requires */
+	FString MakeRoomJson(const FString& Id, const FString& Name)
+	{
+		return FString::Printf(TEXT("{\"id\":\"%s\",\"roomCode\":\"CODE%s\",\"name\":\"%s\",\"description\":\"\",")
+			TEXT("\"entryFee\":1,\"entryCurrency\":\"USDT\",\"prizePool\":2,\"minPlayers\":2,\"maxPlayers\":4,")
+			TEXT("\"currentPlayers\":1,\"inviteRequired\":false}"), *Id, *Id, *Name);
+	}
+
+	TArray<FString> RoomIds(const TArray<FPrivateRoom>& Rooms)
+	{
+		TArray<FString> Ids;
+		for (const FPrivateRoom& Room : Rooms)
+		{
+			Ids.Add(Room.Id);
+		}
+		return Ids;
+	}
+
+	TArray<FString> MatchIds(const TArray<FDeskillzSearchIndex::FMatch>& Matches)
+	{
+		TArray<FString> Ids;
+		for (const FDeskillzSearchIndex::FMatch& Match : Matches)
+		{
+			Ids.Add(Match.Id);
+		}
+		return Ids;
+	}
+
+	const FDateTime TournamentEpoch(2026, 1, 1);
+
+	FDeskillzTournament MakeTournament(const FString& Id, int32 StartMinutes, double PrizePool, double Fee, int32 Players)
+	{
+		FDeskillzTournament Tournament;
+		Tournament.TournamentId = Id;
+		Tournament.Name = Id;
+		Tournament.Status = EDeskillzTournamentStatus::Open;
+		Tournament.StartTime = TournamentEpoch + FTimespan::FromMinutes(StartMinutes);
+		Tournament.PrizePool = PrizePool;
+		Tournament.EntryFee = FDeskillzEntryFee(EDeskillzCurrency::USDT_BSC, Fee);
+		Tournament.CurrentPlayers = Players;
+		return Tournament;
+	}
+
+	TArray<FString> TournamentIds(const TArray<FDeskillzTournament>& Tournaments)
+	{
+		TArray<FString> Ids;
+		for (const FDeskillzTournament& Tournament : Tournaments)
+		{
+			Ids.Add(Tournament.TournamentId);
+		}
+		return Ids;
+	}
+
+	TArray<FDeskillzScoreHistory::FEntry> HistoryEntries(const FDeskillzScoreHistory& History)
+	{
+		TArray<FDeskillzScoreHistory::FEntry> Entries;
+		History.ForEach([&Entries](const FDeskillzScoreHistory::FEntry& Entry)
+		{
+			Entries.Add(Entry);
+		});
+		return Entries;
+	}
+
+	bool HasEntry(const TArray<FDeskillzScoreHistory::FEntry>& Entries, int64 Score, uint32 TimeMs)
+	{
+		return Entries.ContainsByPredicate([Score, TimeMs](const FDeskillzScoreHistory::FEntry& Entry)
+		{
+			return Entry.Score == Score && Entry.TimeMs == TimeMs;
+		});
+	}
+
+	/** Checkpoints in time order with none missing from any quarter of the match */
+	bool IsTimelineCovered(const TArray<FDeskillzScoreHistory::FEntry>& Entries)
+	{
+		if (Entries.Num() == 0)
+		{
+			return false;
+		}
+
+		const uint64 Span = static_cast<uint64>(Entries.Last().TimeMs) + 1;
+		bool bQuarterSeen[4] = { false, false, false, false };
+		for (int32 i = 0; i < Entries.Num(); i++)
+		{
+			if (i > 0 && Entries[i].TimeMs < Entries[i - 1].TimeMs)
+			{
+				return false;
+			}
+			bQuarterSeen[Entries[i].TimeMs * 4 / Span] = true;
+		}
+		return bQuarterSeen[0] && bQuarterSeen[1] && bQuarterSeen[2] && bQuarterSeen[3];
+	}
+}
+
+// ============================================================================
+// ROOM PLAYER INDEX
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDeskillzRoomPlayerIndexTest,
+	"Deskillz.Unit.Rooms.PlayerIndex",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDeskillzRoomPlayerIndexTest::RunTest(const FString& Parameters)
+{
+	using namespace DeskillzUnitTests;
+
+	FPrivateRoom Room;
+	Room.AddPlayer(MakePlayer(TEXT("a")));
+	Room.AddPlayer(MakePlayer(TEXT("b")));
+	Room.AddPlayer(MakePlayer(TEXT("c")));
+	Room.AddPlayer(MakePlayer(TEXT("d")));
+
+	TestEqual(TEXT("Four players added"), Room.Players.Num(), 4);
+	TestTrue(TEXT("Index matches roster after adds"), IsPlayerIndexConsistent(Room));
+	TestNotNull(TEXT("Find c"), Room.FindPlayer(TEXT("c")));
+	TestNull(TEXT("Unknown player is not found"), Room.FindPlayer(TEXT("z")));
+
+	// Re-adding an ID overwrites in place
+	Room.AddPlayer(MakePlayer(TEXT("b"), TEXT("Renamed")));
+	TestEqual(TEXT("Overwrite keeps the count"), Room.Players.Num(), 4);
+	TestEqual(TEXT("Overwrite keeps the position"), Room.Players[1].Username, FString(TEXT("Renamed")));
+
+	// Removal keeps roster order and reindexes the tail
+	TestTrue(TEXT("Remove b"), Room.RemovePlayer(TEXT("b")));
+	TestFalse(TEXT("Removing b twice fails"), Room.RemovePlayer(TEXT("b")));
+	TestEqual(TEXT("Three players left"), Room.Players.Num(), 3);
+	TestEqual(TEXT("Order kept: a"), Room.Players[0].Id, FString(TEXT("a")));
+	TestEqual(TEXT("Order kept: c"), Room.Players[1].Id, FString(TEXT("c")));
+	TestEqual(TEXT("Order kept: d"), Room.Players[2].Id, FString(TEXT("d")));
+	TestTrue(TEXT("Index matches roster after removal"), IsPlayerIndexConsistent(Room));
+	TestNull(TEXT("Removed player is not found"), Room.FindPlayer(TEXT("b")));
+
+	const FRoomPlayer* D = Room.FindPlayer(TEXT("d"));
+	TestTrue(TEXT("Shifted player found at its new slot"), D && D->Id == TEXT("d"));
+
+	// Removing the last and first entries
+	TestTrue(TEXT("Remove d"), Room.RemovePlayer(TEXT("d")));
+	TestTrue(TEXT("Remove a"), Room.RemovePlayer(TEXT("a")));
+	TestTrue(TEXT("Index matches roster after edge removals"), IsPlayerIndexConsistent(Room));
+	TestEqual(TEXT("Only c left"), Room.Players.Num(), 1);
+
+	// Players assigned without the index are still found, then reindexed
+	FPrivateRoom Assigned;
+	Assigned.Players = { MakePlayer(TEXT("x")), MakePlayer(TEXT("y")) };
+	TestNotNull(TEXT("Unindexed roster falls back to a scan"), Assigned.FindPlayer(TEXT("y")));
+	Assigned.RebuildPlayerIndex();
+	TestTrue(TEXT("Index matches roster after rebuild"), IsPlayerIndexConsistent(Assigned));
+
+	// A stale index entry (roster reordered directly) does not return the wrong player
+	Swap(Assigned.Players[0], Assigned.Players[1]);
+	const FRoomPlayer* X = Assigned.FindPlayer(TEXT("x"));
+	TestTrue(TEXT("Stale index entry is verified before use"), X && X->Id == TEXT("x"));
+
+	return true;
+}
+
+// ============================================================================
+// PAGED ROOM LISTS
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDeskillzRoomListPageParseTest,
+	"Deskillz.Unit.Rooms.ListPageParse",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDeskillzRoomListPageParseTest::RunTest(const FString& Parameters)
+{
+	using namespace DeskillzUnitTests;
+
+	const UDeskillzRoomClient* Client = GetDefault<UDeskillzRoomClient>();
+	FRoomListPage Page;
+
+	// Paged object
+	const FString Paged = FString::Printf(TEXT("{\"rooms\":[%s,%s],\"nextCursor\":\"c2\",\"version\":7}"),
+		*MakeRoomJson(TEXT("r1"), TEXT("One")), *MakeRoomJson(TEXT("r2"), TEXT("Two")));
+	TestTrue(TEXT("Paged response parses"), Client->ParseRoomListPage(Paged, Page));
+	TestTrue(TEXT("Paged response is server-queried"), Page.bServerQueried);
+	TestFalse(TEXT("Full page is not a delta"), Page.bIsDelta);
+	TestEqual(TEXT("Paged room count"), Page.Rooms.Num(), 2);
+	TestEqual(TEXT("Server order kept"), Page.Rooms[1].Id, FString(TEXT("r2")));
+	TestEqual(TEXT("Next cursor"), Page.NextCursor, FString(TEXT("c2")));
+	TestEqual(TEXT("List version"), Page.Version, (int64)7);
+
+	// Delta
+	const FString Delta = FString::Printf(TEXT("{\"rooms\":[%s],\"removed\":[\"r2\"],\"delta\":true,\"version\":8}"),
+		*MakeRoomJson(TEXT("r1"), TEXT("One v2")));
+	TestTrue(TEXT("Delta response parses"), Client->ParseRoomListPage(Delta, Page));
+	TestTrue(TEXT("Delta flag"), Page.bIsDelta);
+	TestEqual(TEXT("Removed IDs"), Page.RemovedRoomIds.Num(), 1);
+	TestTrue(TEXT("Last page has no cursor"), Page.NextCursor.IsEmpty());
+
+	// Older servers: bare array, unpaged
+	const FString Bare = FString::Printf(TEXT("[%s]"), *MakeRoomJson(TEXT("r9"), TEXT("Nine")));
+	TestTrue(TEXT("Bare array parses"), Client->ParseRoomListPage(Bare, Page));
+	TestFalse(TEXT("Bare array is not server-queried"), Page.bServerQueried);
+	TestEqual(TEXT("Bare array room count"), Page.Rooms.Num(), 1);
+	TestEqual(TEXT("Bare array has no version"), Page.Version, (int64)0);
+
+	TestFalse(TEXT("Non-JSON body is rejected"), Client->ParseRoomListPage(TEXT("<html>"), Page));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDeskillzRoomListPageMergeTest,
+	"Deskillz.Unit.Rooms.ListPageMerge",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDeskillzRoomListPageMergeTest::RunTest(const FString& Parameters)
+{
+	using namespace DeskillzUnitTests;
+
+	TArray<FPrivateRoom> Rooms;
+
+	// First page replaces
+	FRoomListPage First;
+	First.bServerQueried = true;
+	First.Rooms = { MakeRoom(TEXT("a")), MakeRoom(TEXT("b")) };
+	Rooms = { MakeRoom(TEXT("stale")) };
+	First.ApplyTo(Rooms, false);
+	TestEqual(TEXT("Full page replaces the list"), RoomIds(Rooms), TArray<FString>({ TEXT("a"), TEXT("b") }));
+
+	// Next page appends, skipping rooms that shifted across the boundary
+	FRoomListPage Second;
+	Second.bServerQueried = true;
+	Second.Rooms = { MakeRoom(TEXT("b")), MakeRoom(TEXT("c")), MakeRoom(TEXT("c")) };
+	Second.ApplyTo(Rooms, true);
+	TestEqual(TEXT("Appended page skips loaded and repeated rooms"), RoomIds(Rooms), TArray<FString>({ TEXT("a"), TEXT("b"), TEXT("c") }));
+
+	// Delta removes, updates in place and appends
+	FRoomListPage Delta;
+	Delta.bServerQueried = true;
+	Delta.bIsDelta = true;
+	Delta.RemovedRoomIds = { TEXT("a"), TEXT("unknown") };
+	Delta.Rooms = { MakeRoom(TEXT("c"), TEXT("Renamed")), MakeRoom(TEXT("d")), MakeRoom(TEXT("d"), TEXT("Latest")) };
+	Delta.ApplyTo(Rooms, false);
+	TestEqual(TEXT("Delta result"), RoomIds(Rooms), TArray<FString>({ TEXT("b"), TEXT("c"), TEXT("d") }));
+	TestEqual(TEXT("Delta updates in place"), Rooms[1].Name, FString(TEXT("Renamed")));
+	TestEqual(TEXT("Later change to the same room wins"), Rooms[2].Name, FString(TEXT("Latest")));
+
+	// Empty delta is a no-op
+	FRoomListPage Empty;
+	Empty.bServerQueried = true;
+	Empty.bIsDelta = true;
+	Empty.ApplyTo(Rooms, false);
+	TestEqual(TEXT("Empty delta leaves the list"), Rooms.Num(), 3);
+
+	return true;
+}
+
+// ============================================================================
+// SEARCH INDEX
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDeskillzSearchIndexQueryTest,
+	"Deskillz.Unit.Core.SearchIndexQuery",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDeskillzSearchIndexQueryTest::RunTest(const FString& Parameters)
+{
+	using namespace DeskillzUnitTests;
+
+	FDeskillzSearchIndex Index;
+	Index.Update(TEXT("r1"), { TEXT("Pro Battle"), TEXT("AB7QXY"), TEXT("alice") });
+	Index.Update(TEXT("r2"), { TEXT("Probe Arena"), TEXT("ZZ12"), TEXT("bob") });
+	Index.Update(TEXT("r3"), { TEXT("Casual Lobby"), TEXT("K7QM"), TEXT("bobby") });
+	Index.Update(TEXT("r4"), { TEXT("Renegade Cup"), TEXT("R4R4"), TEXT("carl") });
+	Index.Update(TEXT("r5"), { TEXT("Big Rendezvous"), TEXT("R5R5"), TEXT("dana") });
+	TestEqual(TEXT("Five entries"), Index.Num(), 5);
+
+	// Short terms match anywhere, not just at word starts
+	TArray<FString> Ids = MatchIds(Index.Search(TEXT("7q")));
+	Ids.Sort();
+	TestEqual(TEXT("Two-character term matches mid-code"), Ids, TArray<FString>({ TEXT("r1"), TEXT("r3") }));
+	TestEqual(TEXT("Single character term"), Index.Search(TEXT("z")).Num(), 2);
+
+	// Whole field > field prefix > word prefix > substring
+	TestEqual(TEXT("Whole field ranks above field prefix"), MatchIds(Index.Search(TEXT("bob"))), TArray<FString>({ TEXT("r2"), TEXT("r3") }));
+	TestEqual(TEXT("Field prefix, word prefix, then substring"), MatchIds(Index.Search(TEXT("ren"))), TArray<FString>({ TEXT("r4"), TEXT("r5"), TEXT("r2") }));
+
+	// Earlier fields rank higher for the same kind of match
+	const TArray<FDeskillzSearchIndex::FMatch> ByField = Index.Search(TEXT("r4"));
+	TestTrue(TEXT("Code match found"), ByField.Num() == 1 && ByField[0].Id == TEXT("r4"));
+
+	// Every term must match; case is ignored
+	TestEqual(TEXT("Terms are ANDed"), MatchIds(Index.Search(TEXT("PRO bat"))), TArray<FString>({ TEXT("r1") }));
+	TestEqual(TEXT("Either entry matches one term"), Index.Search(TEXT("pro")).Num(), 2);
+
+	TestEqual(TEXT("MaxResults caps the results"), Index.Search(TEXT("pro"), 1).Num(), 1);
+	TestEqual(TEXT("Unknown gram"), Index.Search(TEXT("xyzzy")).Num(), 0);
+	TestEqual(TEXT("Every gram indexed, but in different entries"), Index.Search(TEXT("casualice")).Num(), 0);
+	TestEqual(TEXT("Empty query"), Index.Search(TEXT("   ")).Num(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDeskillzSearchIndexUpdateTest,
+	"Deskillz.Unit.Core.SearchIndexUpdate",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDeskillzSearchIndexUpdateTest::RunTest(const FString& Parameters)
+{
+	using namespace DeskillzUnitTests;
+
+	FDeskillzSearchIndex Index;
+	Index.Update(TEXT("r1"), { TEXT("Pro Battle"), TEXT("AB7Q") });
+	Index.Update(TEXT("r2"), { TEXT("Probe Arena"), TEXT("ZZ12") });
+	Index.Update(TEXT("r3"), { TEXT("Casual Lobby"), TEXT("K7QM") });
+
+	// Unchanged fields are a no-op; changed ones replace the old grams
+	Index.Update(TEXT("r1"), { TEXT("Pro Battle"), TEXT("AB7Q") });
+	TestEqual(TEXT("Re-sync keeps the count"), Index.Num(), 3);
+	TestEqual(TEXT("Re-sync keeps the match"), MatchIds(Index.Search(TEXT("battle"))), TArray<FString>({ TEXT("r1") }));
+
+	Index.Update(TEXT("r1"), { TEXT("Quiet Room"), TEXT("AB7Q") });
+	TestEqual(TEXT("Old name no longer matches"), Index.Search(TEXT("battle")).Num(), 0);
+	TestEqual(TEXT("New name matches"), MatchIds(Index.Search(TEXT("quiet"))), TArray<FString>({ TEXT("r1") }));
+
+	// Removal
+	TestTrue(TEXT("Remove r3"), Index.Remove(TEXT("r3")));
+	TestFalse(TEXT("Removing r3 twice fails"), Index.Remove(TEXT("r3")));
+	TestFalse(TEXT("r3 is gone"), Index.Contains(TEXT("r3")));
+	TestEqual(TEXT("Removed entry no longer matches"), MatchIds(Index.Search(TEXT("7q"))), TArray<FString>({ TEXT("r1") }));
+
+	// A new entry reuses the freed slot without inheriting its grams
+	Index.Update(TEXT("r6"), { TEXT("Night Owls"), TEXT("NO66") });
+	TestEqual(TEXT("Reused slot matches its own fields"), MatchIds(Index.Search(TEXT("owls"))), TArray<FString>({ TEXT("r6") }));
+	TestEqual(TEXT("Reused slot does not match the old fields"), Index.Search(TEXT("lobby")).Num(), 0);
+
+	// Retain drops everything not in the set
+	Index.Retain({ TEXT("r1"), TEXT("r6"), TEXT("missing") });
+	TestEqual(TEXT("Retain keeps two"), Index.Num(), 2);
+	TestEqual(TEXT("Dropped entry no longer matches"), Index.Search(TEXT("probe")).Num(), 0);
+	TestTrue(TEXT("Kept entry still matches"), Index.Search(TEXT("quiet")).Num() == 1);
+
+	Index.Reset();
+	TestEqual(TEXT("Reset empties the index"), Index.Num(), 0);
+	TestEqual(TEXT("Reset index finds nothing"), Index.Search(TEXT("q")).Num(), 0);
+
+	return true;
+}
+
+// ============================================================================
+// TOURNAMENT STORE
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDeskillzTournamentStoreUpdateTest,
+	"Deskillz.Unit.Match.TournamentStoreUpdate",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDeskillzTournamentStoreUpdateTest::RunTest(const FString& Parameters)
+{
+	using namespace DeskillzUnitTests;
+	using EChange = FDeskillzTournamentStore::EChange;
+
+	FDeskillzTournamentStore Store;
+	FDeskillzTournament T1 = MakeTournament(TEXT("t1"), 30, 100.0, 1.0, 5);
+	FDeskillzTournament T2 = MakeTournament(TEXT("t2"), 10, 500.0, 5.0, 2);
+	FDeskillzTournament T3 = MakeTournament(TEXT("t3"), 20, 50.0, 0.0, 8);
+
+	TestTrue(TEXT("Add t1"), Store.Upsert(T1) == EChange::Added);
+	TestTrue(TEXT("Add t2"), Store.Upsert(T2) == EChange::Added);
+	TestTrue(TEXT("Add t3"), Store.Upsert(T3) == EChange::Added);
+	TestTrue(TEXT("Unchanged upsert is a no-op"), Store.Upsert(T1) == EChange::None);
+	TestEqual(TEXT("Three tournaments"), Store.Num(), 3);
+	TestEqual(TEXT("Earliest start first"), TournamentIds(Store.ToArray()), TArray<FString>({ TEXT("t2"), TEXT("t3"), TEXT("t1") }));
+
+	// An update re-seats the tournament under its new keys
+	T1.StartTime = TournamentEpoch + FTimespan::FromMinutes(5);
+	T1.CurrentPlayers = 6;
+	TestTrue(TEXT("Changed upsert updates"), Store.Upsert(T1) == EChange::Updated);
+	TestEqual(TEXT("Updated start time reorders"), TournamentIds(Store.ToArray()), TArray<FString>({ TEXT("t1"), TEXT("t2"), TEXT("t3") }));
+	const FDeskillzTournament* Found = Store.Find(TEXT("t1"));
+	TestTrue(TEXT("Find returns the updated tournament"), Found && Found->CurrentPlayers == 6);
+	TestNull(TEXT("Unknown ID"), Store.Find(TEXT("missing")));
+
+	// Removal frees the slot for the next tournament
+	TestTrue(TEXT("Remove t3"), Store.Remove(TEXT("t3")));
+	TestFalse(TEXT("Removing t3 twice fails"), Store.Remove(TEXT("t3")));
+	TestNull(TEXT("t3 is gone"), Store.Find(TEXT("t3")));
+
+	FDeskillzTournament T4 = MakeTournament(TEXT("t4"), 60, 10.0, 2.0, 1);
+	TestTrue(TEXT("Add t4 into the freed slot"), Store.Upsert(T4) == EChange::Added);
+	TestEqual(TEXT("Indexes hold only live tournaments"), TournamentIds(Store.ToArray()), TArray<FString>({ TEXT("t1"), TEXT("t2"), TEXT("t4") }));
+	FDeskillzTournamentFilter ByName;
+	ByName.SearchText = TEXT("t3");
+	TestEqual(TEXT("Removed tournament is not searchable"), Store.Query(ByName).Num(), 0);
+
+	// Sync adds, updates and removes to match the list
+	T4.PrizePool = 20.0;
+	const FDeskillzTournament T5 = MakeTournament(TEXT("t5"), 0, 0.0, 0.0, 0);
+	TArray<FString> RemovedIds;
+	TestEqual(TEXT("Sync counts added and updated"), Store.Sync({ T1, T4, T5 }, &RemovedIds), 2);
+	TestEqual(TEXT("Sync reports the unlisted tournament"), RemovedIds, TArray<FString>({ TEXT("t2") }));
+	TestEqual(TEXT("Store matches the list"), TournamentIds(Store.ToArray()), TArray<FString>({ TEXT("t5"), TEXT("t1"), TEXT("t4") }));
+	TestEqual(TEXT("Repeated sync changes nothing"), Store.Sync({ T1, T4, T5 }), 0);
+
+	Store.Reset();
+	TestEqual(TEXT("Reset empties the store"), Store.Num(), 0);
+	TestEqual(TEXT("Reset store lists nothing"), Store.ToArray().Num(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDeskillzTournamentStoreQueryTest,
+	"Deskillz.Unit.Match.TournamentStoreQuery",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDeskillzTournamentStoreQueryTest::RunTest(const FString& Parameters)
+{
+	using namespace DeskillzUnitTests;
+
+	FDeskillzTournamentStore Store;
+	Store.Upsert(MakeTournament(TEXT("t1"), 30, 100.0, 1.0, 5));
+	FDeskillzTournament T2 = MakeTournament(TEXT("t2"), 10, 500.0, 5.0, 2);
+	T2.Name = TEXT("Weekend Finals");
+	Store.Upsert(T2);
+	FDeskillzTournament T3 = MakeTournament(TEXT("t3"), 20, 50.0, 0.0, 8);
+	T3.MaxPlayers = 8;
+	Store.Upsert(T3);
+	FDeskillzTournament T4 = MakeTournament(TEXT("t4"), 40, 100.0, 2.0, 3);
+	T4.Status = EDeskillzTournamentStatus::InProgress;
+	Store.Upsert(T4);
+
+	// Defaults: start time ascending, full tournaments hidden
+	FDeskillzTournamentFilter Filter;
+	TestEqual(TEXT("Default filter"), TournamentIds(Store.Query(Filter)), TArray<FString>({ TEXT("t2"), TEXT("t1"), TEXT("t4") }));
+
+	Filter.bOnlyOpenSlots = false;
+	TestEqual(TEXT("Full tournament included on request"), Store.Query(Filter).Num(), 4);
+
+	// Descending scans the index backwards; ties keep a stable order
+	Filter.SortBy = EDeskillzTournamentSort::PrizePool;
+	Filter.bSortAscending = false;
+	TestEqual(TEXT("Prize pool descending"), TournamentIds(Store.Query(Filter)), TArray<FString>({ TEXT("t2"), TEXT("t4"), TEXT("t1"), TEXT("t3") }));
+	TestEqual(TEXT("MaxCount stops the scan"), TournamentIds(Store.Query(Filter, 1)), TArray<FString>({ TEXT("t2") }));
+
+	Filter.SortBy = EDeskillzTournamentSort::PlayerCount;
+	Filter.bSortAscending = true;
+	TestEqual(TEXT("Player count ascending"), TournamentIds(Store.Query(Filter)), TArray<FString>({ TEXT("t2"), TEXT("t4"), TEXT("t1"), TEXT("t3") }));
+
+	// Fee range is inclusive at both ends, with or without the fee index
+	Filter.MinEntryFee = 1.0f;
+	Filter.MaxEntryFee = 2.0f;
+	Filter.SortBy = EDeskillzTournamentSort::EntryFee;
+	TestEqual(TEXT("Fee range via the fee index"), TournamentIds(Store.Query(Filter)), TArray<FString>({ TEXT("t1"), TEXT("t4") }));
+	Filter.SortBy = EDeskillzTournamentSort::StartTime;
+	TestEqual(TEXT("Fee range via a scan"), TournamentIds(Store.Query(Filter)), TArray<FString>({ TEXT("t1"), TEXT("t4") }));
+
+	// Bit-mask filters and search
+	FDeskillzTournamentFilter OpenOnly;
+	OpenOnly.bOnlyOpenSlots = false;
+	OpenOnly.StatusFilter = { EDeskillzTournamentStatus::Open };
+	TestEqual(TEXT("Status filter"), Store.Query(OpenOnly).Num(), 3);
+	OpenOnly.CurrencyFilter = { EDeskillzCurrency::BNB };
+	TestEqual(TEXT("Currency filter"), Store.Query(OpenOnly).Num(), 0);
+
+	FDeskillzTournamentFilter Search;
+	Search.SearchText = TEXT("finals");
+	TestEqual(TEXT("Search text"), TournamentIds(Store.Query(Search)), TArray<FString>({ TEXT("t2") }));
+
+	// Start window is [From, To)
+	TArray<FString> Starting;
+	Store.ForEachStartingBetween(TournamentEpoch + FTimespan::FromMinutes(10), TournamentEpoch + FTimespan::FromMinutes(30),
+		[&Starting](const FDeskillzTournament& Tournament)
+		{
+			Starting.Add(Tournament.TournamentId);
+			return true;
+		});
+	TestEqual(TEXT("Start window"), Starting, TArray<FString>({ TEXT("t2"), TEXT("t3") }));
+
+	int32 Visited = 0;
+	Store.ForEachStartingBetween(TournamentEpoch, TournamentEpoch + FTimespan::FromDays(1),
+		[&Visited](const FDeskillzTournament&)
+		{
+			++Visited;
+			return false;
+		});
+	TestEqual(TEXT("Visitor can stop the scan"), Visited, 1);
+
+	return true;
+}
+
+// ============================================================================
+// SCORE HISTORY
+// ============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDeskillzScoreHistoryEncodingTest,
+	"Deskillz.Unit.Match.ScoreHistoryEncoding",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDeskillzScoreHistoryEncodingTest::RunTest(const FString& Parameters)
+{
+	using namespace DeskillzUnitTests;
+
+	// Extreme scores and deltas survive the varint stream
+	FDeskillzScoreHistory History;
+	History.Add(MAX_int64, 0.0f, EDeskillzCheckpointEvent::Update);
+	History.Add(MIN_int64, 0.5f, EDeskillzCheckpointEvent::Checkpoint);
+	History.Add(0, 1.0f, EDeskillzCheckpointEvent::Cadence);
+	History.Add(-5, 1.001f, EDeskillzCheckpointEvent::SignificantChange);
+	History.Add(MAX_int64, 2.0f, EDeskillzCheckpointEvent::Final);
+	History.Add(7, 1.5f, EDeskillzCheckpointEvent::Update);
+
+	const TArray<FDeskillzScoreHistory::FEntry> Entries = HistoryEntries(History);
+	TestEqual(TEXT("Six checkpoints"), Entries.Num(), 6);
+	if (Entries.Num() == 6)
+	{
+		TestEqual(TEXT("Max score"), Entries[0].Score, MAX_int64);
+		TestEqual(TEXT("Min score after max"), Entries[1].Score, MIN_int64);
+		TestEqual(TEXT("Zero"), Entries[2].Score, (int64)0);
+		TestEqual(TEXT("Negative score"), Entries[3].Score, (int64)-5);
+		TestEqual(TEXT("Max score after negative"), Entries[4].Score, MAX_int64);
+		TestEqual(TEXT("Small score after max"), Entries[5].Score, (int64)7);
+
+		TestEqual(TEXT("Time 0"), Entries[0].TimeMs, (uint32)0);
+		TestEqual(TEXT("Time 500"), Entries[1].TimeMs, (uint32)500);
+		TestEqual(TEXT("Millisecond step"), Entries[3].TimeMs, (uint32)1001);
+		TestEqual(TEXT("Time never goes backwards"), Entries[5].TimeMs, (uint32)2000);
+
+		TestEqual(TEXT("Built-in event type"), Entries[1].EventType, static_cast<int32>(EDeskillzCheckpointEvent::Checkpoint));
+		TestEqual(TEXT("Final event type"), Entries[4].EventType, static_cast<int32>(EDeskillzCheckpointEvent::Final));
+	}
+	TestEqual(TEXT("Last timestamp"), History.GetLastTimestamp(), 2.0f);
+
+	// Small deltas take one byte per field
+	History.Reset();
+	TestTrue(TEXT("Reset empties the history"), History.IsEmpty() && History.GetEncoded().Num() == 0);
+	for (int32 i = 0; i < 10; i++)
+	{
+		History.Add(i, i * 0.1f, EDeskillzCheckpointEvent::Cadence);
+	}
+	TestEqual(TEXT("Three bytes per small checkpoint"), History.GetEncoded().Num(), 30);
+
+	FDeskillzScoreHistory Clamped;
+	Clamped.Add(1, -3.0f, EDeskillzCheckpointEvent::Update);
+	TestEqual(TEXT("Negative timestamps clamp to zero"), HistoryEntries(Clamped)[0].TimeMs, (uint32)0);
+
+	// Custom event names are interned after the built-in ones
+	FDeskillzScoreHistory Custom;
+	Custom.Add(10, 0.1f, FName(TEXT("combo")));
+	Custom.Add(20, 0.2f, FName(TEXT("combo")));
+	Custom.Add(30, 0.3f, FName(TEXT("update")));
+	const TArray<FDeskillzScoreHistory::FEntry> CustomEntries = HistoryEntries(Custom);
+	const int32 ComboIndex = static_cast<int32>(EDeskillzCheckpointEvent::BuiltInCount);
+	TestEqual(TEXT("Custom type follows the built-ins"), CustomEntries[0].EventType, ComboIndex);
+	TestEqual(TEXT("Custom type is reused"), CustomEntries[1].EventType, ComboIndex);
+	TestEqual(TEXT("Built-in name maps to its enum"), CustomEntries[2].EventType, static_cast<int32>(EDeskillzCheckpointEvent::Update));
+	TestEqual(TEXT("Interned name"), Custom.GetEventTypes()[ComboIndex], FName(TEXT("combo")));
+
+	Custom.Reset();
+	TestEqual(TEXT("Reset keeps interned types"), Custom.GetEventTypes().Num(), ComboIndex + 1);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDeskillzScoreHistoryDownsampleTest,
+	"Deskillz.Unit.Match.ScoreHistoryDownsample",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDeskillzScoreHistoryDownsampleTest::RunTest(const FString& Parameters)
+{
+	using namespace DeskillzUnitTests;
+
+	// Capacity below the floor is raised to 16
+	FDeskillzScoreHistory History;
+	History.SetCapacity(4);
+
+	int32 MostCheckpoints = 0;
+	int64 LastScore = 0;
+	for (int32 i = 0; i < 1000; i++)
+	{
+		int64 Score = (i * 37) % 101;
+		EDeskillzCheckpointEvent EventType = EDeskillzCheckpointEvent::Update;
+		if (i == 123)
+		{
+			Score = -1000;
+		}
+		else if (i == 777)
+		{
+			Score = 1000000;
+		}
+		else if (i == 500)
+		{
+			EventType = EDeskillzCheckpointEvent::SignificantChange;
+		}
+		else if (i == 999)
+		{
+			EventType = EDeskillzCheckpointEvent::Final;
+		}
+
+		History.Add(Score, i / 100.0f, EventType);
+		MostCheckpoints = FMath::Max(MostCheckpoints, History.Num());
+		LastScore = Score;
+	}
+
+	TestEqual(TEXT("Capacity floor"), MostCheckpoints, 16);
+	TestTrue(TEXT("History was thinned"), History.GetDownsampleCount() > 0);
+
+	const TArray<FDeskillzScoreHistory::FEntry> Entries = HistoryEntries(History);
+	TestEqual(TEXT("Count matches the stream"), Entries.Num(), History.Num());
+	TestTrue(TEXT("First checkpoint kept"), HasEntry(Entries, 0, 0));
+	TestTrue(TEXT("Last checkpoint kept"), HasEntry(Entries, LastScore, 9990));
+	TestTrue(TEXT("Minimum kept"), HasEntry(Entries, -1000, 1230));
+	TestTrue(TEXT("Maximum kept"), HasEntry(Entries, 1000000, 7770));
+	TestTrue(TEXT("Significant event kept"), Entries.ContainsByPredicate([](const FDeskillzScoreHistory::FEntry& Entry)
+	{
+		return Entry.EventType == static_cast<int32>(EDeskillzCheckpointEvent::SignificantChange) && Entry.TimeMs == 5000;
+	}));
+	TestTrue(TEXT("Every quarter of the match keeps a checkpoint"), IsTimelineCovered(Entries));
+
+	// Lowering the capacity thins what is already recorded
+	FDeskillzScoreHistory Shrunk;
+	for (int32 i = 0; i < 100; i++)
+	{
+		Shrunk.Add(i, i / 10.0f, EDeskillzCheckpointEvent::Cadence);
+	}
+	TestEqual(TEXT("Default capacity holds 100"), Shrunk.Num(), 100);
+	Shrunk.SetCapacity(16);
+	const TArray<FDeskillzScoreHistory::FEntry> ShrunkEntries = HistoryEntries(Shrunk);
+	TestTrue(TEXT("Shrinking respects the new cap"), Shrunk.Num() <= 16);
+	TestTrue(TEXT("Shrinking keeps both ends"), HasEntry(ShrunkEntries, 0, 0) && HasEntry(ShrunkEntries, 99, 9900));
+	TestTrue(TEXT("Shrinking keeps the timeline covered"), IsTimelineCovered(ShrunkEntries));
+
+	// Significant events alone are still capped
+	FDeskillzScoreHistory Significant;
+	Significant.SetCapacity(16);
+	int32 MostSignificant = 0;
+	for (int32 i = 0; i < 200; i++)
+	{
+		Significant.Add(i, i / 100.0f, EDeskillzCheckpointEvent::SignificantChange);
+		MostSignificant = FMath::Max(MostSignificant, Significant.Num());
+	}
+	const TArray<FDeskillzScoreHistory::FEntry> SignificantEntries = HistoryEntries(Significant);
+	TestTrue(TEXT("Significant-only history stays under the cap"), MostSignificant <= 16);
+	TestTrue(TEXT("Significant-only history keeps both ends"), HasEntry(SignificantEntries, 0, 0) && HasEntry(SignificantEntries, 199, 1990));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDeskillzMatchDeadlineTest,
+	"Deskillz.Unit.Match.DueTimeWarnings",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FDeskillzMatchDeadlineTest::RunTest(const FString& Parameters)
+{
+	const TArray<float> Thresholds = { 60.0f, 30.0f, 10.0f, 5.0f };
+	TSet<float> Triggered;
+
+	// Nothing is due early; thresholds the match never had time for never are
+	TestEqual(TEXT("Nothing due at the start"), UDeskillzMatchManager::GetDueTimeWarnings(Thresholds, Triggered, 30, 30.0f).Num(), 0);
+	TestEqual(TEXT("Nothing due just before a deadline"), UDeskillzMatchManager::GetDueTimeWarnings(Thresholds, Triggered, 30, 10.5f).Num(), 0);
+	TestEqual(TEXT("Overlong thresholds skipped"), UDeskillzMatchManager::GetDueTimeWarnings(Thresholds, Triggered, 30, 0.0f), TArray<float>({ 10.0f, 5.0f }));
+
+	// Resuming from the background past several deadlines fires them all, in order
+	TestEqual(TEXT("Missed deadlines all due"), UDeskillzMatchManager::GetDueTimeWarnings(Thresholds, Triggered, 90, 4.0f), TArray<float>({ 60.0f, 30.0f, 10.0f, 5.0f }));
+	Triggered.Add(60.0f);
+	TestEqual(TEXT("Triggered warnings not repeated"), UDeskillzMatchManager::GetDueTimeWarnings(Thresholds, Triggered, 90, 4.0f), TArray<float>({ 30.0f, 10.0f, 5.0f }));
+
+	// Hitched frames: 2 s of real time each, but world timers only see the
+	// clamped delta, so game time falls further behind every frame
+	constexpr int32 DurationSeconds = 30;
+	constexpr float RealDelta = 2.0f;
+	constexpr float ClampedDelta = 0.4f;
+
+	Triggered.Reset();
+	float RealElapsed = 0.0f;
+	float GameElapsed = 0.0f;
+	TMap<float, float> FiredAtReal;
+	TMap<float, float> FiredAtGame;
+	while (RealElapsed < DurationSeconds)
+	{
+		RealElapsed += RealDelta;
+		GameElapsed += FMath::Min(RealDelta, ClampedDelta);
+
+		for (float Threshold : UDeskillzMatchManager::GetDueTimeWarnings(Thresholds, Triggered, DurationSeconds, DurationSeconds - RealElapsed))
+		{
+			Triggered.Add(Threshold);
+			FiredAtReal.Add(Threshold, RealElapsed);
+			FiredAtGame.Add(Threshold, GameElapsed);
+		}
+	}
+
+	TestEqual(TEXT("10 s warning on the first frame past its deadline"), FiredAtReal.FindRef(10.0f), 20.0f);
+	TestEqual(TEXT("5 s warning on the first frame past its deadline"), FiredAtReal.FindRef(5.0f), 26.0f);
+	TestTrue(TEXT("A game-time timer would still be pending"), FiredAtGame.FindRef(10.0f) < DurationSeconds - 10.0f);
+	TestTrue(TEXT("Match expired while game time lags"), GameElapsed < DurationSeconds);
+	TestEqual(TEXT("Only thresholds that fit the match fired"), FiredAtReal.Num(), 2);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS